@@ -118,6 +118,7 @@ struct AppSettings {
     bool autoStartDownloads = true;
     bool deleteAfterFinish = false;    // Delete downloaded book after finishing
     bool downloadOnPlay = false;       // Queue download when pressing play (in addition to streaming)
+    bool downloadRoundRobin = false;   // Alternate queued downloads between podcasts
 
     // Player UI Settings
     bool showDownloadProgress = true;  // Show background download progress in player for multi-file books
@@ -6,11 +6,13 @@
 #pragma once
 
 #include <string>
+#include <string_view>
 #include <vector>
 #include <functional>
 #include <memory>
 #include <cstdint>
 #include "utils/http_client.hpp"
+#include "utils/interned_string.hpp"
 
 namespace vitaabs {
 
@@ -94,19 +96,19 @@ struct MediaItem {
     std::string type;              // "book" or "podcast"
     MediaType mediaType = MediaType::UNKNOWN;
 
-    // Book metadata
-    std::string authorName;
-    std::string narratorName;
+    // Book metadata (repeating values are interned)
+    InternedString authorName;
+    InternedString narratorName;
     std::string publishedYear;
     std::string publisher;
     std::string isbn;
     std::string asin;
     std::string language;
-    std::vector<std::string> genres;
-    std::vector<std::string> tags;
+    std::vector<InternedString> genres;
+    std::vector<InternedString> tags;
 
     // Series info
-    std::string seriesName;
+    InternedString seriesName;
     std::string seriesSequence;
 
     // Duration and progress
@@ -125,6 +127,7 @@ struct MediaItem {
     // File info
     int64_t size = 0;              // Total file size in bytes
     std::string ebookFileFormat;   // For ebooks (epub, pdf, etc.)
+    int64_t updatedAt = 0;         // Server-side item update time (ms), for incremental sync
 
     // For podcast episodes
     std::string episodeId;
@@ -142,6 +145,46 @@ struct MediaItem {
     bool isDownloaded = false;     // Item is downloaded locally
 };
 
+// Slim item for grids and rows - only what a MediaItemCell draws and what is
+// needed to open the item. Full details are fetched when MediaDetailView opens.
+struct MediaItemSummary {
+    std::string id;
+    std::string libraryId;
+    std::string episodeId;         // Podcast episodes only
+    std::string podcastId;         // Podcast episodes only
+    std::string title;
+    InternedString authorName;
+    std::string coverPath;         // Cover key (local path for downloads)
+    std::string type;              // "book", "podcast", "collection", ...
+    std::string blurb;             // Start of description, shown on focus
+    MediaType mediaType = MediaType::UNKNOWN;
+    float duration = 0.0f;
+    float currentTime = 0.0f;
+    float progress = 0.0f;
+    int episodeNumber = 0;
+    bool isFinished = false;
+    bool isDownloaded = false;
+
+    static MediaItemSummary fromItem(const MediaItem& item);
+    static std::vector<MediaItemSummary> fromItems(const std::vector<MediaItem>& items);
+
+    // Minimal MediaItem for views that take one (e.g. MediaDetailView, which
+    // loads the rest itself)
+    MediaItem toItem() const;
+};
+
+// Everything needed to download one book or podcast episode, read from a
+// single expanded item response. Files are in playback order; an empty ino
+// means the server listed no file and the direct stream URL is the fallback.
+struct DownloadPlan {
+    std::string itemId;
+    std::string episodeId;
+    MediaItem item;                       // Metadata, description and chapters
+    std::vector<AudioFileInfo> files;
+    std::string coverUrl;
+    int64_t totalSize = 0;                // Sum of file sizes (0 if unknown)
+};
+
 // Library section info
 struct Library {
     std::string id;
@@ -241,7 +284,12 @@ public:
     bool fetchLibraries(std::vector<Library>& libraries);
     bool fetchLibrary(const std::string& libraryId, Library& library);
     bool fetchLibraryItems(const std::string& libraryId, std::vector<MediaItem>& items,
-                           int page = 0, int limit = 50, const std::string& sort = "");
+                           int page = 0, int limit = 50, const std::string& sort = "",
+                           bool descending = false, int* total = nullptr);
+    // Same page parsed straight into grid summaries
+    bool fetchLibraryItems(const std::string& libraryId, std::vector<MediaItemSummary>& items,
+                           int page = 0, int limit = 50, const std::string& sort = "",
+                           bool descending = false, int* total = nullptr);
     bool fetchLibraryPersonalized(const std::string& libraryId, std::vector<PersonalizedShelf>& shelves);
     bool fetchLibrarySeries(const std::string& libraryId, std::vector<Series>& series);
     bool fetchLibraryCollections(const std::string& libraryId, std::vector<Collection>& collections);
@@ -251,9 +299,14 @@ public:
     // Items
     bool fetchItem(const std::string& itemId, MediaItem& item);
     bool fetchItemWithProgress(const std::string& itemId, MediaItem& item);
+    // Full items for many ids in a few requests; ids the server doesn't know are
+    // left out. Returns false only if no request succeeded.
+    bool fetchItemsBatch(const std::vector<std::string>& itemIds, std::vector<MediaItem>& items);
 
     // Search
-    bool search(const std::string& libraryId, const std::string& query, std::vector<MediaItem>& results);
+    // cancelToken aborts the in-flight request (e.g. when a newer query replaces this one)
+    bool search(const std::string& libraryId, const std::string& query, std::vector<MediaItem>& results,
+                HttpCancelToken cancelToken = nullptr);
     bool searchAll(const std::string& query, std::vector<MediaItem>& results);
 
     // Playback
@@ -265,8 +318,12 @@ public:
     std::string getStreamUrl(const std::string& itemId, const std::string& episodeId = "");
     std::string getDirectStreamUrl(const std::string& itemId, int fileIndex = 0);
 
+    // Files, chapters and cover for a download in one request
+    bool fetchDownloadPlan(const std::string& itemId, const std::string& episodeId, DownloadPlan& plan);
+
     // File download (for local downloads - uses /api/items/{id}/file/{ino})
     std::string getFileDownloadUrl(const std::string& itemId, const std::string& episodeId = "");
+    std::string getFileDownloadUrl(const DownloadPlan& plan, size_t fileIndex = 0);
 
     // Get all audio files for multi-file audiobooks
     bool getAudioFiles(const std::string& itemId, std::vector<AudioFileInfo>& files);
@@ -289,17 +346,22 @@ public:
 
     // Collections
     bool fetchCollection(const std::string& collectionId, Collection& collection);
-    bool fetchCollectionBooks(const std::string& collectionId, std::vector<MediaItem>& books);
+    bool fetchCollectionBooks(const std::string& collectionId, std::vector<MediaItemSummary>& books);
 
     // Series
-    bool fetchSeriesBooks(const std::string& seriesId, std::vector<MediaItem>& books);
+    bool fetchSeriesBooks(const std::string& seriesId, std::vector<MediaItemSummary>& books);
 
     // Authors
     bool fetchAuthor(const std::string& authorId, Author& author);
-    bool fetchAuthorBooks(const std::string& authorId, std::vector<MediaItem>& books);
+    bool fetchAuthorBooks(const std::string& authorId, std::vector<MediaItemSummary>& books);
 
     // Podcasts
     bool fetchPodcastEpisodes(const std::string& podcastId, std::vector<MediaItem>& episodes);
+    // Same episodes handed to onPage pageSize at a time while the list is still
+    // being parsed (onPage may move them out; returning false stops parsing).
+    // Episode descriptions aren't parsed - list rows never show them
+    bool fetchPodcastEpisodes(const std::string& podcastId, size_t pageSize,
+                              const std::function<bool(std::vector<MediaItem>& page)>& onPage);
 
     // Podcast Management (iTunes search and RSS)
     bool searchPodcasts(const std::string& query, std::vector<PodcastSearchResult>& results);
@@ -338,19 +400,31 @@ private:
     std::string buildApiUrl(const std::string& endpoint);
     MediaType parseMediaType(const std::string& typeStr);
 
-    // JSON parsing helpers
-    std::string extractJsonValue(const std::string& json, const std::string& key);
-    int extractJsonInt(const std::string& json, const std::string& key);
-    float extractJsonFloat(const std::string& json, const std::string& key);
-    bool extractJsonBool(const std::string& json, const std::string& key);
-    int64_t extractJsonInt64(const std::string& json, const std::string& key);
-    std::string extractJsonArray(const std::string& json, const std::string& key);
-    std::string extractJsonObject(const std::string& json, const std::string& key);
+    // JSON parsing helpers. Arrays and objects are returned as views into the
+    // response body, so parse temporaries cost no allocations; only the values
+    // stored in the results are copied out. Views must not outlive the body.
+    std::string extractJsonValue(std::string_view json, std::string_view key);
+    int extractJsonInt(std::string_view json, std::string_view key);
+    float extractJsonFloat(std::string_view json, std::string_view key);
+    bool extractJsonBool(std::string_view json, std::string_view key);
+    int64_t extractJsonInt64(std::string_view json, std::string_view key);
+    std::string_view extractJsonArray(std::string_view json, std::string_view key);
+    std::string_view extractJsonObject(std::string_view json, std::string_view key);
 
     // Parse complex objects
-    MediaItem parseMediaItem(const std::string& json);
-    Chapter parseChapter(const std::string& json);
-    AudioTrack parseAudioTrack(const std::string& json);
+    MediaItem parseMediaItem(std::string_view json);
+    MediaItemSummary parseMediaItemSummary(std::string_view json);  // List entries: no copies of unused fields
+    void parseItemDetails(std::string_view json, MediaItem& item);  // Chapters and tracks of an expanded item
+    AudioFileInfo parseAudioFileInfo(std::string_view json);
+    Chapter parseChapter(std::string_view json);
+    AudioTrack parseAudioTrack(std::string_view json);
+    Library parseLibrary(std::string_view json);
+    PlaybackSession parsePlaybackSession(std::string_view json);
+
+    // GET one page of (minified) library items; resp owns the body the caller parses
+    bool requestLibraryItems(const std::string& libraryId, int page, int limit,
+                             const std::string& sort, bool descending, int* total,
+                             HttpResponse& resp, std::string& libraryMediaType);
 
     HttpResponse authenticatedRequest(HttpRequest& req);
 
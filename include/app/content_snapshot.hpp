@@ -0,0 +1,44 @@
+/**
+ * VitaABS - Content Snapshot
+ * Persists the last successful home shelves and library pages in a compact
+ * binary file so tabs can render immediately on launch and revalidate in
+ * the background (stale-while-revalidate).
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <mutex>
+#include "app/audiobookshelf_client.hpp"
+
+namespace vitaabs {
+
+class ContentSnapshot {
+public:
+    static ContentSnapshot& getInstance();
+
+    // Home tab shelves (Continue Listening + Recently Added Episodes)
+    bool loadHome(std::vector<MediaItemSummary>& continueItems, std::vector<MediaItemSummary>& recentEpisodes);
+    bool saveHome(const std::vector<MediaItemSummary>& continueItems, const std::vector<MediaItemSummary>& recentEpisodes);
+
+    // First page of a library section
+    bool loadLibrary(const std::string& libraryId, std::vector<MediaItemSummary>& items);
+    bool saveLibrary(const std::string& libraryId, const std::vector<MediaItemSummary>& items);
+
+    // Remove all snapshots (e.g. on logout or server change)
+    void clear();
+
+private:
+    ContentSnapshot() = default;
+
+    std::string getSnapshotDir() const;
+    std::string getSnapshotPath(const std::string& name) const;
+
+    bool writeSnapshot(const std::string& name, const std::vector<const std::vector<MediaItemSummary>*>& sections);
+    bool readSnapshot(const std::string& name, std::vector<std::vector<MediaItemSummary>*>& sections);
+
+    std::mutex m_mutex;
+};
+
+} // namespace vitaabs
@@ -0,0 +1,88 @@
+/**
+ * VitaABS - Download Queue
+ * Ordered set of queued download keys. The next job is the smallest
+ * (round, position): positions follow the user's queue order, and rounds
+ * are 0 unless round-robin is on, in which case each podcast's episodes
+ * get increasing rounds so podcasts take turns. Positions are always >= 1
+ * (0 means "no saved place" in the persisted state). Push, pop, remove and
+ * move are O(log n); boost renumbers every job.
+ *
+ * Not thread-safe; DownloadsManager guards it with its mutex.
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <set>
+#include <unordered_map>
+#include <cstdint>
+
+namespace vitaabs {
+
+class DownloadQueue {
+public:
+    // Add at the back. Returns the position.
+    int64_t push(const std::string& key, const std::string& group);
+    // Add at a position saved earlier (loading persisted state)
+    void restore(const std::string& key, const std::string& group, int64_t position);
+
+    // Take the next job. Returns false if the queue is empty.
+    bool pop(std::string& key);
+
+    void remove(const std::string& key);
+
+    // Move ahead of everything else. Renumbers the queue (the job gets 1, the
+    // others follow in their current order), so re-read every position.
+    int64_t boost(const std::string& key);
+
+    // Swap places with the neighbouring job (delta < 0 = earlier). Returns
+    // the key of the job swapped with, or empty if already at that end.
+    // With round-robin on, a job only moves within its round, so each
+    // podcast keeps its turns.
+    std::string move(const std::string& key, int delta);
+
+    // Re-order every job (keeps the user order, recomputes rounds)
+    void setRoundRobin(bool enabled);
+    bool isRoundRobin() const { return m_roundRobin; }
+
+    bool contains(const std::string& key) const { return m_index.count(key) > 0; }
+    int64_t position(const std::string& key) const;
+    bool empty() const { return m_entries.empty(); }
+    size_t size() const { return m_entries.size(); }
+    void clear();
+
+    // Keys in pick order
+    std::vector<std::string> keys() const;
+
+private:
+    struct Entry {
+        int64_t round;
+        int64_t position;
+        std::string key;
+        std::string group;
+
+        // Ties broken on the key so two jobs never compare equal (a set
+        // would silently drop the second one)
+        bool operator<(const Entry& other) const {
+            if (round != other.round) return round < other.round;
+            if (position != other.position) return position < other.position;
+            return key < other.key;
+        }
+    };
+    using EntrySet = std::set<Entry>;
+
+    int64_t nextRound(const std::string& group);
+    void insert(Entry entry);
+    // Entries in user order (position, then key)
+    std::vector<Entry> entriesByPosition() const;
+
+    EntrySet m_entries;
+    std::unordered_map<std::string, EntrySet::iterator> m_index;
+    std::unordered_map<std::string, int64_t> m_groupRounds;  // Last round handed to each group
+    int64_t m_currentRound = 0;  // Round of the last job taken
+    int64_t m_nextPosition = 1;
+    bool m_roundRobin = false;
+};
+
+} // namespace vitaabs
@@ -0,0 +1,171 @@
+/**
+ * VitaABS - Download Store
+ * Download records and the slab that holds them. Items live in a deque
+ * (inserts never move them) and are reached through generation-checked
+ * handles. Erased slots are recycled through a free list, and live items
+ * are threaded on a list in insertion order for iteration. Hash indices
+ * on (itemId, episodeId) and on itemId make lookups O(1) instead of a scan.
+ *
+ * An item's itemId and episodeId must not change once it is stored.
+ * Not thread-safe; DownloadsManager guards it with its mutex.
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <deque>
+#include <unordered_map>
+#include <cstdint>
+#include <iterator>
+#include <ctime>
+#include "utils/interned_string.hpp"
+
+namespace vitaabs {
+
+// Download state
+enum class DownloadState {
+    QUEUED,
+    DOWNLOADING,
+    PAUSED,
+    COMPLETED,
+    FAILED
+};
+
+// Download file info (for multi-file audiobooks)
+struct DownloadFileInfo {
+    std::string ino;            // File inode for download URL
+    std::string filename;       // Local filename
+    std::string localPath;      // Full local path
+    int64_t size = 0;           // File size
+    float duration = 0.0f;      // Duration in seconds (timeline offsets)
+    bool downloaded = false;    // Download complete
+};
+
+// Chapter info for offline playback
+struct DownloadChapter {
+    std::string title;
+    float start = 0.0f;   // Start time in seconds
+    float end = 0.0f;     // End time in seconds
+};
+
+// Download item information
+struct DownloadItem {
+    std::string itemId;         // Audiobookshelf item ID
+    std::string episodeId;      // Episode ID (for podcasts)
+    std::string title;          // Display title
+    InternedString authorName;  // Author/narrator name
+    InternedString parentTitle; // Series name or parent title (for display)
+    std::string localPath;      // Local storage path (folder for multi-file)
+    std::string coverUrl;       // Cover image URL (remote)
+    std::string localCoverPath; // Local cover image path (for offline)
+    std::string description;    // Book/podcast description (for offline)
+    int64_t totalBytes = 0;     // Total file size (all files combined)
+    int64_t downloadedBytes = 0; // Downloaded so far
+    float duration = 0.0f;      // Media duration in seconds
+    float currentTime = 0.0f;   // Watch progress in seconds
+    int64_t viewOffset = 0;     // Progress in milliseconds (for UI compatibility)
+    DownloadState state = DownloadState::QUEUED;
+    std::string mediaType;      // "book", "podcast"
+    InternedString seriesName;  // Series name for audiobooks
+    int numChapters = 0;        // Number of chapters
+    std::vector<DownloadChapter> chapters;  // Chapter info for offline
+    int numFiles = 1;           // Number of audio files (1 = single file)
+    int currentFileIndex = 0;   // Current file being downloaded
+    std::vector<DownloadFileInfo> files;  // Multi-file info
+    time_t lastSynced = 0;      // Last time progress was synced to server
+    int64_t queuePosition = 0;  // Place in the download queue (0 = never queued)
+};
+
+
+// Refers to one stored download; get() returns nullptr once it is erased
+struct DownloadHandle {
+    uint32_t index = UINT32_MAX;
+    uint32_t generation = 0;
+
+    bool valid() const { return index != UINT32_MAX; }
+};
+
+class DownloadStore {
+public:
+    DownloadStore() = default;
+    DownloadStore(const DownloadStore&) = delete;
+    DownloadStore& operator=(const DownloadStore&) = delete;
+
+    // Key of the (itemId, episodeId) index; a podcast's episodes share the itemId
+    static std::string makeKey(const std::string& itemId, const std::string& episodeId);
+
+    DownloadHandle insert(const DownloadItem& item);
+    void erase(DownloadHandle handle);
+    void clear();
+
+    DownloadItem* get(DownloadHandle handle);
+    const DownloadItem* get(DownloadHandle handle) const;
+
+    // Exact (itemId, episodeId) match
+    DownloadHandle find(const std::string& itemId, const std::string& episodeId) const;
+    DownloadHandle findKey(const std::string& key) const;
+    // Handles of every download of an item (a book, or a podcast's episodes),
+    // oldest first
+    std::vector<DownloadHandle> findAll(const std::string& itemId) const;
+
+    size_t size() const { return m_size; }
+    bool empty() const { return m_size == 0; }
+
+    // Insertion-order iteration over live items
+    template <typename Store, typename Item>
+    class Iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = DownloadItem;
+        using difference_type = std::ptrdiff_t;
+        using pointer = Item*;
+        using reference = Item&;
+
+        Iterator(Store* store, uint32_t index) : m_store(store), m_index(index) {}
+        reference operator*() const { return m_store->itemAt(m_index); }
+        pointer operator->() const { return &m_store->itemAt(m_index); }
+        Iterator& operator++() { m_index = m_store->nextOf(m_index); return *this; }
+        bool operator==(const Iterator& other) const { return m_index == other.m_index; }
+        bool operator!=(const Iterator& other) const { return m_index != other.m_index; }
+
+    private:
+        Store* m_store;
+        uint32_t m_index;
+    };
+    using iterator = Iterator<DownloadStore, DownloadItem>;
+    using const_iterator = Iterator<const DownloadStore, const DownloadItem>;
+
+    iterator begin() { return iterator(this, m_head); }
+    iterator end() { return iterator(this, NONE); }
+    const_iterator begin() const { return const_iterator(this, m_head); }
+    const_iterator end() const { return const_iterator(this, NONE); }
+
+private:
+    static const uint32_t NONE = UINT32_MAX;
+
+    struct Slot {
+        DownloadItem item;
+        uint32_t generation = 0;
+        uint32_t prev = NONE;
+        uint32_t next = NONE;
+        bool live = false;
+    };
+
+    DownloadItem& itemAt(uint32_t index);
+    const DownloadItem& itemAt(uint32_t index) const;
+    uint32_t nextOf(uint32_t index) const;
+
+    std::deque<Slot> m_slots;
+    std::vector<uint32_t> m_free;
+    uint32_t m_head = NONE;
+    uint32_t m_tail = NONE;
+    size_t m_size = 0;
+
+    std::unordered_map<std::string, uint32_t> m_byKey;
+    std::unordered_map<std::string, std::vector<uint32_t>> m_byItemId;
+
+    template <typename, typename> friend class Iterator;
+};
+
+} // namespace vitaabs
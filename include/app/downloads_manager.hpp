@@ -9,71 +9,80 @@
 #include <string>
 #include <vector>
 #include <functional>
+#include <memory>
 #include <mutex>
 #include <atomic>
 #include <chrono>
 #include <cstdint>
+#include <unordered_map>
+#include <unordered_set>
+#include "player/virtual_timeline.hpp"
+#include "app/download_queue.hpp"
+#include "app/download_store.hpp"
 
 namespace vitaabs {
 
-// Download state
-enum class DownloadState {
-    QUEUED,
-    DOWNLOADING,
-    PAUSED,
-    COMPLETED,
-    FAILED
-};
+struct MediaItem;
+struct DownloadPlan;
+
+// Immutable view of all downloads for the UI. A new snapshot is published on
+// every change; items that didn't change are shared with the previous one.
+struct DownloadsSnapshot {
+    // Positions in items; shared by snapshots holding the same downloads
+    struct Index {
+        std::unordered_map<std::string, size_t> byKey;     // DownloadStore::makeKey
+        std::unordered_map<std::string, size_t> byItemId;  // First download of the item
+    };
 
-// Download file info (for multi-file audiobooks)
-struct DownloadFileInfo {
-    std::string ino;            // File inode for download URL
-    std::string filename;       // Local filename
-    std::string localPath;      // Full local path
-    int64_t size = 0;           // File size
-    bool downloaded = false;    // Download complete
+    uint64_t version = 0;       // Increases with every published change
+    std::vector<std::shared_ptr<const DownloadItem>> items;  // Insertion order
+    std::vector<int> queueRanks;  // Per item: place in the download queue, -1 if not queued
+    std::shared_ptr<const Index> index;
+
+    // Download of itemId matching episodeId, or the first of the item if episodeId is empty
+    const DownloadItem* find(const std::string& itemId, const std::string& episodeId = "") const;
 };
 
-// Chapter info for offline playback
-struct DownloadChapter {
-    std::string title;
-    float start = 0.0f;   // Start time in seconds
-    float end = 0.0f;     // End time in seconds
+using DownloadsSnapshotRef = std::shared_ptr<const DownloadsSnapshot>;
+
+enum class DownloadEventType {
+    ADDED,              // Download queued or registered
+    REMOVED,            // Download cancelled or deleted
+    STATE_CHANGED,      // State, queue place, title or cover changed
+    PROGRESS,           // Only the downloaded bytes changed
+    DOWNLOADER_CHANGED  // Download thread started or stopped (no item)
 };
 
-// Download item information
-struct DownloadItem {
-    std::string itemId;         // Audiobookshelf item ID
-    std::string episodeId;      // Episode ID (for podcasts)
-    std::string title;          // Display title
-    std::string authorName;     // Author/narrator name
-    std::string parentTitle;    // Series name or parent title (for display)
-    std::string localPath;      // Local storage path (folder for multi-file)
-    std::string coverUrl;       // Cover image URL (remote)
-    std::string localCoverPath; // Local cover image path (for offline)
-    std::string description;    // Book/podcast description (for offline)
-    int64_t totalBytes = 0;     // Total file size (all files combined)
-    int64_t downloadedBytes = 0; // Downloaded so far
-    float duration = 0.0f;      // Media duration in seconds
-    float currentTime = 0.0f;   // Watch progress in seconds
-    int64_t viewOffset = 0;     // Progress in milliseconds (for UI compatibility)
+struct DownloadEvent {
+    DownloadEventType type = DownloadEventType::STATE_CHANGED;
+    std::string itemId;
+    std::string episodeId;
     DownloadState state = DownloadState::QUEUED;
-    std::string mediaType;      // "book", "podcast"
-    std::string seriesName;     // Series name for audiobooks
-    int numChapters = 0;        // Number of chapters
-    std::vector<DownloadChapter> chapters;  // Chapter info for offline
-    int numFiles = 1;           // Number of audio files (1 = single file)
-    int currentFileIndex = 0;   // Current file being downloaded
-    std::vector<DownloadFileInfo> files;  // Multi-file info
-    time_t lastSynced = 0;      // Last time progress was synced to server
+    int64_t downloadedBytes = 0;
+    int64_t totalBytes = 0;
 };
 
+// Event listener: called on the UI thread with every event since the last
+// call, at most one per download (later changes replace earlier ones)
+using DownloadEventListener = std::function<void(const std::vector<DownloadEvent>&)>;
+
 // Progress callback: (downloadedBytes, totalBytes)
 using DownloadProgressCallback = std::function<void(float, float)>;
 
 // Item completion callback: (itemId, episodeId, success)
 using ItemCompletionCallback = std::function<void(const std::string&, const std::string&, bool)>;
 
+// One download for queueDownloads
+struct DownloadRequest {
+    std::string itemId;
+    std::string title;
+    std::string authorName;
+    float duration = 0.0f;
+    std::string mediaType = "book";
+    std::string seriesName;
+    std::string episodeId;
+};
+
 class DownloadsManager {
 public:
     static DownloadsManager& getInstance();
@@ -87,10 +96,22 @@ public:
                        const std::string& mediaType = "book",
                        const std::string& seriesName = "",
                        const std::string& episodeId = "");
+    // Queue several downloads with one save; those already stored are
+    // skipped. Returns how many were queued
+    int queueDownloads(const std::vector<DownloadRequest>& requests);
 
     // Start downloading queued items (uses atomic flag to prevent double-start)
     void startDownloads();
 
+    // Move a queued download one place earlier (delta < 0) or later
+    bool moveDownload(const std::string& itemId, const std::string& episodeId, int delta);
+
+    // Download a queued item next (e.g. the user pressed play on it)
+    bool prioritizeDownload(const std::string& itemId, const std::string& episodeId = "");
+
+    // Alternate queued downloads between podcasts instead of strict queue order
+    void setRoundRobin(bool enabled);
+
     // Pause all downloads
     void pauseDownloads();
 
@@ -106,6 +127,10 @@ public:
     // Delete a downloaded episode by episodeId (for podcasts where multiple episodes share same itemId)
     bool deleteDownloadByEpisodeId(const std::string& itemId, const std::string& episodeId);
 
+    // Current snapshot of all downloads. Doesn't wait for the download thread;
+    // compare the version with the last one seen to skip redundant UI rebuilds.
+    DownloadsSnapshotRef getSnapshot() const;
+
     // Get all download items (deep copy - use sparingly)
     std::vector<DownloadItem> getDownloads() const;
 
@@ -120,24 +145,22 @@ public:
         int64_t downloadedBytes = 0;
         int64_t totalBytes = 0;
         DownloadState state = DownloadState::QUEUED;
+        int queueRank = -1;     // Place in the download queue, -1 if not queued
     };
     std::vector<DownloadStateInfo> getDownloadStates() const;
 
-    // Get a specific download by item ID
-    DownloadItem* getDownload(const std::string& itemId);
-
-    // Get a specific download by item ID and episode ID (for podcasts)
-    DownloadItem* getDownload(const std::string& itemId, const std::string& episodeId);
-
     // Check if media is downloaded (checks both itemId and episodeId for episodes)
     bool isDownloaded(const std::string& itemId, const std::string& episodeId = "") const;
 
     // Get local playback path for downloaded media
     std::string getLocalPath(const std::string& itemId) const;
 
-    // Get playback path for multi-file audiobooks (returns first file or single file path)
+    // Get playback path (an edl:// timeline over all files for multi-file audiobooks)
     std::string getPlaybackPath(const std::string& itemId) const;
 
+    // Offset table over the files of a download (one segment for single-file)
+    static VirtualTimeline makeTimeline(const DownloadItem& item);
+
     // Update watch progress for downloaded media
     void updateProgress(const std::string& itemId, float currentTime, const std::string& episodeId = "");
 
@@ -175,6 +198,10 @@ public:
     // Returns number of items updated
     int updateMissingMetadata();
 
+    // Subscribe to download events. Returns an id for unsubscribeEvents().
+    int subscribeEvents(DownloadEventListener listener);
+    void unsubscribeEvents(int id);
+
     // Set progress callback for UI updates
     void setProgressCallback(DownloadProgressCallback callback);
 
@@ -212,8 +239,54 @@ private:
     DownloadsManager(const DownloadsManager&) = delete;
     DownloadsManager& operator=(const DownloadsManager&) = delete;
 
-    // Download a single item (runs in background)
-    void downloadItem(DownloadItem& item);
+    // Download a single item (runs in background). item is the download
+    // thread's own copy; the stored item only changes through commitDownload
+    void downloadItem(DownloadHandle handle, DownloadItem& item);
+    // Copy the download thread's results into the stored item and save
+    void commitDownload(DownloadHandle handle, const DownloadItem& item);
+
+    // Copy title, author, duration and chapters of a fetched server item
+    void applyServerMetadata(DownloadItem& item, const MediaItem& mediaInfo);
+    // Copy description and chapters of a finished download's plan
+    void storePlanMetadata(DownloadItem& item, const DownloadPlan& plan);
+    // Delete a download's audio file, or all files and the folder of a
+    // multi-file download (caller must hold m_mutex)
+    void removeLocalFiles(const DownloadItem& item);
+
+    // Download of itemId matching episodeId, or the first of the item if
+    // episodeId is empty (caller must hold m_mutex)
+    DownloadHandle findDownloadUnlocked(const std::string& itemId, const std::string& episodeId) const;
+    // Same, but only COMPLETED downloads
+    DownloadHandle findCompletedUnlocked(const std::string& itemId, const std::string& episodeId) const;
+    bool deleteDownloadUnlocked(DownloadHandle handle);
+
+    // Add a QUEUED item to the download queue, at its old place if it had one
+    // (caller must hold m_mutex)
+    void enqueueUnlocked(DownloadItem& item);
+    // Rebuild the download queue from the QUEUED items (caller must hold m_mutex)
+    void rebuildQueueUnlocked();
+
+    // Publish a new snapshot of all downloads; items not marked dirty keep
+    // their previous copy (caller must hold m_mutex)
+    void publishSnapshotUnlocked();
+    // Publish a snapshot in which only this item is copied anew (caller must hold m_mutex)
+    void publishItemUnlocked(const DownloadItem& item);
+    // Note that a stored item changed, for the next publish (caller must hold m_mutex)
+    void markDirtyUnlocked(const DownloadItem& item);
+    // Publish what changed since the last snapshot: only the dirty items, or
+    // the whole list if downloads were added or removed or the queue changed
+    // (caller must hold m_mutex)
+    void publishChangesUnlocked();
+    // Store and publish download progress from the download thread, a few
+    // times a second
+    void publishProgress(DownloadHandle handle, const DownloadItem& item);
+
+    // Post the events between two versions of an item
+    void postChangeEvent(const DownloadItem& before, const DownloadItem& after, bool moved);
+    // Queue an event, merging it with a pending one for the same download
+    void postEvent(DownloadEvent event);
+    // Deliver pending events (runs on the UI thread)
+    void dispatchEvents();
 
     // Internal save without locking (caller must hold m_mutex)
     void saveStateUnlocked();
@@ -226,7 +299,8 @@ private:
     bool isDownloadCancelled() const;
     void clearCancelFlag();
 
-    std::vector<DownloadItem> m_downloads;
+    DownloadStore m_downloads;  // Stable addresses: the download thread holds an item by reference
+    DownloadQueue m_queue;      // Keys of QUEUED items in download order
     mutable std::mutex m_mutex;
     std::atomic<bool> m_downloading{false};
     std::atomic<bool> m_downloadThreadActive{false};
@@ -238,6 +312,22 @@ private:
     ItemCompletionCallback m_itemCompletionCallback;
     std::string m_downloadsPath;
 
+    // Published with std::atomic_store so readers never take m_mutex
+    DownloadsSnapshotRef m_snapshot = std::make_shared<const DownloadsSnapshot>();
+    uint64_t m_snapshotVersion = 0;
+    // Not yet published: stored items changed in place, and whether the list
+    // itself (membership or queue order) changed
+    std::unordered_set<const DownloadItem*> m_dirtyItems;
+    bool m_layoutDirty = false;
+    std::chrono::steady_clock::time_point m_lastProgressPublish;  // Download thread only
+
+    // Events waiting for the next dispatch on the UI thread
+    std::mutex m_eventMutex;
+    std::vector<DownloadEvent> m_pendingEvents;
+    bool m_dispatchScheduled = false;
+    std::unordered_map<int, DownloadEventListener> m_eventListeners;
+    int m_nextListenerId = 1;
+
     // Debouncing for saveStateUnlocked
     std::chrono::steady_clock::time_point m_lastSaveTime;
     bool m_saveStatePending = false;
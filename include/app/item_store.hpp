@@ -0,0 +1,82 @@
+/**
+ * VitaABS - Item Store
+ * Id-keyed store of shared, immutable item entities. Tabs and cells hold
+ * ItemRef handles instead of their own copies, so the same book shown on
+ * Home, in a library and in search results is one object. Updates are
+ * copy-on-write: a changed item gets a new entity and every subscriber of
+ * its key is handed the new handle (e.g. one progress update patches all
+ * visible cells).
+ *
+ * Call from the UI thread; listeners run on the calling thread.
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <functional>
+#include <unordered_map>
+#include <mutex>
+#include "app/audiobookshelf_client.hpp"
+
+namespace vitaabs {
+
+using ItemRef = std::shared_ptr<const MediaItemSummary>;
+
+// Listener: (new entity)
+using ItemChangeListener = std::function<void(const ItemRef&)>;
+
+class ItemStore {
+public:
+    static ItemStore& getInstance();
+
+    // Store fresh server data. Returns the existing entity if nothing changed,
+    // otherwise a new one that subscribers are notified with.
+    ItemRef put(const MediaItemSummary& item);
+    std::vector<ItemRef> putAll(const std::vector<MediaItemSummary>& items);
+
+    // Store possibly stale data (snapshots, local index). An entity already in
+    // the store wins, so cached data never overwrites newer progress.
+    ItemRef intern(const MediaItemSummary& item);
+    std::vector<ItemRef> internAll(const std::vector<MediaItemSummary>& items);
+
+    // Current entity for a key, or nullptr
+    ItemRef get(const std::string& key);
+
+    // Copy-on-write listening progress update from the player
+    void updateProgress(const std::string& itemId, const std::string& episodeId,
+                        float currentTime, float duration, bool isFinished);
+
+    // Subscribe to changes of one item. Returns an id for unsubscribe().
+    int subscribe(const std::string& key, ItemChangeListener listener);
+    void unsubscribe(int id);
+
+    // Drop all entities (e.g. on logout); handles already held stay valid
+    void clear();
+
+    static std::string makeKey(const std::string& itemId, const std::string& episodeId);
+    static std::string makeKey(const MediaItemSummary& item);
+
+private:
+    ItemStore() = default;
+
+    struct Subscription {
+        std::string key;
+        ItemChangeListener listener;
+    };
+
+    ItemRef store(const MediaItemSummary& item, bool replace);
+    void notify(const std::string& key, const ItemRef& item);
+    void pruneUnlocked();
+
+    std::unordered_map<std::string, ItemRef> m_items;
+    std::unordered_map<int, Subscription> m_subscriptions;
+    std::unordered_multimap<std::string, int> m_subscriptionsByKey;
+    int m_nextSubscriptionId = 1;
+    size_t m_pruneThreshold = 256;
+
+    std::mutex m_mutex;
+};
+
+} // namespace vitaabs
@@ -0,0 +1,72 @@
+/**
+ * VitaABS - Metadata Store
+ * Persistent per-library store of MediaItem metadata so whole libraries can
+ * be browsed and searched locally. Synced incrementally using item updatedAt,
+ * so only items changed on the server cross the network.
+ *
+ * On-disk format (native endianness, device-local):
+ *   StoreHeader | StoreRecord[recordCount] (sorted by item id) | string table
+ * Records are fixed-size; every string field is an (offset, length) pair into
+ * a de-duplicated string table. A loaded file stays in memory with its
+ * records indexed by id, so a lookup decodes one record without re-reading
+ * or parsing the rest of the file.
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <memory>
+#include <mutex>
+#include <cstdint>
+#include "app/audiobookshelf_client.hpp"
+
+namespace vitaabs {
+
+class MetadataStore {
+public:
+    static MetadataStore& getInstance();
+
+    // Load every stored item of a library. Returns false if nothing is stored.
+    bool loadLibrary(const std::string& libraryId, std::vector<MediaItem>& items);
+
+    // Look up a single item by id
+    bool getItem(const std::string& libraryId, const std::string& itemId, MediaItem& item);
+
+    // Bring the stored copy of a library up to date with the server.
+    // Fetches items newest-updated first and stops at the first page that holds
+    // nothing newer than the last sync; falls back to a full fetch when the
+    // server's item count shows deletions. Blocking - call from a worker.
+    // changedCount receives the number of items added or updated.
+    bool syncLibrary(const std::string& libraryId, int* changedCount = nullptr);
+
+    // Newest updatedAt seen for a library (0 if never synced)
+    int64_t getLastSync(const std::string& libraryId);
+
+    // Remove all stored libraries (e.g. on logout)
+    void clear();
+
+private:
+    MetadataStore() = default;
+
+    std::string getStoreDir() const;
+    std::string getStorePath(const std::string& libraryId) const;
+
+    // A store file held in memory, with its records indexed by item id
+    struct LoadedStore {
+        std::vector<uint8_t> data;
+        std::unordered_map<std::string, uint32_t> recordById;
+    };
+
+    // Reads and indexes the file on first use; null if missing or invalid
+    std::shared_ptr<const LoadedStore> getLoaded(const std::string& libraryId);
+
+    bool readStore(const std::string& libraryId, std::vector<MediaItem>& items, int64_t& lastSync);
+    bool writeStore(const std::string& libraryId, std::vector<MediaItem>& items, int64_t lastSync);
+
+    std::unordered_map<std::string, std::shared_ptr<const LoadedStore>> m_loaded;  // By library id
+    std::mutex m_mutex;
+};
+
+} // namespace vitaabs
@@ -0,0 +1,96 @@
+/**
+ * VitaABS - Search Index
+ * On-device inverted index over item metadata seen by the app (library
+ * pages, home shelves, podcast episodes, search results and downloads).
+ * Lets SearchTab answer instantly and offline; server search only fills gaps.
+ *
+ * Postings are added incrementally by the thread that indexed the items and
+ * published as an immutable snapshot, so search() is a lock-free lookup
+ * that never waits for indexing.
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <memory>
+#include <mutex>
+#include <cstdint>
+#include "app/audiobookshelf_client.hpp"
+
+namespace vitaabs {
+
+class SearchIndex {
+public:
+    static SearchIndex& getInstance();
+
+    // Add or update items (keyed by item id + episode id). Tokenizes the new
+    // items before returning (or leaves them to a rebuild already running on
+    // another thread) - call from a worker, not the UI thread
+    void indexItems(const std::vector<MediaItem>& items);
+    void indexItems(const std::vector<MediaItemSummary>& items);  // Title/author only
+
+    // Replace the downloaded-items part of the index with the current
+    // DownloadsManager contents (handles added and deleted downloads).
+    // Updates the postings like indexItems
+    void syncDownloads();
+
+    // Prefix search: every query token must prefix-match a token of the item's
+    // title, author, narrator, series or podcast name. Results keep index order.
+    std::vector<MediaItemSummary> search(const std::string& query, size_t maxResults = 100);
+
+    // Key used to de-duplicate local and server results
+    static std::string itemKey(const MediaItem& item);
+    static std::string itemKey(const MediaItemSummary& item);
+
+    void clear();
+
+private:
+    SearchIndex();
+
+    struct Document {
+        std::shared_ptr<const MediaItemSummary> item;  // What result cells show
+        std::string searchText;     // Title/author/narrator/series, for tokenizing
+        bool fromDownloads = false; // Owned by syncDownloads()
+        bool removed = false;       // Tombstone until the next compaction
+    };
+
+    // Sorted (token, document index) pairs; a prefix query is a lower_bound + scan
+    using Postings = std::vector<std::pair<std::string, uint32_t>>;
+
+    // What search() reads, built from the documents by rebuild()
+    struct Snapshot {
+        uint64_t generation = 0;
+        // Indexed by document; null for documents removed since the last compaction
+        std::vector<std::shared_ptr<const MediaItemSummary>> items;
+        // Largest first. Each rebuild adds a run for the new documents and
+        // merges it with smaller neighbours, so there are O(log n) runs
+        std::vector<std::shared_ptr<const Postings>> runs;
+    };
+
+    void addDocument(MediaItemSummary item, std::string searchText, bool fromDownloads);
+    void removeDocument(Document& doc);
+    // Publish a new snapshot if the documents changed since the last one.
+    // Only documents added since the last publish are tokenized, outside
+    // m_mutex. One thread rebuilds at a time; callers that find a rebuild
+    // running leave their documents to it.
+    void rebuild();
+
+    static void tokenize(const std::string& text, std::vector<std::string>& tokens);
+
+    std::vector<Document> m_docs;
+    std::unordered_map<std::string, size_t> m_docByKey;
+
+    uint64_t m_generation = 0;  // Bumped on every document change
+    size_t m_postedDocs = 0;    // Documents [0, m_postedDocs) have postings
+    size_t m_removedDocs = 0;   // Tombstones in m_docs
+    bool m_rebuilding = false;
+
+    // Accessed with std::atomic_load / std::atomic_store
+    std::shared_ptr<const Snapshot> m_snapshot;
+
+    std::mutex m_mutex;  // Guards the documents
+};
+
+} // namespace vitaabs
@@ -47,6 +47,7 @@ struct MpvPlaybackInfo {
     int subtitleTrack = 0;
     int audioTrack = 0;
     double cacheUsed = 0.0;
+    double cacheDuration = -1.0;    // Seconds buffered ahead, -1 if unknown
     bool seeking = false;
     bool buffering = false;
     double bufferingPercent = 0.0;
@@ -156,6 +157,7 @@ private:
     void handleEvent(mpv_event* event);
     void handlePropertyChange(mpv_event_property* prop, uint64_t id);
     void setState(MpvPlayerState newState);
+    void reportStreamCache();
 
     mpv_handle* m_mpv = nullptr;
     mpv_render_context* m_mpvRenderCtx = nullptr;
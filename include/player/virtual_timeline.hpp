@@ -0,0 +1,37 @@
+/**
+ * VitaABS - Virtual Timeline
+ * Plays the files of a multi-file download as one continuous book. The
+ * files and their lengths are handed to mpv as an EDL, so chapters and
+ * seeking work across file boundaries without concatenating the files on
+ * disk.
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+namespace vitaabs {
+
+struct TimelineSegment {
+    std::string path;
+    double duration = 0.0;   // 0 if unknown
+};
+
+class VirtualTimeline {
+public:
+    // Segments are played in the order they are added
+    void addSegment(const std::string& path, double duration);
+
+    bool empty() const { return m_segments.empty(); }
+
+    // edl:// URL playing every segment back to back. When every length is
+    // known it is written into the EDL, so mpv doesn't probe each file on
+    // load; otherwise mpv works the lengths out itself.
+    std::string toEdlUrl() const;
+
+private:
+    std::vector<TimelineSegment> m_segments;
+};
+
+} // namespace vitaabs
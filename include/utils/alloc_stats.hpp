@@ -0,0 +1,28 @@
+/**
+ * VitaABS - Allocation statistics
+ * Counts heap allocations made by the current thread, used to measure how
+ * much a response parse allocates. Counting needs the global operator new
+ * replacement, which is only compiled in with -DVITAABS_ALLOC_STATS=ON;
+ * otherwise enabled() is false and counts stay 0.
+ */
+
+#pragma once
+
+#include <cstddef>
+
+namespace vitaabs {
+
+class AllocCounter {
+public:
+    AllocCounter();
+
+    // Allocations on this thread since construction
+    size_t count() const;
+
+    static bool enabled();
+
+private:
+    size_t m_start;
+};
+
+} // namespace vitaabs
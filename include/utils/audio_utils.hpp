@@ -7,10 +7,67 @@
 
 #include <string>
 #include <vector>
+#include <memory>
+#include <fstream>
 #include <functional>
+#include <cstdint>
 
 namespace vitaabs {
 
+/**
+ * Builds one combined audio file while its tracks arrive, so no pass over
+ * the finished tracks is needed and they never all sit on disk at once.
+ *
+ * MP3 output (MP3 frames are self-contained) takes the downloaded bytes
+ * directly through appendData(). Other formats are remuxed with FFmpeg
+ * stream copy, one finished track file at a time via appendFile().
+ */
+class AudioConcatenator {
+public:
+    explicit AudioConcatenator(const std::string& outputPath);
+    ~AudioConcatenator();  // Removes the output unless finish() succeeded
+
+    AudioConcatenator(const AudioConcatenator&) = delete;
+    AudioConcatenator& operator=(const AudioConcatenator&) = delete;
+
+    // True if tracks can be streamed in with appendData()
+    bool acceptsRawData() const { return m_binary; }
+
+    // Append raw bytes of the current track (binary output only)
+    bool appendData(const char* data, size_t size);
+    // Mark the end of a track fed through appendData()
+    void endTrack();
+
+    // Append a complete track file; the file is deleted afterwards if requested
+    bool appendFile(const std::string& inputPath, bool deleteInput = true);
+
+    // Write the trailer and close the output
+    bool finish();
+
+    int tracksAppended() const { return m_tracksAppended; }
+    const std::string& outputPath() const { return m_outputPath; }
+
+private:
+    struct Remuxer;
+
+    bool openBinaryOutput();
+    void closeBinaryOutput();
+
+    std::string m_outputPath;
+    bool m_binary = false;
+    bool m_failed = false;
+    bool m_finished = false;
+    int m_tracksAppended = 0;
+    int64_t m_trackBytes = 0;   // Bytes of the track being streamed
+
+#ifdef __vita__
+    int m_fd = -1;
+#else
+    std::ofstream m_file;
+#endif
+    std::unique_ptr<Remuxer> m_remuxer;
+};
+
 /**
  * Concatenate multiple audio files into a single file using FFmpeg
  * Uses stream copy for fast concatenation without re-encoding
@@ -0,0 +1,69 @@
+/**
+ * VitaABS - HTTP response cache
+ * Caches GET responses of requests that set HttpRequest::cacheTtl. Fresh
+ * entries are served without a round trip; stale ones that carried an ETag
+ * are revalidated with If-None-Match, so an unchanged resource costs a 304
+ * instead of the full body. Concurrent identical requests share one fetch.
+ * Mutations call invalidate() for the URLs they change. When full, the
+ * least recently used entry is evicted.
+ */
+
+#pragma once
+
+#include <string>
+#include <unordered_map>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <condition_variable>
+#include <chrono>
+#include <functional>
+#include "utils/http_client.hpp"
+
+namespace vitaabs {
+
+class HttpCache {
+public:
+    using Fetcher = std::function<HttpResponse(const HttpRequest&)>;
+
+    static HttpCache& getInstance();
+
+    // Answer a cacheable GET, calling fetch for the network round trip
+    HttpResponse request(const HttpRequest& req, const Fetcher& fetch);
+
+    // Drop every entry whose URL contains the fragment (e.g. "/api/me/")
+    void invalidate(const std::string& urlFragment);
+
+    // Drop everything (logout, server change)
+    void clear();
+
+private:
+    HttpCache() = default;
+
+    struct Entry {
+        HttpResponse response;
+        std::string etag;
+        std::chrono::steady_clock::time_point fetchedAt;
+        std::list<std::string>::iterator lruPos;  // Position in m_lru
+    };
+
+    // A fetch other callers of the same key wait for
+    struct InFlight {
+        bool done = false;
+        HttpResponse response;
+    };
+
+    static std::string makeKey(const HttpRequest& req);
+    void touchUnlocked(Entry& entry);
+    void eraseUnlocked(std::unordered_map<std::string, Entry>::iterator it);
+
+    std::unordered_map<std::string, Entry> m_entries;
+    std::list<std::string> m_lru;  // Entry keys, most recently used first
+    std::unordered_map<std::string, std::shared_ptr<InFlight>> m_inFlight;
+    uint64_t m_generation = 0;  // Bumped by invalidation; stale fetches aren't stored
+
+    std::mutex m_mutex;
+    std::condition_variable m_fetchDone;
+};
+
+} // namespace vitaabs
@@ -9,16 +9,30 @@
 #include <map>
 #include <functional>
 #include <cstdint>
+#include <memory>
+#include <atomic>
+#include "utils/network_scheduler.hpp"
 
 namespace vitaabs {
 
+// Shared flag that aborts an in-flight request when set to true
+using HttpCancelToken = std::shared_ptr<std::atomic<bool>>;
+
+// Response body shared by reference count (e.g. between a cache and a UI callback)
+using SharedHttpBody = std::shared_ptr<const std::string>;
+
 // HTTP response
 struct HttpResponse {
     int statusCode = 0;
-    std::string body;
+    std::string body;           // Reserved from Content-Length before the transfer
+
     std::map<std::string, std::string> headers;
     std::string error;
     bool success = false;
+    bool cancelled = false;     // Aborted through HttpRequest::cancelToken
+
+    // Move the body into a shared buffer without copying it
+    SharedHttpBody takeBody() { return std::make_shared<const std::string>(std::move(body)); }
 };
 
 // HTTP request configuration
@@ -29,6 +43,9 @@ struct HttpRequest {
     std::map<std::string, std::string> headers;
     int timeout = 30;
     bool followRedirects = true;
+    HttpCancelToken cancelToken;  // Optional: set to true from any thread to abort
+    int cacheTtl = 0;             // GET only: seconds the response may come from HttpCache
+    NetPriority priority = NetPriority::API;  // Class the transfer is scheduled under
 };
 
 /**
@@ -62,6 +79,8 @@ public:
     void setTimeout(int seconds) { m_timeout = seconds; }
     void setFollowRedirects(bool follow) { m_followRedirects = follow; }
     void setUserAgent(const std::string& ua) { m_userAgent = ua; }
+    // Class downloadFile() transfers are scheduled under
+    void setDownloadPriority(NetPriority priority) { m_downloadPriority = priority; }
 
     // Simple get that returns body directly
     bool get(const std::string& url, std::string& response);
@@ -82,6 +101,7 @@ private:
     int m_timeout = 30;
     bool m_followRedirects = true;
     std::string m_userAgent;
+    NetPriority m_downloadPriority = NetPriority::DOWNLOAD;
     std::map<std::string, std::string> m_defaultHeaders;
 
     static size_t writeCallback(void* contents, size_t size, size_t nmemb, void* userp);
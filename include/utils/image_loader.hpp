@@ -9,6 +9,7 @@
 #include <functional>
 #include <map>
 #include <mutex>
+#include "utils/http_client.hpp"
 
 namespace vitaabs {
 
@@ -33,7 +34,8 @@ public:
     static bool isPaused();
 
 private:
-    static std::map<std::string, std::vector<uint8_t>> s_cache;
+    // Bodies are shared with pending UI callbacks, never copied
+    static std::map<std::string, SharedHttpBody> s_cache;
     static std::mutex s_cacheMutex;
     static bool s_paused;
 };
@@ -0,0 +1,75 @@
+/**
+ * VitaABS - Interned strings
+ * Authors, narrators, series, genres and tags repeat thousands of times
+ * across a library. InternedString stores each distinct value once in a
+ * process-wide pool and is itself just a pointer, so copies don't allocate
+ * and equality is a pointer compare. Pool entries are never freed (the set
+ * of distinct values is small).
+ */
+
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <ostream>
+#include <functional>
+
+namespace vitaabs {
+
+class InternedString {
+public:
+    InternedString() : m_str(&emptyString()) {}
+    InternedString(const std::string& str) : m_str(intern(str)) {}
+    InternedString(const char* str) : m_str(intern(str ? std::string(str) : std::string())) {}
+
+    const std::string& str() const { return *m_str; }
+    std::string_view view() const { return *m_str; }
+    const char* c_str() const { return m_str->c_str(); }
+    operator const std::string&() const { return *m_str; }
+
+    bool empty() const { return m_str->empty(); }
+    size_t size() const { return m_str->size(); }
+    size_t length() const { return m_str->size(); }
+
+    // Same pool entry <=> same string
+    bool operator==(const InternedString& other) const { return m_str == other.m_str; }
+    bool operator!=(const InternedString& other) const { return m_str != other.m_str; }
+    bool operator==(const std::string& other) const { return *m_str == other; }
+    bool operator!=(const std::string& other) const { return *m_str != other; }
+    bool operator==(const char* other) const { return *m_str == other; }
+    bool operator!=(const char* other) const { return *m_str != other; }
+
+    // Number of distinct strings in the pool
+    static size_t poolSize();
+
+private:
+    static const std::string* intern(const std::string& str);
+    static const std::string& emptyString();
+
+    const std::string* m_str;
+
+    friend struct std::hash<InternedString>;
+};
+
+inline bool operator==(const std::string& a, const InternedString& b) { return b == a; }
+inline bool operator!=(const std::string& a, const InternedString& b) { return b != a; }
+
+inline std::string operator+(const std::string& a, const InternedString& b) { return a + b.str(); }
+inline std::string operator+(const InternedString& a, const std::string& b) { return a.str() + b; }
+inline std::string operator+(const char* a, const InternedString& b) { return a + b.str(); }
+inline std::string operator+(const InternedString& a, const char* b) { return a.str() + b; }
+
+inline std::ostream& operator<<(std::ostream& os, const InternedString& str) {
+    return os << str.str();
+}
+
+} // namespace vitaabs
+
+namespace std {
+template <>
+struct hash<vitaabs::InternedString> {
+    size_t operator()(const vitaabs::InternedString& str) const {
+        return std::hash<const std::string*>()(str.m_str);
+    }
+};
+} // namespace std
@@ -0,0 +1,112 @@
+/**
+ * VitaABS - JSON field dispatch
+ * Maps the member names of a JSON object to setters on a parse target.
+ * The table is built at compile time around a perfect hash of its keys, so
+ * parse() fills every known field in a single pass over the object's
+ * members: each member costs one hash and one string compare, and adding a
+ * field adds a table entry rather than another scan of the response.
+ *
+ *   static constexpr JsonField<Chapter> kFields[] = {
+ *       {"title", [](Chapter& ch, std::string_view v) { ch.title = std::string(v); }},
+ *   };
+ *   static constexpr auto kTable = makeJsonFieldTable(kFields);
+ *   kTable.parse(object, chapter);
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include "utils/json_scan.hpp"
+
+namespace vitaabs {
+
+template <typename T>
+struct JsonField {
+    std::string_view key;
+    // Receives the member value as described for nextJsonMember()
+    void (*apply)(T& target, std::string_view value) = nullptr;
+};
+
+// FNV-1a, seeded so the table can search for a collision-free seed
+constexpr uint32_t jsonKeyHash(std::string_view key, uint32_t seed) {
+    uint32_t hash = 2166136261u ^ seed;
+    for (char c : key) {
+        hash = (hash ^ static_cast<uint8_t>(c)) * 16777619u;
+    }
+    return hash;
+}
+
+template <typename T, size_t N>
+class JsonFieldTable {
+public:
+    // At least 4 slots per key keeps the seed search short
+    static constexpr size_t kSlots = [] {
+        size_t slots = 8;
+        while (slots < N * 4) slots *= 2;
+        return slots;
+    }();
+
+    static_assert(N < 255, "JsonFieldTable slot indices are 8-bit");
+
+    constexpr explicit JsonFieldTable(const JsonField<T> (&fields)[N]) {
+        for (size_t i = 0; i < N; i++) {
+            m_fields[i] = fields[i];
+        }
+
+        for (uint32_t seed = 0; seed < 100000; seed++) {
+            if (tryBuild(seed)) {
+                m_seed = seed;
+                return;
+            }
+        }
+        throw "JsonFieldTable: no perfect hash seed (duplicate key?)";
+    }
+
+    // Field for a key, or nullptr if the key isn't in the table
+    const JsonField<T>* find(std::string_view key) const {
+        uint8_t slot = m_slots[jsonKeyHash(key, m_seed) & (kSlots - 1)];
+        if (slot == 0 || m_fields[slot - 1].key != key) return nullptr;
+        return &m_fields[slot - 1];
+    }
+
+    // Apply every member of the object that has a field; returns how many did
+    int parse(std::string_view object, T& target) const {
+        int applied = 0;
+        size_t pos = 0;
+        std::string_view key;
+        std::string_view value;
+        while (nextJsonMember(object, pos, key, value)) {
+            if (const JsonField<T>* field = find(key)) {
+                field->apply(target, value);
+                applied++;
+            }
+        }
+        return applied;
+    }
+
+private:
+    constexpr bool tryBuild(uint32_t seed) {
+        for (size_t i = 0; i < kSlots; i++) {
+            m_slots[i] = 0;
+        }
+        for (size_t i = 0; i < N; i++) {
+            size_t slot = jsonKeyHash(m_fields[i].key, seed) & (kSlots - 1);
+            if (m_slots[slot] != 0) return false;
+            m_slots[slot] = static_cast<uint8_t>(i + 1);
+        }
+        return true;
+    }
+
+    JsonField<T> m_fields[N] = {};
+    uint8_t m_slots[kSlots] = {};  // Index + 1 into m_fields, 0 = empty
+    uint32_t m_seed = 0;
+};
+
+template <typename T, size_t N>
+constexpr JsonFieldTable<T, N> makeJsonFieldTable(const JsonField<T> (&fields)[N]) {
+    return JsonFieldTable<T, N>(fields);
+}
+
+} // namespace vitaabs
@@ -0,0 +1,40 @@
+/**
+ * VitaABS - JSON structural scanning
+ * Finds JSON structural characters (quotes, backslashes, braces, brackets)
+ * 16 or 32 bytes at a time: NEON on Vita/Switch, SSE2/AVX2 on desktop,
+ * byte-by-byte elsewhere. The response parser uses these to skip over long
+ * string values (episode descriptions) and find where objects end.
+ */
+
+#pragma once
+
+#include <string_view>
+#include <cstdint>
+
+namespace vitaabs {
+
+// Offset of the next '"', '\\', '{', '}', '[' or ']' at or after from, or npos
+size_t findJsonStructural(std::string_view json, size_t from);
+
+// Offset of the quote closing the string that opens at quotePos (escapes
+// are skipped), or json.size() if it is unterminated
+size_t findJsonStringEnd(std::string_view json, size_t quotePos);
+
+// Offset one past the bracket closing the '{' or '[' at openPos, or
+// json.size() if it is unterminated. Brackets inside strings are ignored.
+size_t findJsonContainerEnd(std::string_view json, size_t openPos);
+
+// Step through the top-level members of an object. Start with pos = 0.
+// key is unquoted; value is the contents of a string, the literal of a
+// number/bool (empty for null) or the full text of an object/array.
+// Returns false once the object is exhausted.
+bool nextJsonMember(std::string_view object, size_t& pos,
+                    std::string_view& key, std::string_view& value);
+
+// Scalar conversions of member values (0 / false when empty or invalid)
+int parseJsonInt(std::string_view value);
+int64_t parseJsonInt64(std::string_view value);
+float parseJsonFloat(std::string_view value);
+bool parseJsonBool(std::string_view value);
+
+} // namespace vitaabs
@@ -0,0 +1,70 @@
+/**
+ * VitaABS - Network scheduler
+ * Keeps background transfers from starving playback. Every HttpClient
+ * transfer belongs to a priority class and passes its received bytes
+ * through that class's token bucket. Normally no class is limited; while
+ * the player reports it is stalled, or its cache filled once and is now
+ * draining low, the classes below streaming are rate limited (downloads
+ * hardest) until the cache has recovered.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <chrono>
+
+namespace vitaabs {
+
+// Highest priority first
+enum class NetPriority {
+    STREAMING = 0,  // Audio feeding the player - never throttled
+    API,            // Server API calls the UI is waiting on
+    COVER,          // Cover art
+    DOWNLOAD,       // Offline downloads
+    COUNT
+};
+
+class NetworkScheduler {
+public:
+    static NetworkScheduler& getInstance();
+
+    // Account for bytes a transfer just received, sleeping while its class
+    // is over budget. Returns early once cancel is set.
+    void throttle(NetPriority priority, size_t bytes, const std::atomic<bool>* cancel = nullptr);
+
+    // Player feedback: stalled waiting for data, and seconds of audio
+    // buffered ahead. Negative means the cache says nothing about the
+    // network right now (seeking); it must fill again before it counts.
+    void reportStreamCache(bool pausedForCache, double cacheSeconds);
+
+    // Playback stopped - lift any limits
+    void streamEnded();
+
+    bool isConstrained();
+
+private:
+    NetworkScheduler() = default;
+
+    struct TokenBucket {
+        int64_t rate = 0;       // Bytes per second, 0 = unlimited
+        double tokens = 0.0;
+        std::chrono::steady_clock::time_point refilled;
+    };
+
+    void setConstrainedUnlocked(bool constrained);
+    static void refill(TokenBucket& bucket, std::chrono::steady_clock::time_point now);
+
+    TokenBucket m_buckets[static_cast<int>(NetPriority::COUNT)];
+    bool m_constrained = false;
+    bool m_cacheFilled = false;         // Cache reached the restore level since the last seek/load
+    double m_lastCacheSeconds = -1.0;   // Previous report, to tell draining from filling
+
+    std::mutex m_mutex;
+    std::condition_variable m_limitsChanged;
+};
+
+} // namespace vitaabs
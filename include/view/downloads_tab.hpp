@@ -1,6 +1,9 @@
 /**
  * VitaABS - Downloads Tab
  * View for managing local (Vita) and server (ABS) downloads
+ *
+ * Both sections share one recycler list: only the rows on screen exist as
+ * views, and scrolled-off rows are re-bound to the entries scrolling in.
  */
 
 #pragma once
@@ -8,10 +11,10 @@
 #include <borealis.hpp>
 #include <vector>
 #include <string>
-#include <atomic>
-#include <chrono>
 #include <memory>
 #include <cstdint>
+#include "app/downloads_manager.hpp"
+#include "app/audiobookshelf_client.hpp"
 
 namespace vitaabs {
 
@@ -24,24 +27,49 @@ public:
     void willDisappear(bool resetState) override;
 
 private:
+    class ListSource;
+    class HeaderCell;
+    class LocalRowCell;
+    class ServerRowCell;
+
     void refresh();
     void refreshServerQueue();
     void refreshServerDownloads();
-    void startAutoRefresh();
-    void stopAutoRefresh();
-
-    // Local downloads section (items downloading from ABS server to Vita)
-    brls::Box* m_serverSection = nullptr;
-    brls::Label* m_serverHeader = nullptr;
-    brls::ScrollingFrame* m_serverScroll = nullptr;
-    brls::Box* m_serverContainer = nullptr;
-    brls::Label* m_serverEmptyLabel = nullptr;
-
-    // Server downloads section (ABS server downloading podcast episodes)
-    brls::Box* m_absSection = nullptr;
-    brls::Label* m_absHeader = nullptr;
-    brls::Box* m_absContainer = nullptr;
-    brls::Label* m_absEmptyLabel = nullptr;
+    void onDownloadEvents(const std::vector<DownloadEvent>& events);
+
+    // Rebuild the row list from both sections and reload the recycler
+    void reloadList();
+    // Re-bind the rows currently on screen (same structure, new data), or
+    // only the one showing m_localRows[localIndex]
+    void rebindVisibleRows(int localIndex = -1);
+
+    // Download on this Vita that isn't finished yet
+    struct LocalRow {
+        std::string itemId;
+        std::string episodeId;
+        std::string title;
+        std::string authorName;
+        std::string coverUrl;
+        std::string localCoverPath;
+        int64_t downloadedBytes = 0;
+        int64_t totalBytes = 0;
+        DownloadState state = DownloadState::QUEUED;
+        int queueRank = -1;
+    };
+
+    // One line of the recycler list
+    struct ListRow {
+        enum class Kind { HEADER, LOCAL, SERVER };
+        Kind kind = Kind::HEADER;
+        size_t index = 0;       // Into m_localRows / m_serverRows
+        std::string title;      // Header text
+    };
+
+    std::vector<LocalRow> m_localRows;              // Local downloads section
+    std::vector<ServerEpisodeDownload> m_serverRows; // ABS server downloading podcast episodes
+    std::vector<ListRow> m_rows;
+
+    brls::RecyclerFrame* m_list = nullptr;
 
     // Empty state (shown when both sections are empty)
     brls::Box* m_emptyStateBox = nullptr;
@@ -58,43 +86,12 @@ private:
     brls::Label* m_downloadStatusLabel = nullptr;
     bool m_downloaderRunning = false;
 
-    // Auto-refresh state
-    std::atomic<bool> m_autoRefreshEnabled{false};
-    std::atomic<bool> m_autoRefreshTimerActive{false};
+    // Download events subscription (0 = not subscribed)
+    int m_eventSubscription = 0;
 
-    // Throttle progress updates
-    std::chrono::steady_clock::time_point m_lastProgressRefresh;
-
-    // Track currently focused X button icon (for show/hide on focus change)
-    brls::Image* m_currentFocusedIcon = nullptr;
-
-    // Cached state for smart incremental updates
-    struct CachedServerItem {
-        std::string itemId;
-        std::string episodeId;
-        int64_t downloadedBytes = 0;
-        int64_t totalBytes = 0;
-        int state = 0;
-    };
-    std::vector<CachedServerItem> m_lastServerItems;
-
-    // UI element tracking for incremental updates
-    struct ServerRowElements {
-        brls::Box* row = nullptr;
-        brls::Label* progressLabel = nullptr;
-        brls::Image* xButtonIcon = nullptr;
-        std::string itemId;
-        std::string episodeId;
-    };
-    std::vector<ServerRowElements> m_serverRowElements;
-
-    // Helper methods
-    brls::Box* createServerRow(const std::string& itemId, const std::string& episodeId,
-                               const std::string& title, const std::string& authorName,
-                               int64_t downloadedBytes, int64_t totalBytes, int state,
-                               const std::string& coverUrl, const std::string& localCoverPath,
-                               brls::Label*& outProgressLabel, brls::Image*& outXButtonIcon);
-    void updateNavigationRoutes();
+    // Snapshot the rows were last built from (unchanged version = skip refresh)
+    DownloadsSnapshotRef m_shownSnapshot;
+    bool m_shownDownloading = false;
 
     // Async lifetime guard
     std::shared_ptr<bool> m_alive;
@@ -8,6 +8,7 @@
 #include <borealis.hpp>
 #include <memory>
 #include "app/audiobookshelf_client.hpp"
+#include "app/item_store.hpp"
 
 namespace vitaabs {
 
@@ -23,8 +24,10 @@ public:
 
 private:
     void loadContent();
-    void populateHorizontalRow(brls::Box* container, const std::vector<MediaItem>& items);
-    void onItemSelected(const MediaItem& item);
+    void displayContent(const std::vector<ItemRef>& continueItems,
+                        const std::vector<ItemRef>& recentEpisodes);
+    void populateHorizontalRow(brls::Box* container, const std::vector<ItemRef>& items);
+    void onItemSelected(const MediaItemSummary& item);
 
     // Check if this tab is still valid (not destroyed)
     bool isValid() const { return m_alive && *m_alive; }
@@ -37,15 +40,16 @@ private:
     brls::Label* m_continueLabel = nullptr;
     brls::HScrollingFrame* m_continueScroll = nullptr;
     brls::Box* m_continueBox = nullptr;
-    std::vector<MediaItem> m_continueItems;
+    std::vector<ItemRef> m_continueItems;
 
     // Recently Added Episodes section (horizontal row)
     brls::Label* m_recentEpisodesLabel = nullptr;
     brls::HScrollingFrame* m_recentEpisodesScroll = nullptr;
     brls::Box* m_recentEpisodesBox = nullptr;
-    std::vector<MediaItem> m_recentEpisodes;
+    std::vector<ItemRef> m_recentEpisodes;
 
     bool m_loaded = false;
+    bool m_snapshotShown = false;  // Persisted shelves rendered before first fetch
 
     // Shared pointer to track if this object is still alive
     std::shared_ptr<bool> m_alive;
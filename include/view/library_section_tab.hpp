@@ -9,6 +9,7 @@
 #include <borealis.hpp>
 #include <memory>
 #include "app/audiobookshelf_client.hpp"
+#include "app/item_store.hpp"
 #include "view/recycling_grid.hpp"
 
 namespace vitaabs {
@@ -35,8 +36,8 @@ private:
     void showAllItems();
     void showCollections();
     void showCategories();
-    void onItemSelected(const MediaItem& item);
-    void onCollectionSelected(const MediaItem& collection);
+    void onItemSelected(const MediaItemSummary& item);
+    void onCollectionSelected(const MediaItemSummary& collection);
     void onGenreSelected(const GenreItem& genre);
     void updateViewModeButtons();
     void hideNavigationButtons();  // Hide all nav buttons for offline mode
@@ -71,13 +72,14 @@ private:
     RecyclingGrid* m_contentGrid = nullptr;
 
     // Data
-    std::vector<MediaItem> m_items;
-    std::vector<MediaItem> m_collections;
+    std::vector<ItemRef> m_items;
+    std::vector<MediaItemSummary> m_collections;
     std::vector<GenreItem> m_genres;
 
     LibraryViewMode m_viewMode = LibraryViewMode::ALL_ITEMS;
     std::string m_filterTitle;  // Title of current filter (collection/genre name)
     bool m_loaded = false;
+    bool m_snapshotShown = false;  // Persisted first page rendered before first fetch
     bool m_collectionsLoaded = false;
     bool m_genresLoaded = false;
 
@@ -1,13 +1,20 @@
 /**
  * VitaABS - Media Detail View
  * Shows detailed information about a media item
+ *
+ * Podcast episodes and book chapters are recycler lists: only the rows on
+ * screen exist as views. Filters and sort order only rebuild the index list
+ * the episode rows are bound through. Episodes load in the background and
+ * are appended page by page, so the first rows show before the rest parse.
  */
 
 #pragma once
 
 #include <borealis.hpp>
 #include "app/audiobookshelf_client.hpp"
+#include "app/download_store.hpp"
 #include <memory>
+#include <unordered_map>
 #include <atomic>
 #include <chrono>
 
@@ -16,6 +23,7 @@ namespace vitaabs {
 class MediaDetailView : public brls::Box {
 public:
     MediaDetailView(const MediaItem& item);
+    ~MediaDetailView() override;
 
     static brls::View* create();
 
@@ -23,7 +31,13 @@ public:
     void willDisappear(bool resetState) override;
 
 private:
+    class EpisodeCell;
+    class ChapterCell;
+    class EpisodeSource;
+    class ChapterSource;
+
     void loadDetails();
+    void updatePlayButton();
     void loadChildren();
     void loadMusicCategories();
     void loadLocalCover(const std::string& localPath);
@@ -57,15 +71,31 @@ private:
 
     // Filter and sort
     void showFilterMenu();
+    // Filters or sort order changed: rebuild and show the list from the top
     void applyFilters();
+    // Episodes or their download states changed: keep the scroll position
+    void refreshEpisodes();
+    void rebuildEpisodeOrder();
+    // Background episode loading (see loadChildren)
+    void appendEpisodes(std::vector<MediaItem>& page);
+    void onEpisodesLoaded(bool loadedFromServer);
+
+    // Episode row actions (index into m_children)
+    void playEpisode(size_t index);
+    void toggleEpisodeDownload(size_t index);
+    // State of an episode's local download, or nullptr if it has none
+    const DownloadState* episodeDownload(const MediaItem& episode) const;
 
     brls::HScrollingFrame* createMediaRow(const std::string& title, brls::Box** contentOut);
 
     MediaItem m_item;
     std::vector<MediaItem> m_children;
+    int m_itemSubscription = 0;  // ItemStore progress updates for m_item
 
-    // Layout
-    brls::ScrollingFrame* m_scrollView = nullptr;  // Scrolls the list (chapters or episodes)
+    // Filtered, sorted view of m_children and the download state of the rows
+    std::vector<size_t> m_episodeOrder;  // Indices into m_children
+    std::unordered_map<std::string, DownloadState> m_episodeDownloads;  // By episode id
+    bool m_episodesLoading = false;  // m_children is still being filled
 
     brls::Label* m_titleLabel = nullptr;
     brls::Label* m_yearLabel = nullptr;
@@ -78,8 +108,9 @@ private:
     brls::Button* m_downloadButton = nullptr;
     brls::Button* m_deleteButton = nullptr;
     brls::Button* m_findEpisodesButton = nullptr;
-    brls::Box* m_childrenBox = nullptr;       // Podcast episode rows
-    brls::Box* m_chaptersBox = nullptr;       // Audiobook chapter rows
+    brls::RecyclerFrame* m_episodeList = nullptr;  // Podcast episode rows
+    brls::RecyclerFrame* m_chapterList = nullptr;  // Audiobook chapter rows
+    brls::Label* m_noChaptersLabel = nullptr;
     brls::Box* m_genreBox = nullptr;          // Genre tags row
 
     // Description expand/collapse
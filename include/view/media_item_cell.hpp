@@ -8,6 +8,7 @@
 #include <borealis.hpp>
 #include <memory>
 #include "app/audiobookshelf_client.hpp"
+#include "app/item_store.hpp"
 
 namespace vitaabs {
 
@@ -16,8 +17,11 @@ public:
     MediaItemCell();
     ~MediaItemCell();
 
-    void setItem(const MediaItem& item);
-    const MediaItem& getItem() const { return m_item; }
+    // Bind to a shared entity; the cell re-binds itself when the item changes
+    void setItem(const ItemRef& item);
+    void setItem(const MediaItemSummary& item);
+    const MediaItemSummary& getItem() const { return *m_item; }
+    const ItemRef& getItemRef() const { return m_item; }
 
     void onFocusGained() override;
     void onFocusLost() override;
@@ -25,10 +29,12 @@ public:
     static brls::View* create();
 
 private:
+    void bind(const ItemRef& item);
     void loadThumbnail();
     void updateFocusInfo(bool focused);
 
-    MediaItem m_item;
+    ItemRef m_item = std::make_shared<const MediaItemSummary>();
+    int m_subscription = 0;  // ItemStore subscription for m_item (0 = none)
     std::string m_originalTitle;
     std::shared_ptr<bool> m_alive = std::make_shared<bool>(true);
 
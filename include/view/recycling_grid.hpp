@@ -7,16 +7,25 @@
 
 #include <borealis.hpp>
 #include "app/audiobookshelf_client.hpp"
+#include "app/item_store.hpp"
 #include <functional>
 
 namespace vitaabs {
 
+class MediaItemCell;
+
 class RecyclingGrid : public brls::ScrollingFrame {
 public:
     RecyclingGrid();
 
+    void setDataSource(const std::vector<ItemRef>& items);
+    void setDataSource(const std::vector<MediaItemSummary>& items);  // Stored as fresh data
     void setDataSource(const std::vector<MediaItem>& items);
-    void setOnItemSelected(std::function<void(const MediaItem&)> callback);
+
+    // Like setDataSource, but when the item ids are unchanged only the cells
+    // whose entity differs are re-bound (used after background revalidation)
+    void updateDataSource(const std::vector<ItemRef>& items);
+    void setOnItemSelected(std::function<void(const MediaItemSummary&)> callback);
 
     static brls::View* create();
 
@@ -24,8 +33,9 @@ private:
     void rebuildGrid();
     void onItemClicked(int index);
 
-    std::vector<MediaItem> m_items;
-    std::function<void(const MediaItem&)> m_onItemSelected;
+    std::vector<ItemRef> m_items;
+    std::vector<MediaItemCell*> m_cells;  // Cells in item order (owned by the row boxes)
+    std::function<void(const MediaItemSummary&)> m_onItemSelected;
 
     brls::Box* m_contentBox = nullptr;
     int m_columns = 4;
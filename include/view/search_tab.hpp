@@ -6,7 +6,10 @@
 #pragma once
 
 #include <borealis.hpp>
+#include <memory>
+#include <unordered_set>
 #include "app/audiobookshelf_client.hpp"
+#include "app/item_store.hpp"
 #include "view/recycling_grid.hpp"
 
 namespace vitaabs {
@@ -14,13 +17,20 @@ namespace vitaabs {
 class SearchTab : public brls::Box {
 public:
     SearchTab();
+    ~SearchTab() override;
 
     void onFocusGained() override;
 
 private:
     void performSearch(const std::string& query);
-    void onItemSelected(const MediaItem& item);
-    void populateRow(brls::Box* rowContent, const std::vector<MediaItem>& items);
+    void searchLibraries(const std::vector<Library>& libraries, const std::string& query,
+                         uint64_t generation, HttpCancelToken cancelToken);
+    void onLibraryResults(uint64_t generation, std::vector<MediaItemSummary> results);
+    void cancelPendingSearch();
+    void clearResults();
+    void showResults();
+    void onItemSelected(const MediaItemSummary& item);
+    void populateRow(brls::Box* rowContent, const std::vector<ItemRef>& items);
 
     brls::Label* m_titleLabel = nullptr;
     brls::Label* m_searchLabel = nullptr;
@@ -41,11 +51,21 @@ private:
     brls::Box* m_musicContent = nullptr;
 
     std::string m_searchQuery;
-    std::vector<MediaItem> m_results;
-    std::vector<MediaItem> m_movies;
-    std::vector<MediaItem> m_shows;
-    std::vector<MediaItem> m_episodes;
-    std::vector<MediaItem> m_music;
+    std::vector<ItemRef> m_results;
+    std::unordered_set<std::string> m_resultKeys;  // De-duplicates local and server results
+    std::vector<ItemRef> m_movies;
+    std::vector<ItemRef> m_shows;
+    std::vector<ItemRef> m_episodes;
+    std::vector<ItemRef> m_music;
+
+    // Background search state (UI thread only)
+    std::vector<Library> m_libraries;     // Cached library list, fetched on first search
+    HttpCancelToken m_searchCancel;       // Aborts in-flight requests of the current query
+    uint64_t m_searchGeneration = 0;      // Bumped per query; stale results are dropped
+    int m_pendingLibraries = 0;           // Libraries still searching for the current query
+
+    // Shared pointer to track if this object is still alive
+    std::shared_ptr<bool> m_alive;
 };
 
 } // namespace vitaabs
@@ -6,6 +6,7 @@
 #include "app/audiobookshelf_client.hpp"
 #include "app/application.hpp"
 #include "app/downloads_manager.hpp"
+#include "app/item_store.hpp"
 #include "player/mpv_player.hpp"
 #include "utils/image_loader.hpp"
 #include "view/progress_dialog.hpp"
@@ -221,6 +222,10 @@ void PlayerActivity::willDisappear(bool resetState) {
             float currentTime = (float)position;
             float totalDuration = (float)player.getDuration();
 
+            // Patch every cell showing this item with the final position
+            ItemStore::getInstance().updateProgress(m_itemId, m_episodeId, currentTime, totalDuration,
+                shouldMarkAsFinished(currentTime, totalDuration, !m_episodeId.empty()));
+
             if (m_isLocalFile) {
                 // Save progress for downloaded media (in seconds)
                 DownloadsManager::getInstance().updateProgress(m_itemId, currentTime, m_episodeId);
@@ -284,8 +289,9 @@ void PlayerActivity::loadMedia() {
         std::string offlineTitle, offlineAuthor, offlineCoverPath, offlineCoverUrl;
         bool foundInDownloads = false;
 
-        auto allDownloads = downloads.getDownloads();
-        for (const auto& dl : allDownloads) {
+        DownloadsSnapshotRef snapshot = downloads.getSnapshot();
+        for (const auto& entry : snapshot->items) {
+            const DownloadItem& dl = *entry;
             if (dl.itemId == m_itemId && dl.state == DownloadState::COMPLETED) {
                 // For episodes, also match episodeId
                 if (m_episodeId.empty() || dl.episodeId == m_episodeId) {
@@ -430,8 +436,10 @@ void PlayerActivity::loadMedia() {
             downloads.fetchProgressFromServer(m_itemId, m_episodeId);
         }
 
-        // Get download item (using episodeId for podcast episodes)
-        DownloadItem* download = downloads.getDownload(m_itemId, m_episodeId);
+        // Get download item (using episodeId for podcast episodes) - the
+        // snapshot keeps it alive while the download thread carries on
+        DownloadsSnapshotRef snapshot = downloads.getSnapshot();
+        const DownloadItem* download = snapshot->find(m_itemId, m_episodeId);
 
         if (!download || download->state != DownloadState::COMPLETED) {
             brls::Logger::error("PlayerActivity: Downloaded media not found or incomplete");
@@ -522,12 +530,15 @@ void PlayerActivity::loadMedia() {
             }
 
             // Find the download info (after potential server update)
-            auto allDownloads = downloadsMgr.getDownloads();
-            for (const auto& dl : allDownloads) {
+            DownloadsSnapshotRef snapshot = downloadsMgr.getSnapshot();
+            for (const auto& entry : snapshot->items) {
+                const DownloadItem& dl = *entry;
                 if (dl.itemId == m_itemId && dl.state == DownloadState::COMPLETED) {
                     if (m_episodeId.empty() || dl.episodeId == m_episodeId) {
                         // Found the matching download - use local playback
-                        std::string playbackPath = dl.localPath;
+                        // Multi-file books play as one timeline over their files
+                        std::string playbackPath = dl.numFiles > 1 ? downloadsMgr.getPlaybackPath(dl.itemId)
+                                                                   : dl.localPath;
 
                         // Set metadata
                         if (titleLabel && !dl.title.empty()) {
@@ -774,6 +785,8 @@ void PlayerActivity::updateProgress() {
             float currentPos = static_cast<float>(position);
             // Only sync/save if position changed significantly (more than 5 seconds)
             if (std::abs(currentPos - m_lastSyncedTime) > 5.0f) {
+                ItemStore::getInstance().updateProgress(m_itemId, m_episodeId, currentPos,
+                                                        static_cast<float>(duration), false);
                 if (m_isLocalFile) {
                     // Save progress for downloaded media locally
                     DownloadsManager::getInstance().updateProgress(m_itemId, currentPos, m_episodeId);
@@ -837,6 +850,7 @@ void PlayerActivity::updateProgress() {
 
         // Mark as finished with Audiobookshelf (set isFinished=true)
         AudiobookshelfClient::getInstance().updateProgress(m_itemId, totalDuration, totalDuration, true, m_episodeId);
+        ItemStore::getInstance().updateProgress(m_itemId, m_episodeId, totalDuration, totalDuration, true);
         brls::Application::popActivity();
     }
 }
@@ -363,6 +363,7 @@ bool Application::loadSettings() {
     m_settings.autoStartDownloads = extractBool("autoStartDownloads", true);
     m_settings.deleteAfterFinish = extractBool("deleteAfterFinish", false);
     m_settings.downloadOnPlay = extractBool("downloadOnPlay", false);
+    m_settings.downloadRoundRobin = extractBool("downloadRoundRobin", false);
 
     // Load player UI settings
     m_settings.showDownloadProgress = extractBool("showDownloadProgress", true);
@@ -437,6 +438,7 @@ bool Application::saveSettings() {
     json += "  \"autoStartDownloads\": " + std::string(m_settings.autoStartDownloads ? "true" : "false") + ",\n";
     json += "  \"deleteAfterFinish\": " + std::string(m_settings.deleteAfterFinish ? "true" : "false") + ",\n";
     json += "  \"downloadOnPlay\": " + std::string(m_settings.downloadOnPlay ? "true" : "false") + ",\n";
+    json += "  \"downloadRoundRobin\": " + std::string(m_settings.downloadRoundRobin ? "true" : "false") + ",\n";
 
     // Player UI settings
     json += "  \"showDownloadProgress\": " + std::string(m_settings.showDownloadProgress ? "true" : "false") + ",\n";
@@ -5,14 +5,35 @@
 #include "app/audiobookshelf_client.hpp"
 #include "app/application.hpp"
 #include "utils/http_client.hpp"
+#include "utils/http_cache.hpp"
+#include "utils/alloc_stats.hpp"
+#include "utils/json_fields.hpp"
 
 #include <borealis.hpp>
 #include <cstring>
+#include <cstdlib>
 #include <ctime>
 #include <algorithm>
 
 namespace vitaabs {
 
+// Seconds a GET may be answered from HttpCache. Mutations below invalidate
+// the entries they change, so these only bound staleness from other clients.
+static const int CACHE_TTL_LIBRARIES = 300;  // Library list and library info
+static const int CACHE_TTL_BROWSE = 120;     // Series, collections, authors
+static const int CACHE_TTL_SHELVES = 30;     // Home shelves, library pages, in progress
+
+// Item ids per /api/items/batch/get request; keeps request and response bodies bounded
+static const size_t BATCH_GET_CHUNK_SIZE = 50;
+
+// Drop cached responses that embed listening progress
+static void invalidateProgressCaches() {
+    HttpCache& cache = HttpCache::getInstance();
+    cache.invalidate("/api/me/");
+    cache.invalidate("/personalized");
+    cache.invalidate("/items?");
+}
+
 AudiobookshelfClient& AudiobookshelfClient::getInstance() {
     static AudiobookshelfClient instance;
     return instance;
@@ -38,448 +59,612 @@ MediaType AudiobookshelfClient::parseMediaType(const std::string& typeStr) {
     return MediaType::UNKNOWN;
 }
 
+// Find "key" (with its quotes) at or after from, without building a search string
+static size_t findJsonKey(std::string_view json, std::string_view key, size_t from = 0) {
+    while ((from = json.find(key, from)) != std::string_view::npos) {
+        if (from > 0 && json[from - 1] == '"' && from + key.size() < json.size() &&
+            json[from + key.size()] == '"') {
+            return from - 1;
+        }
+        from += key.size();
+    }
+    return std::string_view::npos;
+}
+
+// Value starting at valueStart: string contents, or the raw literal for numbers/bools
+static std::string_view scalarAt(std::string_view json, size_t valueStart) {
+    if (valueStart == std::string_view::npos) return {};
+
+    if (json[valueStart] == '"') {
+        size_t valueEnd = findJsonStringEnd(json, valueStart);
+        return json.substr(valueStart + 1, valueEnd - valueStart - 1);
+    } else if (json.compare(valueStart, 4, "null") == 0) {
+        return {};
+    } else {
+        size_t valueEnd = json.find_first_of(",}]", valueStart);
+        if (valueEnd == std::string_view::npos) return {};
+        std::string_view value = json.substr(valueStart, valueEnd - valueStart);
+        while (!value.empty() && (value.back() == ' ' || value.back() == '\n' || value.back() == '\r')) {
+            value.remove_suffix(1);
+        }
+        return value;
+    }
+}
+
+static std::string_view findJsonValue(std::string_view json, std::string_view key) {
+    size_t keyPos = findJsonKey(json, key);
+    if (keyPos == std::string_view::npos) return {};
+
+    size_t colonPos = json.find(':', keyPos);
+    if (colonPos == std::string_view::npos) return {};
+
+    return scalarAt(json, json.find_first_not_of(" \t\n\r", colonPos + 1));
+}
+
 // Extract a JSON value only from the top level of an object (depth 1), ignoring nested matches
-static std::string extractTopLevelValue(const std::string& json, const std::string& key) {
-    std::string searchKey = "\"" + key + "\"";
+static std::string_view findTopLevelValue(std::string_view json, std::string_view key) {
     int depth = 0;
-    for (size_t i = 0; i < json.size(); i++) {
+    size_t i = 0;
+    while ((i = findJsonStructural(json, i)) != std::string_view::npos) {
         char c = json[i];
         if (c == '{' || c == '[') {
             depth++;
         } else if (c == '}' || c == ']') {
             depth--;
-        } else if (c == '"' && depth == 1) {
+        } else if (c == '"') {
             // At top level of object, check if this key matches
-            if (json.compare(i, searchKey.size(), searchKey) == 0) {
-                size_t colonPos = json.find(':', i + searchKey.size());
-                if (colonPos == std::string::npos) return "";
-                size_t valStart = json.find_first_not_of(" \t\n\r", colonPos + 1);
-                if (valStart == std::string::npos) return "";
-                if (json[valStart] == '"') {
-                    size_t valEnd = valStart + 1;
-                    while (valEnd < json.size()) {
-                        if (json[valEnd] == '"' && json[valEnd - 1] != '\\') break;
-                        valEnd++;
-                    }
-                    return json.substr(valStart + 1, valEnd - valStart - 1);
-                } else if (json[valStart] == 'n' && json.substr(valStart, 4) == "null") {
-                    return "";
-                } else {
-                    size_t valEnd = json.find_first_of(",}]", valStart);
-                    if (valEnd == std::string::npos) return "";
-                    std::string val = json.substr(valStart, valEnd - valStart);
-                    while (!val.empty() && (val.back() == ' ' || val.back() == '\n' || val.back() == '\r'))
-                        val.pop_back();
-                    return val;
-                }
-            }
-            // Skip past this string value to avoid false depth tracking
-            size_t strEnd = json.find('"', i + 1);
-            if (strEnd != std::string::npos) {
-                // Handle escaped quotes
-                while (strEnd < json.size() && json[strEnd - 1] == '\\') {
-                    strEnd = json.find('"', strEnd + 1);
-                }
-                if (strEnd != std::string::npos) i = strEnd;
+            if (depth == 1 && json.compare(i + 1, key.size(), key) == 0 &&
+                i + 1 + key.size() < json.size() && json[i + 1 + key.size()] == '"') {
+                size_t colonPos = json.find(':', i + key.size() + 2);
+                if (colonPos == std::string_view::npos) return {};
+                return scalarAt(json, json.find_first_not_of(" \t\n\r", colonPos + 1));
             }
+            // Skip past this string so its contents don't affect depth tracking
+            i = findJsonStringEnd(json, i);
         }
+        i++;
     }
-    return "";
+    return {};
 }
 
-// JSON parsing helpers
-std::string AudiobookshelfClient::extractJsonValue(const std::string& json, const std::string& key) {
-    std::string searchKey = "\"" + key + "\"";
-    size_t keyPos = json.find(searchKey);
-    if (keyPos == std::string::npos) return "";
+static std::string extractTopLevelValue(std::string_view json, std::string_view key) {
+    return std::string(findTopLevelValue(json, key));
+}
 
-    size_t colonPos = json.find(':', keyPos);
-    if (colonPos == std::string::npos) return "";
+// Bracketed value ('[' or '{') right after "key":, including the brackets
+static std::string_view findJsonContainer(std::string_view json, std::string_view key, char open, char close) {
+    size_t keyPos = findJsonKey(json, key);
+    if (keyPos == std::string_view::npos) return {};
 
-    size_t valueStart = json.find_first_not_of(" \t\n\r", colonPos + 1);
-    if (valueStart == std::string::npos) return "";
+    size_t colonPos = json.find(':', keyPos + key.size() + 2);
+    if (colonPos == std::string_view::npos) return {};
 
-    if (json[valueStart] == '"') {
-        size_t valueEnd = valueStart + 1;
-        while (valueEnd < json.length()) {
-            if (json[valueEnd] == '"' && json[valueEnd - 1] != '\\') {
-                break;
-            }
-            valueEnd++;
-        }
-        if (valueEnd == std::string::npos) return "";
-        return json.substr(valueStart + 1, valueEnd - valueStart - 1);
-    } else if (json[valueStart] == 'n' && json.substr(valueStart, 4) == "null") {
-        return "";
-    } else {
-        size_t valueEnd = json.find_first_of(",}]", valueStart);
-        if (valueEnd == std::string::npos) return "";
-        std::string value = json.substr(valueStart, valueEnd - valueStart);
-        while (!value.empty() && (value.back() == ' ' || value.back() == '\n' || value.back() == '\r')) {
-            value.pop_back();
-        }
-        return value;
+    // Only whitespace may sit between the colon and the bracket
+    // (prevents matching a container that belongs to another field)
+    size_t start = json.find_first_not_of(" \t\n\r", colonPos + 1);
+    if (start == std::string_view::npos || json[start] != open) return {};
+
+    return json.substr(start, findJsonContainerEnd(json, start) - start);
+}
+
+// Longest description prefix kept in a MediaItemSummary
+static const size_t SUMMARY_BLURB_LENGTH = 64;
+
+static std::string makeBlurb(std::string_view description) {
+    if (description.size() <= SUMMARY_BLURB_LENGTH) {
+        return std::string(description);
     }
+    // Back up to a UTF-8 character boundary
+    size_t end = SUMMARY_BLURB_LENGTH;
+    while (end > 0 && (static_cast<unsigned char>(description[end]) & 0xC0) == 0x80) {
+        end--;
+    }
+    return std::string(description.substr(0, end));
 }
 
-int AudiobookshelfClient::extractJsonInt(const std::string& json, const std::string& key) {
-    std::string value = extractJsonValue(json, key);
-    if (value.empty()) return 0;
-    return atoi(value.c_str());
+MediaItemSummary MediaItemSummary::fromItem(const MediaItem& item) {
+    MediaItemSummary summary;
+    summary.id = item.id;
+    summary.libraryId = item.libraryId;
+    summary.episodeId = item.episodeId;
+    summary.podcastId = item.podcastId;
+    summary.title = item.title;
+    summary.authorName = item.authorName;
+    summary.coverPath = item.coverPath;
+    summary.type = item.type;
+    summary.blurb = makeBlurb(item.description);
+    summary.mediaType = item.mediaType;
+    summary.duration = item.duration;
+    summary.currentTime = item.currentTime;
+    summary.progress = item.progress;
+    summary.episodeNumber = item.episodeNumber;
+    summary.isFinished = item.isFinished;
+    summary.isDownloaded = item.isDownloaded;
+    return summary;
 }
 
-float AudiobookshelfClient::extractJsonFloat(const std::string& json, const std::string& key) {
-    std::string value = extractJsonValue(json, key);
-    if (value.empty()) return 0.0f;
-    return (float)atof(value.c_str());
+std::vector<MediaItemSummary> MediaItemSummary::fromItems(const std::vector<MediaItem>& items) {
+    std::vector<MediaItemSummary> summaries;
+    summaries.reserve(items.size());
+    for (const auto& item : items) {
+        summaries.push_back(fromItem(item));
+    }
+    return summaries;
 }
 
-bool AudiobookshelfClient::extractJsonBool(const std::string& json, const std::string& key) {
-    std::string value = extractJsonValue(json, key);
-    return (value == "true" || value == "1");
+MediaItem MediaItemSummary::toItem() const {
+    MediaItem item;
+    item.id = id;
+    item.libraryId = libraryId;
+    item.episodeId = episodeId;
+    item.podcastId = podcastId;
+    item.title = title;
+    item.authorName = authorName;
+    item.coverPath = coverPath;
+    item.type = type;
+    item.description = blurb;
+    item.mediaType = mediaType;
+    item.duration = duration;
+    item.currentTime = currentTime;
+    item.progress = progress;
+    item.episodeNumber = episodeNumber;
+    item.isFinished = isFinished;
+    item.isDownloaded = isDownloaded;
+    return item;
 }
 
-int64_t AudiobookshelfClient::extractJsonInt64(const std::string& json, const std::string& key) {
-    std::string value = extractJsonValue(json, key);
-    if (value.empty()) return 0;
-    return std::stoll(value);
+// JSON parsing helpers
+std::string AudiobookshelfClient::extractJsonValue(std::string_view json, std::string_view key) {
+    return std::string(findJsonValue(json, key));
 }
 
-std::string AudiobookshelfClient::extractJsonArray(const std::string& json, const std::string& key) {
-    std::string searchKey = "\"" + key + "\"";
-    size_t keyPos = json.find(searchKey);
-    if (keyPos == std::string::npos) {
-        brls::Logger::debug("extractJsonArray: key '{}' not found", key);
-        return "";
-    }
+int AudiobookshelfClient::extractJsonInt(std::string_view json, std::string_view key) {
+    return parseJsonInt(findJsonValue(json, key));
+}
 
-    // Find the colon after the key
-    size_t colonPos = json.find(':', keyPos + searchKey.length());
-    if (colonPos == std::string::npos) {
-        brls::Logger::debug("extractJsonArray: no colon after key '{}'", key);
-        return "";
-    }
+float AudiobookshelfClient::extractJsonFloat(std::string_view json, std::string_view key) {
+    return parseJsonFloat(findJsonValue(json, key));
+}
 
-    // Find the array bracket after the colon
-    size_t arrStart = json.find('[', colonPos);
-    if (arrStart == std::string::npos) {
-        brls::Logger::debug("extractJsonArray: no '[' after key '{}'", key);
-        return "";
-    }
+bool AudiobookshelfClient::extractJsonBool(std::string_view json, std::string_view key) {
+    return parseJsonBool(findJsonValue(json, key));
+}
 
-    // Make sure there's nothing but whitespace between colon and bracket
-    // This prevents matching arrays from other fields
-    for (size_t i = colonPos + 1; i < arrStart; i++) {
-        char c = json[i];
-        if (c != ' ' && c != '\t' && c != '\n' && c != '\r') {
-            brls::Logger::debug("extractJsonArray: non-whitespace '{}' between colon and '[' for key '{}'", c, key);
-            return "";
-        }
-    }
+int64_t AudiobookshelfClient::extractJsonInt64(std::string_view json, std::string_view key) {
+    return parseJsonInt64(findJsonValue(json, key));
+}
 
-    int bracketCount = 1;
-    size_t arrEnd = arrStart + 1;
-    while (bracketCount > 0 && arrEnd < json.length()) {
-        if (json[arrEnd] == '[') bracketCount++;
-        else if (json[arrEnd] == ']') bracketCount--;
-        arrEnd++;
+std::string_view AudiobookshelfClient::extractJsonArray(std::string_view json, std::string_view key) {
+    std::string_view result = findJsonContainer(json, key, '[', ']');
+    if (result.empty()) {
+        brls::Logger::debug("extractJsonArray: no array for key '{}'", key);
     }
+    return result;
+}
 
-    std::string result = json.substr(arrStart, arrEnd - arrStart);
-    brls::Logger::debug("extractJsonArray: found array for '{}' with {} chars", key, result.length());
+std::string_view AudiobookshelfClient::extractJsonObject(std::string_view json, std::string_view key) {
+    std::string_view result = findJsonContainer(json, key, '{', '}');
+    if (result.empty()) {
+        brls::Logger::debug("extractJsonObject: no object for key '{}'", key);
+    }
     return result;
 }
 
-std::string AudiobookshelfClient::extractJsonObject(const std::string& json, const std::string& key) {
-    std::string searchKey = "\"" + key + "\"";
-    size_t keyPos = json.find(searchKey);
-    if (keyPos == std::string::npos) {
-        brls::Logger::debug("extractJsonObject: key '{}' not found", key);
-        return "";
+// Field tables for the parse* helpers. Each object level of a response is
+// walked once; members land in the target (or a scratch struct where fields
+// have fallbacks) through a compile-time perfect hash of the key names.
+
+// Members of an item object, or of its "media" object (same key names)
+struct ItemJson {
+    std::string_view id, libraryId, updatedAt, mediaType, coverPath;
+    std::string_view episodeId, podcastId, libraryItemId;
+    std::string_view title, name, description, tags;
+    std::string_view duration, numTracks, numChapters, size, episode, season;
+    std::string_view media, metadata, userMediaProgress, mediaProgress, recentEpisode, libraryItem;
+};
+
+static constexpr JsonField<ItemJson> kItemFields[] = {
+    {"id", [](ItemJson& j, std::string_view v) { j.id = v; }},
+    {"libraryId", [](ItemJson& j, std::string_view v) { j.libraryId = v; }},
+    {"updatedAt", [](ItemJson& j, std::string_view v) { j.updatedAt = v; }},
+    {"mediaType", [](ItemJson& j, std::string_view v) { j.mediaType = v; }},
+    {"coverPath", [](ItemJson& j, std::string_view v) { j.coverPath = v; }},
+    {"episodeId", [](ItemJson& j, std::string_view v) { j.episodeId = v; }},
+    {"podcastId", [](ItemJson& j, std::string_view v) { j.podcastId = v; }},
+    {"libraryItemId", [](ItemJson& j, std::string_view v) { j.libraryItemId = v; }},
+    {"title", [](ItemJson& j, std::string_view v) { j.title = v; }},
+    {"name", [](ItemJson& j, std::string_view v) { j.name = v; }},
+    {"description", [](ItemJson& j, std::string_view v) { j.description = v; }},
+    {"tags", [](ItemJson& j, std::string_view v) { j.tags = v; }},
+    {"duration", [](ItemJson& j, std::string_view v) { j.duration = v; }},
+    {"numTracks", [](ItemJson& j, std::string_view v) { j.numTracks = v; }},
+    {"numChapters", [](ItemJson& j, std::string_view v) { j.numChapters = v; }},
+    {"size", [](ItemJson& j, std::string_view v) { j.size = v; }},
+    {"episode", [](ItemJson& j, std::string_view v) { j.episode = v; }},
+    {"season", [](ItemJson& j, std::string_view v) { j.season = v; }},
+    {"media", [](ItemJson& j, std::string_view v) { j.media = v; }},
+    {"metadata", [](ItemJson& j, std::string_view v) { j.metadata = v; }},
+    {"userMediaProgress", [](ItemJson& j, std::string_view v) { j.userMediaProgress = v; }},
+    {"mediaProgress", [](ItemJson& j, std::string_view v) { j.mediaProgress = v; }},
+    {"recentEpisode", [](ItemJson& j, std::string_view v) { j.recentEpisode = v; }},
+    {"libraryItem", [](ItemJson& j, std::string_view v) { j.libraryItem = v; }},
+};
+static constexpr auto kItemTable = makeJsonFieldTable(kItemFields);
+
+// Members of media.metadata
+struct ItemMetadataJson {
+    std::string_view title, subtitle, description, authorName, author, authors, narratorName;
+    std::string_view publishedYear, publisher, isbn, asin, language, seriesName, sequence, series;
+    std::string_view genres, episode;
+};
+
+static constexpr JsonField<ItemMetadataJson> kItemMetadataFields[] = {
+    {"title", [](ItemMetadataJson& m, std::string_view v) { m.title = v; }},
+    {"subtitle", [](ItemMetadataJson& m, std::string_view v) { m.subtitle = v; }},
+    {"description", [](ItemMetadataJson& m, std::string_view v) { m.description = v; }},
+    {"authorName", [](ItemMetadataJson& m, std::string_view v) { m.authorName = v; }},
+    {"author", [](ItemMetadataJson& m, std::string_view v) { m.author = v; }},
+    {"authors", [](ItemMetadataJson& m, std::string_view v) { m.authors = v; }},
+    {"narratorName", [](ItemMetadataJson& m, std::string_view v) { m.narratorName = v; }},
+    {"publishedYear", [](ItemMetadataJson& m, std::string_view v) { m.publishedYear = v; }},
+    {"publisher", [](ItemMetadataJson& m, std::string_view v) { m.publisher = v; }},
+    {"isbn", [](ItemMetadataJson& m, std::string_view v) { m.isbn = v; }},
+    {"asin", [](ItemMetadataJson& m, std::string_view v) { m.asin = v; }},
+    {"language", [](ItemMetadataJson& m, std::string_view v) { m.language = v; }},
+    {"seriesName", [](ItemMetadataJson& m, std::string_view v) { m.seriesName = v; }},
+    {"sequence", [](ItemMetadataJson& m, std::string_view v) { m.sequence = v; }},
+    {"series", [](ItemMetadataJson& m, std::string_view v) { m.series = v; }},
+    {"genres", [](ItemMetadataJson& m, std::string_view v) { m.genres = v; }},
+    {"episode", [](ItemMetadataJson& m, std::string_view v) { m.episode = v; }},
+};
+static constexpr auto kItemMetadataTable = makeJsonFieldTable(kItemMetadataFields);
+
+// Members of userMediaProgress / mediaProgress
+struct ItemProgressJson {
+    std::string_view currentTime, progress, isFinished, lastUpdate, episodeId, libraryItemId;
+};
+
+static constexpr JsonField<ItemProgressJson> kItemProgressFields[] = {
+    {"currentTime", [](ItemProgressJson& p, std::string_view v) { p.currentTime = v; }},
+    {"progress", [](ItemProgressJson& p, std::string_view v) { p.progress = v; }},
+    {"isFinished", [](ItemProgressJson& p, std::string_view v) { p.isFinished = v; }},
+    {"lastUpdate", [](ItemProgressJson& p, std::string_view v) { p.lastUpdate = v; }},
+    {"episodeId", [](ItemProgressJson& p, std::string_view v) { p.episodeId = v; }},
+    {"libraryItemId", [](ItemProgressJson& p, std::string_view v) { p.libraryItemId = v; }},
+};
+static constexpr auto kItemProgressTable = makeJsonFieldTable(kItemProgressFields);
+
+// Members of a recentEpisode / episode object
+struct ItemEpisodeJson {
+    std::string_view id, title, episode, season, pubDate, duration, libraryItemId;
+};
+
+static constexpr JsonField<ItemEpisodeJson> kItemEpisodeFields[] = {
+    {"id", [](ItemEpisodeJson& e, std::string_view v) { e.id = v; }},
+    {"title", [](ItemEpisodeJson& e, std::string_view v) { e.title = v; }},
+    {"episode", [](ItemEpisodeJson& e, std::string_view v) { e.episode = v; }},
+    {"season", [](ItemEpisodeJson& e, std::string_view v) { e.season = v; }},
+    {"pubDate", [](ItemEpisodeJson& e, std::string_view v) { e.pubDate = v; }},
+    {"duration", [](ItemEpisodeJson& e, std::string_view v) { e.duration = v; }},
+    {"libraryItemId", [](ItemEpisodeJson& e, std::string_view v) { e.libraryItemId = v; }},
+};
+static constexpr auto kItemEpisodeTable = makeJsonFieldTable(kItemEpisodeFields);
+
+static constexpr JsonField<Chapter> kChapterFields[] = {
+    {"id", [](Chapter& ch, std::string_view v) { ch.id = parseJsonInt(v); }},
+    {"title", [](Chapter& ch, std::string_view v) { ch.title = std::string(v); }},
+    {"start", [](Chapter& ch, std::string_view v) { ch.start = parseJsonFloat(v); }},
+    {"end", [](Chapter& ch, std::string_view v) { ch.end = parseJsonFloat(v); }},
+};
+static constexpr auto kChapterTable = makeJsonFieldTable(kChapterFields);
+
+static constexpr JsonField<AudioTrack> kAudioTrackFields[] = {
+    {"index", [](AudioTrack& t, std::string_view v) { t.index = parseJsonInt(v); }},
+    {"title", [](AudioTrack& t, std::string_view v) { t.title = std::string(v); }},
+    {"contentUrl", [](AudioTrack& t, std::string_view v) { t.contentUrl = std::string(v); }},
+    {"startOffset", [](AudioTrack& t, std::string_view v) { t.startOffset = parseJsonFloat(v); }},
+    {"duration", [](AudioTrack& t, std::string_view v) { t.duration = parseJsonFloat(v); }},
+    {"mimeType", [](AudioTrack& t, std::string_view v) { t.mimeType = std::string(v); }},
+};
+static constexpr auto kAudioTrackTable = makeJsonFieldTable(kAudioTrackFields);
+
+static constexpr JsonField<Library> kLibraryFields[] = {
+    {"id", [](Library& lib, std::string_view v) { lib.id = std::string(v); }},
+    {"name", [](Library& lib, std::string_view v) { lib.name = std::string(v); }},
+    {"icon", [](Library& lib, std::string_view v) { lib.icon = std::string(v); }},
+    {"mediaType", [](Library& lib, std::string_view v) { lib.mediaType = std::string(v); }},
+    {"stats", [](Library& lib, std::string_view v) {
+        size_t pos = 0;
+        std::string_view key, value;
+        while (nextJsonMember(v, pos, key, value)) {
+            if (key == "totalItems") lib.itemCount = parseJsonInt(value);
+        }
+    }},
+};
+static constexpr auto kLibraryTable = makeJsonFieldTable(kLibraryFields);
+
+static constexpr JsonField<PlaybackSession> kPlaybackSessionFields[] = {
+    {"id", [](PlaybackSession& s, std::string_view v) { s.id = std::string(v); }},
+    {"libraryItemId", [](PlaybackSession& s, std::string_view v) { s.libraryItemId = std::string(v); }},
+    {"episodeId", [](PlaybackSession& s, std::string_view v) { s.episodeId = std::string(v); }},
+    {"mediaType", [](PlaybackSession& s, std::string_view v) { s.mediaType = std::string(v); }},
+    {"currentTime", [](PlaybackSession& s, std::string_view v) { s.currentTime = parseJsonFloat(v); }},
+    {"duration", [](PlaybackSession& s, std::string_view v) { s.duration = parseJsonFloat(v); }},
+    {"startTime", [](PlaybackSession& s, std::string_view v) { s.startTime = parseJsonFloat(v); }},
+    {"playMethod", [](PlaybackSession& s, std::string_view v) { s.playMethod = std::string(v); }},
+    {"updatedAt", [](PlaybackSession& s, std::string_view v) { s.updatedAt = parseJsonInt64(v); }},
+};
+static constexpr auto kPlaybackSessionTable = makeJsonFieldTable(kPlaybackSessionFields);
+
+// Append the non-empty strings of a JSON string array
+static void parseStringArray(std::string_view array, std::vector<InternedString>& out) {
+    size_t pos = 0;
+    while ((pos = array.find('"', pos)) != std::string_view::npos) {
+        size_t strEnd = findJsonStringEnd(array, pos);
+        if (strEnd > pos + 1) {
+            out.push_back(std::string(array.substr(pos + 1, strEnd - pos - 1)));
+        }
+        pos = strEnd + 1;
     }
+}
 
-    // Find the colon after the key
-    size_t colonPos = json.find(':', keyPos + searchKey.length());
-    if (colonPos == std::string::npos) {
-        brls::Logger::debug("extractJsonObject: no colon after key '{}'", key);
-        return "";
+// Join the "name" of each author object with ", "
+static std::string joinAuthorNames(std::string_view authorsArray) {
+    std::string joined;
+    size_t pos = 0;
+    while ((pos = authorsArray.find('{', pos)) != std::string_view::npos) {
+        size_t objEnd = findJsonContainerEnd(authorsArray, pos);
+        std::string_view author = authorsArray.substr(pos, objEnd - pos);
+        size_t memberPos = 0;
+        std::string_view key, value;
+        while (nextJsonMember(author, memberPos, key, value)) {
+            if (key == "name" && !value.empty()) {
+                if (!joined.empty()) joined += ", ";
+                joined += value;
+                break;
+            }
+        }
+        pos = objEnd;
     }
+    return joined;
+}
 
-    // Find the object bracket after the colon
-    size_t objStart = json.find('{', colonPos);
-    if (objStart == std::string::npos) {
-        brls::Logger::debug("extractJsonObject: no '{{' after key '{}'", key);
-        return "";
+// Every level of an item object, gathered without copying anything.
+// Fields with fallbacks across levels are resolved by the item* helpers
+// below, shared by the full and the summary parse.
+struct ItemLevels {
+    ItemJson top;
+    ItemJson media;
+    ItemMetadataJson metadata;
+    ItemProgressJson progress;
+    ItemEpisodeJson episode;    // recentEpisode / continue-listening episode object
+    bool hasEpisode = false;
+
+    // Fields that live in "media" when the item has one, at the top level otherwise
+    const ItemJson& mediaLevel() const { return top.media.empty() ? top : media; }
+};
+
+static void parseItemLevels(std::string_view json, ItemLevels& levels) {
+    kItemTable.parse(json, levels.top);
+    if (!levels.top.media.empty()) {
+        kItemTable.parse(levels.top.media, levels.media);
     }
+    kItemMetadataTable.parse(levels.mediaLevel().metadata, levels.metadata);
+    kItemProgressTable.parse(!levels.top.userMediaProgress.empty() ? levels.top.userMediaProgress
+                                                                   : levels.top.mediaProgress,
+                             levels.progress);
 
-    // Make sure there's nothing but whitespace between colon and bracket
-    for (size_t i = colonPos + 1; i < objStart; i++) {
-        char c = json[i];
-        if (c != ' ' && c != '\t' && c != '\n' && c != '\r') {
-            brls::Logger::debug("extractJsonObject: non-whitespace '{}' between colon and '{{' for key '{}'", c, key);
-            return "";
+    // Podcast episode info: the item may carry the episode id directly, in its
+    // progress, or as a nested recentEpisode / episode object
+    if (levels.top.episodeId.empty() && levels.progress.episodeId.empty()) {
+        std::string_view epObj = levels.top.recentEpisode;
+        if (epObj.empty() && !levels.top.episode.empty() && levels.top.episode.front() == '{') {
+            epObj = levels.top.episode;
+        }
+        if (!epObj.empty()) {
+            kItemEpisodeTable.parse(epObj, levels.episode);
+            levels.hasEpisode = true;
         }
     }
+}
 
-    int braceCount = 1;
-    size_t objEnd = objStart + 1;
-    while (braceCount > 0 && objEnd < json.length()) {
-        if (json[objEnd] == '{') braceCount++;
-        else if (json[objEnd] == '}') braceCount--;
-        objEnd++;
+static std::string_view itemTitle(const ItemLevels& l) {
+    if (l.hasEpisode && !l.episode.title.empty()) return l.episode.title;
+    std::string_view title = !l.mediaLevel().metadata.empty() ? l.metadata.title : l.top.title;
+    return !title.empty() ? title : l.top.name;
+}
+
+static std::string_view itemDescription(const ItemLevels& l) {
+    return !l.mediaLevel().metadata.empty() ? l.metadata.description : l.top.description;
+}
+
+// For audiobooks: authorName, for podcasts: author (feed owner), else the
+// expanded authors array
+static std::string itemAuthor(const ItemLevels& l) {
+    if (!l.metadata.authorName.empty()) return std::string(l.metadata.authorName);
+    if (!l.metadata.author.empty()) return std::string(l.metadata.author);
+    if (l.metadata.authors.size() > 2) {
+        std::string joined = joinAuthorNames(l.metadata.authors);
+        if (!joined.empty()) {
+            brls::Logger::debug("Parsed authors from array: {}", joined);
+        }
+        return joined;
     }
+    return "";
+}
 
-    std::string result = json.substr(objStart, objEnd - objStart);
-    brls::Logger::debug("extractJsonObject: found object for '{}' with {} chars", key, result.length());
-    return result;
+static std::string_view itemType(const ItemLevels& l) {
+    if (l.hasEpisode) return "podcastEpisode";
+    return !l.top.mediaType.empty() ? l.top.mediaType : l.media.mediaType;
 }
 
-MediaItem AudiobookshelfClient::parseMediaItem(const std::string& json) {
-    MediaItem item;
+static std::string_view itemEpisodeId(const ItemLevels& l) {
+    if (!l.top.episodeId.empty()) return l.top.episodeId;
+    if (!l.progress.episodeId.empty()) return l.progress.episodeId;
+    return l.episode.id;
+}
 
-    // Use top-level extraction for id to avoid picking up nested object ids
-    item.id = extractTopLevelValue(json, "id");
-    std::string naiveId = extractJsonValue(json, "id");
-    if (item.id.empty()) {
-        item.id = naiveId;
+static std::string_view itemPodcastId(const ItemLevels& l, std::string_view id, std::string_view episodeId) {
+    if (!l.top.podcastId.empty()) return l.top.podcastId;
+    if (!l.top.libraryItemId.empty()) return l.top.libraryItemId;
+    if (!l.progress.libraryItemId.empty()) return l.progress.libraryItemId;
+    if (!l.episode.libraryItemId.empty()) return l.episode.libraryItemId;
+    if (episodeId.empty()) return {};
+    if (!l.top.libraryItem.empty()) {
+        // Some API formats wrap the item in a libraryItem object
+        ItemJson libraryItem;
+        kItemTable.parse(l.top.libraryItem, libraryItem);
+        if (!libraryItem.id.empty()) return libraryItem.id;
     }
-    if (!item.id.empty() && item.id != naiveId) {
-        brls::Logger::debug("parseMediaItem: top-level id='{}' differs from naive id='{}'", item.id, naiveId);
-    }
-    item.libraryId = extractJsonValue(json, "libraryId");
+    return id;
+}
 
-    // Get media metadata (nested object)
-    std::string mediaObj = extractJsonObject(json, "media");
-    std::string metadataObj = extractJsonObject(mediaObj.empty() ? json : mediaObj, "metadata");
+static float itemDuration(const ItemLevels& l) {
+    float epDuration = l.hasEpisode ? parseJsonFloat(l.episode.duration) : 0.0f;
+    return epDuration > 0 ? epDuration : parseJsonFloat(l.mediaLevel().duration);
+}
 
-    if (!metadataObj.empty()) {
-        item.title = extractJsonValue(metadataObj, "title");
-        item.subtitle = extractJsonValue(metadataObj, "subtitle");
-        item.description = extractJsonValue(metadataObj, "description");
-        // For audiobooks: authorName, for podcasts: author
-        item.authorName = extractJsonValue(metadataObj, "authorName");
-        if (item.authorName.empty()) {
-            // Podcasts use "author" field for the creator/feed owner
-            item.authorName = extractJsonValue(metadataObj, "author");
-        }
-        // If still empty, try parsing the authors array (expanded format)
-        if (item.authorName.empty()) {
-            std::string authorsArray = extractJsonArray(metadataObj, "authors");
-            if (!authorsArray.empty() && authorsArray != "[]") {
-                // Extract author names from array and join them
-                std::vector<std::string> authorNames;
-                size_t pos = 0;
-                while ((pos = authorsArray.find("\"name\"", pos)) != std::string::npos) {
-                    size_t colonPos = authorsArray.find(':', pos);
-                    if (colonPos != std::string::npos) {
-                        size_t nameStart = authorsArray.find('"', colonPos + 1);
-                        if (nameStart != std::string::npos) {
-                            size_t nameEnd = authorsArray.find('"', nameStart + 1);
-                            if (nameEnd != std::string::npos) {
-                                std::string name = authorsArray.substr(nameStart + 1, nameEnd - nameStart - 1);
-                                if (!name.empty()) {
-                                    authorNames.push_back(name);
-                                }
-                                pos = nameEnd;
-                            }
-                        }
-                    }
-                    pos++;
-                }
-                // Join author names with ", "
-                for (size_t i = 0; i < authorNames.size(); ++i) {
-                    if (i > 0) item.authorName += ", ";
-                    item.authorName += authorNames[i];
-                }
-                if (!item.authorName.empty()) {
-                    brls::Logger::debug("Parsed authors from array: {}", item.authorName);
-                }
-            }
-        }
-        item.narratorName = extractJsonValue(metadataObj, "narratorName");
-        item.publishedYear = extractJsonValue(metadataObj, "publishedYear");
-        item.publisher = extractJsonValue(metadataObj, "publisher");
-        item.isbn = extractJsonValue(metadataObj, "isbn");
-        item.asin = extractJsonValue(metadataObj, "asin");
-        item.language = extractJsonValue(metadataObj, "language");
-        item.seriesName = extractJsonValue(metadataObj, "seriesName");
-        item.seriesSequence = extractJsonValue(metadataObj, "sequence");
-
-        // Parse genres from metadata.genres (array of strings)
-        std::string genresArray = extractJsonArray(metadataObj, "genres");
-        if (!genresArray.empty() && genresArray != "[]") {
-            size_t pos = 0;
-            while ((pos = genresArray.find('"', pos)) != std::string::npos) {
-                size_t strEnd = genresArray.find('"', pos + 1);
-                if (strEnd != std::string::npos) {
-                    std::string genre = genresArray.substr(pos + 1, strEnd - pos - 1);
-                    if (!genre.empty()) {
-                        item.genres.push_back(genre);
-                    }
-                    pos = strEnd + 1;
-                } else {
-                    break;
-                }
-            }
-        }
-    } else {
-        // Fallback to direct fields
-        item.title = extractJsonValue(json, "title");
-        item.description = extractJsonValue(json, "description");
+// The "episode" field holds the number on episode objects
+static int itemEpisodeNumber(const ItemLevels& l) {
+    int number = l.hasEpisode ? parseJsonInt(l.episode.episode) : 0;
+    if (number == 0 && !l.top.episode.empty() && l.top.episode.front() != '{') {
+        number = parseJsonInt(l.top.episode);
     }
+    return number != 0 ? number : parseJsonInt(l.metadata.episode);
+}
 
-    // If title still empty, try other fields
-    if (item.title.empty()) {
-        item.title = extractJsonValue(json, "name");
-    }
+MediaItem AudiobookshelfClient::parseMediaItem(std::string_view json) {
+    ItemLevels levels;
+    parseItemLevels(json, levels);
+    const ItemMetadataJson& metadata = levels.metadata;
+    const ItemJson& mediaLevel = levels.mediaLevel();
 
-    // Parse tags from media.tags (array of strings, one level above metadata)
-    std::string tagsSource = mediaObj.empty() ? json : mediaObj;
-    std::string tagsArray = extractJsonArray(tagsSource, "tags");
-    if (!tagsArray.empty() && tagsArray != "[]") {
-        size_t pos = 0;
-        while ((pos = tagsArray.find('"', pos)) != std::string::npos) {
-            size_t strEnd = tagsArray.find('"', pos + 1);
-            if (strEnd != std::string::npos) {
-                std::string tag = tagsArray.substr(pos + 1, strEnd - pos - 1);
-                if (!tag.empty()) {
-                    item.tags.push_back(tag);
-                }
-                pos = strEnd + 1;
-            } else {
-                break;
+    MediaItem item;
+    item.id = std::string(levels.top.id);
+    if (item.id.empty()) {
+        item.id = extractJsonValue(json, "id");
+    }
+    item.libraryId = std::string(levels.top.libraryId);
+    if (!levels.top.updatedAt.empty()) {
+        item.updatedAt = parseJsonInt64(levels.top.updatedAt);
+    }
+
+    item.title = std::string(itemTitle(levels));
+    item.subtitle = std::string(metadata.subtitle);
+    item.description = std::string(itemDescription(levels));
+    item.authorName = itemAuthor(levels);
+    item.narratorName = std::string(metadata.narratorName);
+    item.publishedYear = std::string(metadata.publishedYear);
+    item.publisher = std::string(metadata.publisher);
+    item.isbn = std::string(metadata.isbn);
+    item.asin = std::string(metadata.asin);
+    item.language = std::string(metadata.language);
+    item.seriesName = std::string(metadata.seriesName);
+    item.seriesSequence = std::string(metadata.sequence);
+
+    // Expanded format keeps the sequence in the series array
+    if (item.seriesSequence.empty() && !metadata.series.empty()) {
+        size_t seriesStart = metadata.series.find('{');
+        if (seriesStart != std::string_view::npos) {
+            size_t pos = 0;
+            std::string_view key, value;
+            std::string_view firstSeries = metadata.series.substr(seriesStart);
+            while (nextJsonMember(firstSeries, pos, key, value)) {
+                if (key == "sequence") item.seriesSequence = std::string(value);
             }
         }
     }
+    parseStringArray(metadata.genres, item.genres);
 
-    // Media type
-    item.type = extractJsonValue(json, "mediaType");
-    if (item.type.empty()) {
-        item.type = extractJsonValue(mediaObj, "mediaType");
-    }
-    item.mediaType = parseMediaType(item.type);
+    // Tags sit in media.tags, one level above metadata
+    parseStringArray(mediaLevel.tags, item.tags);
+
+    item.type = std::string(itemType(levels));
+    item.mediaType = levels.hasEpisode ? MediaType::PODCAST_EPISODE : parseMediaType(item.type);
 
-    // Duration and progress
-    item.duration = extractJsonFloat(mediaObj.empty() ? json : mediaObj, "duration");
-    item.numTracks = extractJsonInt(mediaObj.empty() ? json : mediaObj, "numTracks");
-    item.numChapters = extractJsonInt(mediaObj.empty() ? json : mediaObj, "numChapters");
-    item.size = extractJsonInt64(mediaObj.empty() ? json : mediaObj, "size");
+    // Duration and size
+    item.duration = itemDuration(levels);
+    item.numTracks = parseJsonInt(mediaLevel.numTracks);
+    item.numChapters = parseJsonInt(mediaLevel.numChapters);
+    item.size = parseJsonInt64(mediaLevel.size);
 
     // Progress info (from userMediaProgress or mediaProgress)
-    std::string progressObj = extractJsonObject(json, "userMediaProgress");
-    if (progressObj.empty()) {
-        progressObj = extractJsonObject(json, "mediaProgress");
-    }
-    if (!progressObj.empty()) {
-        item.currentTime = extractJsonFloat(progressObj, "currentTime");
-        item.progress = extractJsonFloat(progressObj, "progress");
-        item.isFinished = extractJsonBool(progressObj, "isFinished");
-        item.progressLastUpdate = extractJsonInt64(progressObj, "lastUpdate");
-    }
+    item.currentTime = parseJsonFloat(levels.progress.currentTime);
+    item.progress = parseJsonFloat(levels.progress.progress);
+    item.isFinished = parseJsonBool(levels.progress.isFinished);
+    item.progressLastUpdate = parseJsonInt64(levels.progress.lastUpdate);
 
-    // Cover path
-    item.coverPath = extractJsonValue(json, "coverPath");
-    if (item.coverPath.empty()) {
-        item.coverPath = extractJsonValue(mediaObj, "coverPath");
-    }
+    item.coverPath = std::string(!levels.top.coverPath.empty() ? levels.top.coverPath : levels.media.coverPath);
 
     // Podcast episode info
-    item.episodeId = extractTopLevelValue(json, "episodeId");
-    if (item.episodeId.empty()) {
-        item.episodeId = extractJsonValue(json, "episodeId");
-    }
-    if (item.episodeId.empty()) {
-        std::string recentEp = extractJsonObject(json, "recentEpisode");
-        if (!recentEp.empty()) {
-            item.episodeId = extractJsonValue(recentEp, "id");
-            std::string epTitle = extractJsonValue(recentEp, "title");
-            if (!epTitle.empty()) {
-                item.title = epTitle;
-            }
-            item.episodeNumber = extractJsonInt(recentEp, "episode");
-            item.seasonNumber = extractJsonInt(recentEp, "season");
-            item.pubDate = extractJsonValue(recentEp, "pubDate");
-            float epDuration = extractJsonFloat(recentEp, "duration");
-            if (epDuration > 0) {
-                item.duration = epDuration;
-            }
-            item.mediaType = MediaType::PODCAST_EPISODE;
-            item.type = "podcastEpisode";
-        }
-        // Also check "episode" nested object (continue-listening format)
-        if (item.episodeId.empty()) {
-            std::string epObj = extractJsonObject(json, "episode");
-            if (!epObj.empty()) {
-                item.episodeId = extractJsonValue(epObj, "id");
-                std::string epTitle = extractJsonValue(epObj, "title");
-                if (!epTitle.empty()) {
-                    item.title = epTitle;
-                }
-                item.episodeNumber = extractJsonInt(epObj, "episode");
-                item.seasonNumber = extractJsonInt(epObj, "season");
-                item.pubDate = extractJsonValue(epObj, "pubDate");
-                float epDuration = extractJsonFloat(epObj, "duration");
-                if (epDuration > 0) {
-                    item.duration = epDuration;
-                }
-                item.mediaType = MediaType::PODCAST_EPISODE;
-                item.type = "podcastEpisode";
-            }
-        }
-    }
-    item.podcastId = extractTopLevelValue(json, "podcastId");
-    if (item.podcastId.empty()) {
-        item.podcastId = extractTopLevelValue(json, "libraryItemId");
-    }
-    if (item.podcastId.empty()) {
-        item.podcastId = extractJsonValue(json, "libraryItemId");
-    }
-    if (item.podcastId.empty() && !item.episodeId.empty()) {
-        // Try nested libraryItem object (some API formats wrap the item)
-        std::string libItemObj = extractJsonObject(json, "libraryItem");
-        if (!libItemObj.empty()) {
-            item.podcastId = extractJsonValue(libItemObj, "id");
-        }
-    }
-    if (item.podcastId.empty() && !item.episodeId.empty()) {
-        item.podcastId = item.id;
+    item.episodeId = std::string(itemEpisodeId(levels));
+    item.podcastId = std::string(itemPodcastId(levels, item.id, item.episodeId));
+    if (levels.hasEpisode) {
+        item.pubDate = std::string(levels.episode.pubDate);
+        item.seasonNumber = parseJsonInt(levels.episode.season);
     }
     if (!item.episodeId.empty()) {
         brls::Logger::debug("parseMediaItem episode: id='{}' podcastId='{}' episodeId='{}' title='{}'",
                            item.id, item.podcastId, item.episodeId, item.title);
     }
-    // Episode number - try "episode" field (API uses this for episode number)
-    if (item.episodeNumber == 0) {
-        item.episodeNumber = extractJsonInt(json, "episode");
-    }
-    if (item.episodeNumber == 0 && !metadataObj.empty()) {
-        item.episodeNumber = extractJsonInt(metadataObj, "episode");
+    item.episodeNumber = itemEpisodeNumber(levels);
+    if (!levels.top.season.empty()) {
+        item.seasonNumber = parseJsonInt(levels.top.season);
     }
-    item.seasonNumber = extractJsonInt(json, "season");
 
     return item;
 }
 
-Chapter AudiobookshelfClient::parseChapter(const std::string& json) {
+MediaItemSummary AudiobookshelfClient::parseMediaItemSummary(std::string_view json) {
+    ItemLevels levels;
+    parseItemLevels(json, levels);
+
+    MediaItemSummary summary;
+    summary.id = std::string(levels.top.id);
+    if (summary.id.empty()) {
+        summary.id = extractJsonValue(json, "id");
+    }
+    summary.libraryId = std::string(levels.top.libraryId);
+    summary.title = std::string(itemTitle(levels));
+    summary.authorName = itemAuthor(levels);
+    summary.coverPath = std::string(!levels.top.coverPath.empty() ? levels.top.coverPath : levels.media.coverPath);
+    summary.type = std::string(itemType(levels));
+    summary.blurb = makeBlurb(itemDescription(levels));
+    summary.mediaType = levels.hasEpisode ? MediaType::PODCAST_EPISODE : parseMediaType(summary.type);
+    summary.duration = itemDuration(levels);
+    summary.currentTime = parseJsonFloat(levels.progress.currentTime);
+    summary.progress = parseJsonFloat(levels.progress.progress);
+    summary.isFinished = parseJsonBool(levels.progress.isFinished);
+    summary.episodeId = std::string(itemEpisodeId(levels));
+    summary.podcastId = std::string(itemPodcastId(levels, summary.id, summary.episodeId));
+    summary.episodeNumber = itemEpisodeNumber(levels);
+    return summary;
+}
+
+Chapter AudiobookshelfClient::parseChapter(std::string_view json) {
     Chapter ch;
-    ch.id = extractJsonInt(json, "id");
-    ch.title = extractJsonValue(json, "title");
-    ch.start = extractJsonFloat(json, "start");
-    ch.end = extractJsonFloat(json, "end");
+    kChapterTable.parse(json, ch);
     return ch;
 }
 
-AudioTrack AudiobookshelfClient::parseAudioTrack(const std::string& json) {
+AudioTrack AudiobookshelfClient::parseAudioTrack(std::string_view json) {
     AudioTrack track;
-    track.index = extractJsonInt(json, "index");
-    track.title = extractJsonValue(json, "title");
-    track.contentUrl = extractJsonValue(json, "contentUrl");
-    track.startOffset = extractJsonFloat(json, "startOffset");
-    track.duration = extractJsonFloat(json, "duration");
-    track.mimeType = extractJsonValue(json, "mimeType");
+    kAudioTrackTable.parse(json, track);
     return track;
 }
 
+Library AudiobookshelfClient::parseLibrary(std::string_view json) {
+    Library lib;
+    kLibraryTable.parse(json, lib);
+    return lib;
+}
+
+PlaybackSession AudiobookshelfClient::parsePlaybackSession(std::string_view json) {
+    PlaybackSession session;
+    kPlaybackSessionTable.parse(json, session);
+    return session;
+}
+
 bool AudiobookshelfClient::login(const std::string& username, const std::string& password) {
     brls::Logger::info("Attempting login for user: {}", username);
 
@@ -496,7 +681,7 @@ bool AudiobookshelfClient::login(const std::string& username, const std::string&
     HttpResponse resp = client.request(req);
 
     if (resp.statusCode == 200) {
-        std::string userObj = extractJsonObject(resp.body, "user");
+        std::string_view userObj = extractJsonObject(resp.body, "user");
 
         m_authToken = extractJsonValue(userObj, "accessToken");
         m_refreshToken = extractJsonValue(userObj, "refreshToken");
@@ -538,7 +723,7 @@ bool AudiobookshelfClient::refreshAccessToken() {
     HttpResponse resp = client.request(req);
 
     if (resp.statusCode == 200) {
-        std::string userObj = extractJsonObject(resp.body, "user");
+        std::string_view userObj = extractJsonObject(resp.body, "user");
 
         std::string newAccess = extractJsonValue(userObj, "accessToken");
         std::string newRefresh = extractJsonValue(userObj, "refreshToken");
@@ -616,6 +801,7 @@ void AudiobookshelfClient::logout() {
     m_authToken.clear();
     m_refreshToken.clear();
     m_currentUser = User();
+    HttpCache::getInstance().clear();
 
     auto& app = Application::getInstance();
     app.setAuthToken("");
@@ -725,6 +911,7 @@ bool AudiobookshelfClient::fetchItemsInProgress(std::vector<MediaItem>& items) {
     req.method = "GET";
     req.headers["Accept"] = "application/json";
     req.headers["Authorization"] = "Bearer " + m_authToken;
+    req.cacheTtl = CACHE_TTL_SHELVES;
 
     HttpResponse resp = client.request(req);
 
@@ -737,9 +924,10 @@ bool AudiobookshelfClient::fetchItemsInProgress(std::vector<MediaItem>& items) {
                        resp.body.substr(0, std::min<size_t>(500, resp.body.size())));
 
     items.clear();
+    AllocCounter parseAllocs;
 
     // Parse libraryItems array
-    std::string itemsArray = extractJsonArray(resp.body, "libraryItems");
+    std::string_view itemsArray = extractJsonArray(resp.body, "libraryItems");
     if (itemsArray.empty()) {
         // Try direct array response
         itemsArray = resp.body;
@@ -753,27 +941,25 @@ bool AudiobookshelfClient::fetchItemsInProgress(std::vector<MediaItem>& items) {
             continue;
         }
 
-        int braceCount = 1;
-        size_t objEnd = objStart + 1;
-        while (braceCount > 0 && objEnd < itemsArray.length()) {
-            if (itemsArray[objEnd] == '{') braceCount++;
-            else if (itemsArray[objEnd] == '}') braceCount--;
-            objEnd++;
-        }
+        size_t objEnd = findJsonContainerEnd(itemsArray, objStart);
 
-        std::string obj = itemsArray.substr(objStart, objEnd - objStart);
+        std::string_view obj = itemsArray.substr(objStart, objEnd - objStart);
         brls::Logger::debug("fetchItemsInProgress entity (first 300 chars): {}",
                            obj.substr(0, std::min<size_t>(300, obj.size())));
         MediaItem item = parseMediaItem(obj);
 
         if (!item.id.empty() && !item.title.empty()) {
-            items.push_back(item);
+            items.push_back(std::move(item));
         }
 
         pos = objEnd;
     }
 
     brls::Logger::info("Found {} items in progress", items.size());
+    if (AllocCounter::enabled()) {
+        brls::Logger::debug("fetchItemsInProgress: {} items parsed with {} allocations",
+                           items.size(), parseAllocs.count());
+    }
     return true;
 }
 
@@ -804,28 +990,14 @@ bool AudiobookshelfClient::fetchListeningSessions(std::vector<PlaybackSession>&
             continue;
         }
 
-        int braceCount = 1;
-        size_t objEnd = objStart + 1;
-        while (braceCount > 0 && objEnd < resp.body.length()) {
-            if (resp.body[objEnd] == '{') braceCount++;
-            else if (resp.body[objEnd] == '}') braceCount--;
-            objEnd++;
-        }
+        size_t objEnd = findJsonContainerEnd(resp.body, objStart);
 
-        std::string obj = resp.body.substr(objStart, objEnd - objStart);
+        std::string_view obj = std::string_view(resp.body).substr(objStart, objEnd - objStart);
 
-        PlaybackSession session;
-        session.id = extractJsonValue(obj, "id");
-        session.libraryItemId = extractJsonValue(obj, "libraryItemId");
-        session.episodeId = extractJsonValue(obj, "episodeId");
-        session.mediaType = extractJsonValue(obj, "mediaType");
-        session.currentTime = extractJsonFloat(obj, "currentTime");
-        session.duration = extractJsonFloat(obj, "duration");
-        session.playMethod = extractJsonValue(obj, "playMethod");
-        session.updatedAt = extractJsonInt64(obj, "updatedAt");
+        PlaybackSession session = parsePlaybackSession(obj);
 
         if (!session.id.empty()) {
-            sessions.push_back(session);
+            sessions.push_back(std::move(session));
         }
 
         pos = objEnd;
@@ -844,6 +1016,7 @@ bool AudiobookshelfClient::fetchLibraries(std::vector<Library>& libraries) {
     req.method = "GET";
     req.headers["Accept"] = "application/json";
     req.headers["Authorization"] = "Bearer " + m_authToken;
+    req.cacheTtl = CACHE_TTL_LIBRARIES;
 
     HttpResponse resp = client.request(req);
 
@@ -855,7 +1028,7 @@ bool AudiobookshelfClient::fetchLibraries(std::vector<Library>& libraries) {
     libraries.clear();
 
     // Parse libraries array
-    std::string libsArray = extractJsonArray(resp.body, "libraries");
+    std::string_view libsArray = extractJsonArray(resp.body, "libraries");
     if (libsArray.empty()) {
         libsArray = resp.body;
     }
@@ -868,30 +1041,15 @@ bool AudiobookshelfClient::fetchLibraries(std::vector<Library>& libraries) {
             continue;
         }
 
-        int braceCount = 1;
-        size_t objEnd = objStart + 1;
-        while (braceCount > 0 && objEnd < libsArray.length()) {
-            if (libsArray[objEnd] == '{') braceCount++;
-            else if (libsArray[objEnd] == '}') braceCount--;
-            objEnd++;
-        }
+        size_t objEnd = findJsonContainerEnd(libsArray, objStart);
 
-        std::string obj = libsArray.substr(objStart, objEnd - objStart);
+        std::string_view obj = libsArray.substr(objStart, objEnd - objStart);
 
-        Library lib;
-        lib.id = extractJsonValue(obj, "id");
-        lib.name = extractJsonValue(obj, "name");
-        lib.icon = extractJsonValue(obj, "icon");
-        lib.mediaType = extractJsonValue(obj, "mediaType");
-
-        // Get stats for item count
-        std::string statsObj = extractJsonObject(obj, "stats");
-        if (!statsObj.empty()) {
-            lib.itemCount = extractJsonInt(statsObj, "totalItems");
-        }
+        // Item count comes from the nested stats object
+        Library lib = parseLibrary(obj);
 
         if (!lib.id.empty() && !lib.name.empty()) {
-            libraries.push_back(lib);
+            libraries.push_back(std::move(lib));
         }
 
         pos = objEnd;
@@ -910,6 +1068,7 @@ bool AudiobookshelfClient::fetchLibrary(const std::string& libraryId, Library& l
     req.method = "GET";
     req.headers["Accept"] = "application/json";
     req.headers["Authorization"] = "Bearer " + m_authToken;
+    req.cacheTtl = CACHE_TTL_LIBRARIES;
 
     HttpResponse resp = client.request(req);
 
@@ -918,42 +1077,67 @@ bool AudiobookshelfClient::fetchLibrary(const std::string& libraryId, Library& l
         return false;
     }
 
-    library.id = extractJsonValue(resp.body, "id");
-    library.name = extractJsonValue(resp.body, "name");
-    library.icon = extractJsonValue(resp.body, "icon");
-    library.mediaType = extractJsonValue(resp.body, "mediaType");
+    library = parseLibrary(resp.body);
 
     return true;
 }
 
-bool AudiobookshelfClient::fetchLibraryItems(const std::string& libraryId, std::vector<MediaItem>& items,
-                                              int page, int limit, const std::string& sort) {
+// Calls fn with every item object in an array of items (objects nested
+// inside an item are skipped along with it)
+template <typename Fn>
+static void forEachItemObject(std::string_view array, Fn fn) {
+    size_t pos = 0;
+    while ((pos = array.find("\"id\"", pos)) != std::string::npos) {
+        size_t objStart = array.rfind('{', pos);
+        if (objStart == std::string::npos) {
+            pos++;
+            continue;
+        }
+
+        size_t objEnd = findJsonContainerEnd(array, objStart);
+        fn(array.substr(objStart, objEnd - objStart));
+        pos = objEnd;
+    }
+}
+
+bool AudiobookshelfClient::requestLibraryItems(const std::string& libraryId, int page, int limit,
+                                                const std::string& sort, bool descending, int* total,
+                                                HttpResponse& resp, std::string& libraryMediaType) {
     brls::Logger::debug("Fetching library items: library={}, page={}, limit={}", libraryId, page, limit);
 
     HttpClient client;
     HttpRequest req;
     std::string url = buildApiUrl("/api/libraries/" + libraryId + "/items");
-    url += "?page=" + std::to_string(page) + "&limit=" + std::to_string(limit);
+    // Minified entries carry the metadata but no audio files, chapters or
+    // tracks; full items are fetched when a detail view opens
+    url += "?minified=1&page=" + std::to_string(page) + "&limit=" + std::to_string(limit);
     if (!sort.empty()) {
         url += "&sort=" + sort;
+        if (descending) {
+            url += "&desc=1";
+        }
     }
 
     req.url = url;
     req.method = "GET";
     req.headers["Accept"] = "application/json";
     req.headers["Authorization"] = "Bearer " + m_authToken;
+    req.cacheTtl = CACHE_TTL_SHELVES;
 
-    HttpResponse resp = client.request(req);
+    resp = client.request(req);
 
     if (resp.statusCode != 200) {
         brls::Logger::error("Failed to fetch library items: {}", resp.statusCode);
         return false;
     }
 
-    items.clear();
+    if (total) {
+        std::string totalValue = extractTopLevelValue(resp.body, "total");
+        *total = totalValue.empty() ? -1 : atoi(totalValue.c_str());
+    }
 
     // Get library mediaType from response to set on items that don't have it
-    std::string libraryMediaType = extractJsonValue(resp.body, "mediaType");
+    libraryMediaType = extractJsonValue(resp.body, "mediaType");
     if (libraryMediaType.empty()) {
         // Try to get it from the library info
         Library lib;
@@ -961,32 +1145,30 @@ bool AudiobookshelfClient::fetchLibraryItems(const std::string& libraryId, std::
             libraryMediaType = lib.mediaType;
         }
     }
+    brls::Logger::debug("Library media type: {}", libraryMediaType);
+    return true;
+}
+
+bool AudiobookshelfClient::fetchLibraryItems(const std::string& libraryId, std::vector<MediaItem>& items,
+                                              int page, int limit, const std::string& sort,
+                                              bool descending, int* total) {
+    HttpResponse resp;
+    std::string libraryMediaType;
+    if (!requestLibraryItems(libraryId, page, limit, sort, descending, total, resp, libraryMediaType)) {
+        return false;
+    }
     MediaType defaultMediaType = parseMediaType(libraryMediaType);
-    brls::Logger::debug("Library media type: {} (enum: {})", libraryMediaType, static_cast<int>(defaultMediaType));
+
+    items.clear();
 
     // Parse results array
-    std::string resultsArray = extractJsonArray(resp.body, "results");
+    AllocCounter parseAllocs;
+    std::string_view resultsArray = extractJsonArray(resp.body, "results");
     if (resultsArray.empty()) {
         resultsArray = resp.body;
     }
 
-    size_t pos = 0;
-    while ((pos = resultsArray.find("\"id\"", pos)) != std::string::npos) {
-        size_t objStart = resultsArray.rfind('{', pos);
-        if (objStart == std::string::npos) {
-            pos++;
-            continue;
-        }
-
-        int braceCount = 1;
-        size_t objEnd = objStart + 1;
-        while (braceCount > 0 && objEnd < resultsArray.length()) {
-            if (resultsArray[objEnd] == '{') braceCount++;
-            else if (resultsArray[objEnd] == '}') braceCount--;
-            objEnd++;
-        }
-
-        std::string obj = resultsArray.substr(objStart, objEnd - objStart);
+    forEachItemObject(resultsArray, [&](std::string_view obj) {
         MediaItem item = parseMediaItem(obj);
 
         // If mediaType wasn't set from item JSON, use library's mediaType
@@ -996,13 +1178,54 @@ bool AudiobookshelfClient::fetchLibraryItems(const std::string& libraryId, std::
         }
 
         if (!item.id.empty() && !item.title.empty()) {
-            items.push_back(item);
+            items.push_back(std::move(item));
         }
+    });
 
-        pos = objEnd;
+    brls::Logger::info("Found {} items in library {}", items.size(), libraryId);
+    if (AllocCounter::enabled()) {
+        brls::Logger::debug("fetchLibraryItems: {} items parsed with {} allocations",
+                           items.size(), parseAllocs.count());
+    }
+    return true;
+}
+
+bool AudiobookshelfClient::fetchLibraryItems(const std::string& libraryId, std::vector<MediaItemSummary>& items,
+                                              int page, int limit, const std::string& sort,
+                                              bool descending, int* total) {
+    HttpResponse resp;
+    std::string libraryMediaType;
+    if (!requestLibraryItems(libraryId, page, limit, sort, descending, total, resp, libraryMediaType)) {
+        return false;
+    }
+    MediaType defaultMediaType = parseMediaType(libraryMediaType);
+
+    items.clear();
+
+    AllocCounter parseAllocs;
+    std::string_view resultsArray = extractJsonArray(resp.body, "results");
+    if (resultsArray.empty()) {
+        resultsArray = resp.body;
     }
 
+    forEachItemObject(resultsArray, [&](std::string_view obj) {
+        MediaItemSummary item = parseMediaItemSummary(obj);
+
+        if (item.mediaType == MediaType::UNKNOWN && defaultMediaType != MediaType::UNKNOWN) {
+            item.mediaType = defaultMediaType;
+            item.type = libraryMediaType;
+        }
+
+        if (!item.id.empty() && !item.title.empty()) {
+            items.push_back(std::move(item));
+        }
+    });
+
     brls::Logger::info("Found {} items in library {}", items.size(), libraryId);
+    if (AllocCounter::enabled()) {
+        brls::Logger::debug("fetchLibraryItems: {} summaries parsed with {} allocations",
+                           items.size(), parseAllocs.count());
+    }
     return true;
 }
 
@@ -1020,6 +1243,7 @@ bool AudiobookshelfClient::fetchLibraryPersonalized(const std::string& libraryId
     req.method = "GET";
     req.headers["Accept"] = "application/json";
     req.headers["Authorization"] = "Bearer " + m_authToken;
+    req.cacheTtl = CACHE_TTL_SHELVES;
 
     HttpResponse resp = client.request(req);
 
@@ -1048,13 +1272,7 @@ bool AudiobookshelfClient::fetchLibraryPersonalized(const std::string& libraryId
             continue;
         }
 
-        int braceCount = 1;
-        size_t objEnd = objStart + 1;
-        while (braceCount > 0 && objEnd < resp.body.length()) {
-            if (resp.body[objEnd] == '{') braceCount++;
-            else if (resp.body[objEnd] == '}') braceCount--;
-            objEnd++;
-        }
+        size_t objEnd = findJsonContainerEnd(resp.body, objStart);
 
         std::string obj = resp.body.substr(objStart, objEnd - objStart);
 
@@ -1065,7 +1283,7 @@ bool AudiobookshelfClient::fetchLibraryPersonalized(const std::string& libraryId
         shelf.type = extractJsonValue(obj, "type");
 
         // Parse entities array
-        std::string entitiesArray = extractJsonArray(obj, "entities");
+        std::string_view entitiesArray = extractJsonArray(obj, "entities");
         if (!entitiesArray.empty()) {
             size_t entPos = 0;
             while ((entPos = entitiesArray.find("\"id\"", entPos)) != std::string::npos) {
@@ -1083,7 +1301,7 @@ bool AudiobookshelfClient::fetchLibraryPersonalized(const std::string& libraryId
                     entEnd++;
                 }
 
-                std::string entObj = entitiesArray.substr(entStart, entEnd - entStart);
+                std::string_view entObj = entitiesArray.substr(entStart, entEnd - entStart);
                 MediaItem item = parseMediaItem(entObj);
 
                 // Set mediaType from library if not set
@@ -1093,7 +1311,7 @@ bool AudiobookshelfClient::fetchLibraryPersonalized(const std::string& libraryId
                 }
 
                 if (!item.id.empty() && !item.title.empty()) {
-                    shelf.entities.push_back(item);
+                    shelf.entities.push_back(std::move(item));
                 }
 
                 entPos = entEnd;
@@ -1122,6 +1340,7 @@ bool AudiobookshelfClient::fetchLibrarySeries(const std::string& libraryId, std:
     req.method = "GET";
     req.headers["Accept"] = "application/json";
     req.headers["Authorization"] = "Bearer " + m_authToken;
+    req.cacheTtl = CACHE_TTL_BROWSE;
 
     HttpResponse resp = client.request(req);
 
@@ -1132,7 +1351,7 @@ bool AudiobookshelfClient::fetchLibrarySeries(const std::string& libraryId, std:
 
     series.clear();
 
-    std::string resultsArray = extractJsonArray(resp.body, "results");
+    std::string_view resultsArray = extractJsonArray(resp.body, "results");
     if (resultsArray.empty()) {
         resultsArray = resp.body;
     }
@@ -1145,15 +1364,9 @@ bool AudiobookshelfClient::fetchLibrarySeries(const std::string& libraryId, std:
             continue;
         }
 
-        int braceCount = 1;
-        size_t objEnd = objStart + 1;
-        while (braceCount > 0 && objEnd < resultsArray.length()) {
-            if (resultsArray[objEnd] == '{') braceCount++;
-            else if (resultsArray[objEnd] == '}') braceCount--;
-            objEnd++;
-        }
+        size_t objEnd = findJsonContainerEnd(resultsArray, objStart);
 
-        std::string obj = resultsArray.substr(objStart, objEnd - objStart);
+        std::string_view obj = resultsArray.substr(objStart, objEnd - objStart);
 
         Series s;
         s.id = extractJsonValue(obj, "id");
@@ -1179,6 +1392,7 @@ bool AudiobookshelfClient::fetchLibraryCollections(const std::string& libraryId,
     req.method = "GET";
     req.headers["Accept"] = "application/json";
     req.headers["Authorization"] = "Bearer " + m_authToken;
+    req.cacheTtl = CACHE_TTL_BROWSE;
 
     HttpResponse resp = client.request(req);
 
@@ -1189,7 +1403,7 @@ bool AudiobookshelfClient::fetchLibraryCollections(const std::string& libraryId,
 
     collections.clear();
 
-    std::string resultsArray = extractJsonArray(resp.body, "results");
+    std::string_view resultsArray = extractJsonArray(resp.body, "results");
     if (resultsArray.empty()) {
         resultsArray = resp.body;
     }
@@ -1202,15 +1416,9 @@ bool AudiobookshelfClient::fetchLibraryCollections(const std::string& libraryId,
             continue;
         }
 
-        int braceCount = 1;
-        size_t objEnd = objStart + 1;
-        while (braceCount > 0 && objEnd < resultsArray.length()) {
-            if (resultsArray[objEnd] == '{') braceCount++;
-            else if (resultsArray[objEnd] == '}') braceCount--;
-            objEnd++;
-        }
+        size_t objEnd = findJsonContainerEnd(resultsArray, objStart);
 
-        std::string obj = resultsArray.substr(objStart, objEnd - objStart);
+        std::string_view obj = resultsArray.substr(objStart, objEnd - objStart);
 
         Collection c;
         c.id = extractJsonValue(obj, "id");
@@ -1239,6 +1447,7 @@ bool AudiobookshelfClient::fetchLibraryAuthors(const std::string& libraryId, std
     req.method = "GET";
     req.headers["Accept"] = "application/json";
     req.headers["Authorization"] = "Bearer " + m_authToken;
+    req.cacheTtl = CACHE_TTL_BROWSE;
 
     HttpResponse resp = client.request(req);
 
@@ -1249,7 +1458,7 @@ bool AudiobookshelfClient::fetchLibraryAuthors(const std::string& libraryId, std
 
     authors.clear();
 
-    std::string authorsArray = extractJsonArray(resp.body, "authors");
+    std::string_view authorsArray = extractJsonArray(resp.body, "authors");
     if (authorsArray.empty()) {
         authorsArray = resp.body;
     }
@@ -1262,15 +1471,9 @@ bool AudiobookshelfClient::fetchLibraryAuthors(const std::string& libraryId, std
             continue;
         }
 
-        int braceCount = 1;
-        size_t objEnd = objStart + 1;
-        while (braceCount > 0 && objEnd < authorsArray.length()) {
-            if (authorsArray[objEnd] == '{') braceCount++;
-            else if (authorsArray[objEnd] == '}') braceCount--;
-            objEnd++;
-        }
+        size_t objEnd = findJsonContainerEnd(authorsArray, objStart);
 
-        std::string obj = authorsArray.substr(objStart, objEnd - objStart);
+        std::string_view obj = authorsArray.substr(objStart, objEnd - objStart);
 
         Author a;
         a.id = extractJsonValue(obj, "id");
@@ -1300,10 +1503,11 @@ bool AudiobookshelfClient::fetchRecentlyAdded(const std::string& libraryId, std:
     // Use library items with sort by addedAt descending
     HttpClient client;
     HttpRequest req;
-    req.url = buildApiUrl("/api/libraries/" + libraryId + "/items?sort=addedAt&desc=1&limit=50");
+    req.url = buildApiUrl("/api/libraries/" + libraryId + "/items?minified=1&sort=addedAt&desc=1&limit=50");
     req.method = "GET";
     req.headers["Accept"] = "application/json";
     req.headers["Authorization"] = "Bearer " + m_authToken;
+    req.cacheTtl = CACHE_TTL_SHELVES;
 
     HttpResponse resp = client.request(req);
 
@@ -1314,7 +1518,7 @@ bool AudiobookshelfClient::fetchRecentlyAdded(const std::string& libraryId, std:
 
     items.clear();
 
-    std::string resultsArray = extractJsonArray(resp.body, "results");
+    std::string_view resultsArray = extractJsonArray(resp.body, "results");
     if (resultsArray.empty()) {
         resultsArray = resp.body;
     }
@@ -1327,15 +1531,9 @@ bool AudiobookshelfClient::fetchRecentlyAdded(const std::string& libraryId, std:
             continue;
         }
 
-        int braceCount = 1;
-        size_t objEnd = objStart + 1;
-        while (braceCount > 0 && objEnd < resultsArray.length()) {
-            if (resultsArray[objEnd] == '{') braceCount++;
-            else if (resultsArray[objEnd] == '}') braceCount--;
-            objEnd++;
-        }
+        size_t objEnd = findJsonContainerEnd(resultsArray, objStart);
 
-        std::string obj = resultsArray.substr(objStart, objEnd - objStart);
+        std::string_view obj = resultsArray.substr(objStart, objEnd - objStart);
         MediaItem item = parseMediaItem(obj);
 
         // Set mediaType from library if not set
@@ -1345,7 +1543,7 @@ bool AudiobookshelfClient::fetchRecentlyAdded(const std::string& libraryId, std:
         }
 
         if (!item.id.empty() && !item.title.empty()) {
-            items.push_back(item);
+            items.push_back(std::move(item));
         }
 
         pos = objEnd;
@@ -1377,8 +1575,16 @@ bool AudiobookshelfClient::fetchItem(const std::string& itemId, MediaItem& item)
 
     item = parseMediaItem(resp.body);
 
+    parseItemDetails(resp.body, item);
+
+    brls::Logger::info("Fetched item: {} ({} chapters, {} tracks)",
+                        item.title, item.chapters.size(), item.audioTracks.size());
+    return true;
+}
+
+void AudiobookshelfClient::parseItemDetails(std::string_view json, MediaItem& item) {
     // Extract media object for chapters and tracks
-    std::string mediaObj = extractJsonObject(resp.body, "media");
+    std::string_view mediaObj = extractJsonObject(json, "media");
     brls::Logger::debug("Media object found: {} ({} chars)", !mediaObj.empty() ? "yes" : "no", mediaObj.length());
 
     // Podcasts use episodes[].audioFile, not media.audioFiles or media.chapters
@@ -1386,7 +1592,7 @@ bool AudiobookshelfClient::fetchItem(const std::string& itemId, MediaItem& item)
     bool isPodcast = (item.mediaType == MediaType::PODCAST || item.mediaType == MediaType::PODCAST_EPISODE);
 
     // Parse chapters from media.chapters (audiobooks only - podcasts don't have chapters at media level)
-    std::string chaptersArray;
+    std::string_view chaptersArray;
     if (!isPodcast) {
         chaptersArray = extractJsonArray(mediaObj, "chapters");
     }
@@ -1410,15 +1616,9 @@ bool AudiobookshelfClient::fetchItem(const std::string& itemId, MediaItem& item)
             }
 
             // Find the end of this chapter object
-            int braceCount = 1;
-            size_t objEnd = objStart + 1;
-            while (braceCount > 0 && objEnd < chaptersArray.length()) {
-                if (chaptersArray[objEnd] == '{') braceCount++;
-                else if (chaptersArray[objEnd] == '}') braceCount--;
-                objEnd++;
-            }
+            size_t objEnd = findJsonContainerEnd(chaptersArray, objStart);
 
-            std::string chObj = chaptersArray.substr(objStart, objEnd - objStart);
+            std::string_view chObj = chaptersArray.substr(objStart, objEnd - objStart);
             Chapter ch = parseChapter(chObj);
 
             // Add chapter if it looks valid
@@ -1437,22 +1637,16 @@ bool AudiobookshelfClient::fetchItem(const std::string& itemId, MediaItem& item)
 
     // If no chapters found in media.chapters, check audioFiles[0].chapters (M4B audiobooks)
     if (item.chapters.empty() && !mediaObj.empty() && !isPodcast) {
-        std::string audioFilesArray = extractJsonArray(mediaObj, "audioFiles");
+        std::string_view audioFilesArray = extractJsonArray(mediaObj, "audioFiles");
         if (!audioFilesArray.empty()) {
             // Get first audio file object
             size_t firstObjStart = audioFilesArray.find('{');
             if (firstObjStart != std::string::npos) {
-                int braceCount = 1;
-                size_t firstObjEnd = firstObjStart + 1;
-                while (braceCount > 0 && firstObjEnd < audioFilesArray.length()) {
-                    if (audioFilesArray[firstObjEnd] == '{') braceCount++;
-                    else if (audioFilesArray[firstObjEnd] == '}') braceCount--;
-                    firstObjEnd++;
-                }
-                std::string firstAudioFile = audioFilesArray.substr(firstObjStart, firstObjEnd - firstObjStart);
+                size_t firstObjEnd = findJsonContainerEnd(audioFilesArray, firstObjStart);
+                std::string_view firstAudioFile = audioFilesArray.substr(firstObjStart, firstObjEnd - firstObjStart);
 
                 // Try to get chapters from this audio file using extractJsonArray
-                std::string afChaptersArray = extractJsonArray(firstAudioFile, "chapters");
+                std::string_view afChaptersArray = extractJsonArray(firstAudioFile, "chapters");
                 if (!afChaptersArray.empty() && afChaptersArray != "[]") {
                     brls::Logger::debug("Found chapters in audioFiles[0]: {} chars", afChaptersArray.length());
                     size_t pos = 0;
@@ -1468,7 +1662,7 @@ bool AudiobookshelfClient::fetchItem(const std::string& itemId, MediaItem& item)
                             objEnd++;
                         }
 
-                        std::string chObj = afChaptersArray.substr(objStart, objEnd - objStart);
+                        std::string_view chObj = afChaptersArray.substr(objStart, objEnd - objStart);
                         Chapter ch = parseChapter(chObj);
                         if (ch.end > ch.start) {
                             item.chapters.push_back(ch);
@@ -1488,9 +1682,9 @@ bool AudiobookshelfClient::fetchItem(const std::string& itemId, MediaItem& item)
     }
 
     // Parse audio tracks (audiobooks use media.audioFiles, podcasts use episodes[].audioFile)
-    std::string tracksArray;
+    std::string_view tracksArray;
     if (!isPodcast) {
-        tracksArray = extractJsonArray(resp.body, "audioFiles");
+        tracksArray = extractJsonArray(json, "audioFiles");
         if (tracksArray.empty() && !mediaObj.empty()) {
             tracksArray = extractJsonArray(mediaObj, "audioFiles");
         }
@@ -1505,18 +1699,12 @@ bool AudiobookshelfClient::fetchItem(const std::string& itemId, MediaItem& item)
                 continue;
             }
 
-            int braceCount = 1;
-            size_t objEnd = objStart + 1;
-            while (braceCount > 0 && objEnd < tracksArray.length()) {
-                if (tracksArray[objEnd] == '{') braceCount++;
-                else if (tracksArray[objEnd] == '}') braceCount--;
-                objEnd++;
-            }
+            size_t objEnd = findJsonContainerEnd(tracksArray, objStart);
 
-            std::string trackObj = tracksArray.substr(objStart, objEnd - objStart);
+            std::string_view trackObj = tracksArray.substr(objStart, objEnd - objStart);
             AudioTrack track;
             track.index = trackIdx++;
-            std::string metaObj = extractJsonObject(trackObj, "metadata");
+            std::string_view metaObj = extractJsonObject(trackObj, "metadata");
             track.title = extractJsonValue(trackObj, "metadata");
             if (track.title.empty() && !metaObj.empty()) {
                 // Try getting filename from metadata object
@@ -1573,10 +1761,54 @@ bool AudiobookshelfClient::fetchItem(const std::string& itemId, MediaItem& item)
         }
         brls::Logger::info("Created {} chapters from audio files", item.chapters.size());
     }
+}
 
-    brls::Logger::info("Fetched item: {} ({} chapters, {} tracks)",
-                        item.title, item.chapters.size(), item.audioTracks.size());
-    return true;
+bool AudiobookshelfClient::fetchItemsBatch(const std::vector<std::string>& itemIds, std::vector<MediaItem>& items) {
+    items.clear();
+    if (itemIds.empty()) return true;
+
+    brls::Logger::debug("Batch fetching {} items", itemIds.size());
+
+    bool anySucceeded = false;
+    for (size_t chunkStart = 0; chunkStart < itemIds.size(); chunkStart += BATCH_GET_CHUNK_SIZE) {
+        size_t chunkEnd = std::min(itemIds.size(), chunkStart + BATCH_GET_CHUNK_SIZE);
+
+        std::string body = "{\"libraryItemIds\":[";
+        for (size_t i = chunkStart; i < chunkEnd; i++) {
+            if (i > chunkStart) body += ",";
+            body += "\"" + itemIds[i] + "\"";
+        }
+        body += "]}";
+
+        HttpClient client;
+        HttpRequest req;
+        req.url = buildApiUrl("/api/items/batch/get");
+        req.method = "POST";
+        req.body = body;
+        req.headers["Content-Type"] = "application/json";
+        req.headers["Accept"] = "application/json";
+        req.headers["Authorization"] = "Bearer " + m_authToken;
+
+        HttpResponse resp = client.request(req);
+
+        if (resp.statusCode != 200) {
+            brls::Logger::error("Failed to batch fetch items {}-{}: {}", chunkStart, chunkEnd, resp.statusCode);
+            continue;
+        }
+        anySucceeded = true;
+
+        // Items the server doesn't know are left out of the response
+        std::string_view itemsArray = extractJsonArray(resp.body, "libraryItems");
+        forEachItemObject(itemsArray, [&](std::string_view obj) {
+            MediaItem item = parseMediaItem(obj);
+            if (item.id.empty()) return;
+            parseItemDetails(obj, item);
+            items.push_back(std::move(item));
+        });
+    }
+
+    brls::Logger::info("Batch fetched {} of {} items", items.size(), itemIds.size());
+    return anySucceeded;
 }
 
 bool AudiobookshelfClient::fetchItemWithProgress(const std::string& itemId, MediaItem& item) {
@@ -1599,26 +1831,20 @@ bool AudiobookshelfClient::fetchItemWithProgress(const std::string& itemId, Medi
     item = parseMediaItem(resp.body);
 
     // Extract chapters from media.chapters (audiobooks only - podcasts don't have these)
-    std::string mediaObj = extractJsonObject(resp.body, "media");
+    std::string_view mediaObj = extractJsonObject(resp.body, "media");
     bool isPodcastItem = (item.mediaType == MediaType::PODCAST || item.mediaType == MediaType::PODCAST_EPISODE);
     if (!mediaObj.empty() && !isPodcastItem) {
         // First try media.chapters
-        std::string chaptersArray = extractJsonArray(mediaObj, "chapters");
+        std::string_view chaptersArray = extractJsonArray(mediaObj, "chapters");
         if (!chaptersArray.empty() && chaptersArray != "[]") {
             size_t pos = 0;
             while ((pos = chaptersArray.find("\"start\"", pos)) != std::string::npos) {
                 size_t objStart = chaptersArray.rfind('{', pos);
                 if (objStart == std::string::npos) { pos++; continue; }
 
-                int braceCount = 1;
-                size_t objEnd = objStart + 1;
-                while (braceCount > 0 && objEnd < chaptersArray.length()) {
-                    if (chaptersArray[objEnd] == '{') braceCount++;
-                    else if (chaptersArray[objEnd] == '}') braceCount--;
-                    objEnd++;
-                }
+                size_t objEnd = findJsonContainerEnd(chaptersArray, objStart);
 
-                std::string chObj = chaptersArray.substr(objStart, objEnd - objStart);
+                std::string_view chObj = chaptersArray.substr(objStart, objEnd - objStart);
                 Chapter ch = parseChapter(chObj);
                 if (ch.end > ch.start) {
                     item.chapters.push_back(ch);
@@ -1630,20 +1856,14 @@ bool AudiobookshelfClient::fetchItemWithProgress(const std::string& itemId, Medi
 
         // If no chapters found, check audioFiles[0].chapters (M4B audiobooks)
         if (item.chapters.empty()) {
-            std::string audioFilesArray = extractJsonArray(mediaObj, "audioFiles");
+            std::string_view audioFilesArray = extractJsonArray(mediaObj, "audioFiles");
             if (!audioFilesArray.empty()) {
                 size_t firstObjStart = audioFilesArray.find('{');
                 if (firstObjStart != std::string::npos) {
-                    int braceCount = 1;
-                    size_t firstObjEnd = firstObjStart + 1;
-                    while (braceCount > 0 && firstObjEnd < audioFilesArray.length()) {
-                        if (audioFilesArray[firstObjEnd] == '{') braceCount++;
-                        else if (audioFilesArray[firstObjEnd] == '}') braceCount--;
-                        firstObjEnd++;
-                    }
-                    std::string firstAudioFile = audioFilesArray.substr(firstObjStart, firstObjEnd - firstObjStart);
+                    size_t firstObjEnd = findJsonContainerEnd(audioFilesArray, firstObjStart);
+                    std::string_view firstAudioFile = audioFilesArray.substr(firstObjStart, firstObjEnd - firstObjStart);
 
-                    std::string afChaptersArray = extractJsonArray(firstAudioFile, "chapters");
+                    std::string_view afChaptersArray = extractJsonArray(firstAudioFile, "chapters");
                     if (!afChaptersArray.empty() && afChaptersArray != "[]") {
                         size_t pos = 0;
                         while ((pos = afChaptersArray.find("\"start\"", pos)) != std::string::npos) {
@@ -1658,7 +1878,7 @@ bool AudiobookshelfClient::fetchItemWithProgress(const std::string& itemId, Medi
                                 objEnd++;
                             }
 
-                            std::string chObj = afChaptersArray.substr(objStart, objEnd - objStart);
+                            std::string_view chObj = afChaptersArray.substr(objStart, objEnd - objStart);
                             Chapter ch = parseChapter(chObj);
                             if (ch.end > ch.start) {
                                 item.chapters.push_back(ch);
@@ -1675,7 +1895,8 @@ bool AudiobookshelfClient::fetchItemWithProgress(const std::string& itemId, Medi
     return true;
 }
 
-bool AudiobookshelfClient::search(const std::string& libraryId, const std::string& query, std::vector<MediaItem>& results) {
+bool AudiobookshelfClient::search(const std::string& libraryId, const std::string& query, std::vector<MediaItem>& results,
+                                  HttpCancelToken cancelToken) {
     brls::Logger::debug("Searching library {} for: {}", libraryId, query);
 
     HttpClient client;
@@ -1684,29 +1905,36 @@ bool AudiobookshelfClient::search(const std::string& libraryId, const std::strin
     req.method = "GET";
     req.headers["Accept"] = "application/json";
     req.headers["Authorization"] = "Bearer " + m_authToken;
+    req.cancelToken = cancelToken;
 
     HttpResponse resp = client.request(req);
 
+    if (resp.cancelled) {
+        brls::Logger::debug("Search of library {} cancelled", libraryId);
+        return false;
+    }
+
     if (resp.statusCode != 200) {
         brls::Logger::error("Search failed: {}", resp.statusCode);
         return false;
     }
 
     results.clear();
+    AllocCounter parseAllocs;
 
     // Parse book results
-    std::string booksArray = extractJsonArray(resp.body, "book");
+    std::string_view booksArray = extractJsonArray(resp.body, "book");
     if (booksArray.empty()) {
         booksArray = extractJsonArray(resp.body, "books");
     }
     if (!booksArray.empty()) {
         size_t pos = 0;
         while ((pos = booksArray.find("\"libraryItem\"", pos)) != std::string::npos) {
-            std::string itemObj = extractJsonObject(booksArray.substr(pos), "libraryItem");
+            std::string_view itemObj = extractJsonObject(booksArray.substr(pos), "libraryItem");
             if (!itemObj.empty()) {
                 MediaItem item = parseMediaItem(itemObj);
                 if (!item.id.empty() && !item.title.empty()) {
-                    results.push_back(item);
+                    results.push_back(std::move(item));
                 }
             }
             pos++;
@@ -1714,18 +1942,18 @@ bool AudiobookshelfClient::search(const std::string& libraryId, const std::strin
     }
 
     // Also parse podcast results
-    std::string podcastsArray = extractJsonArray(resp.body, "podcast");
+    std::string_view podcastsArray = extractJsonArray(resp.body, "podcast");
     if (podcastsArray.empty()) {
         podcastsArray = extractJsonArray(resp.body, "podcasts");
     }
     if (!podcastsArray.empty()) {
         size_t pos = 0;
         while ((pos = podcastsArray.find("\"libraryItem\"", pos)) != std::string::npos) {
-            std::string itemObj = extractJsonObject(podcastsArray.substr(pos), "libraryItem");
+            std::string_view itemObj = extractJsonObject(podcastsArray.substr(pos), "libraryItem");
             if (!itemObj.empty()) {
                 MediaItem item = parseMediaItem(itemObj);
                 if (!item.id.empty() && !item.title.empty()) {
-                    results.push_back(item);
+                    results.push_back(std::move(item));
                 }
             }
             pos++;
@@ -1733,6 +1961,10 @@ bool AudiobookshelfClient::search(const std::string& libraryId, const std::strin
     }
 
     brls::Logger::info("Found {} search results for '{}'", results.size(), query);
+    if (AllocCounter::enabled()) {
+        brls::Logger::debug("search: {} items parsed with {} allocations",
+                           results.size(), parseAllocs.count());
+    }
     return true;
 }
 
@@ -1782,16 +2014,13 @@ bool AudiobookshelfClient::startPlaybackSession(const std::string& itemId, Playb
         return false;
     }
 
-    session.id = extractJsonValue(resp.body, "id");
+    session = parsePlaybackSession(resp.body);
     session.libraryItemId = itemId;
     session.episodeId = episodeId;
-    session.currentTime = extractJsonFloat(resp.body, "currentTime");
-    session.duration = extractJsonFloat(resp.body, "duration");
-    session.playMethod = extractJsonValue(resp.body, "playMethod");
 
     // Parse audioTracks array to get streaming URLs
     session.audioTracks.clear();
-    std::string tracksArray = extractJsonArray(resp.body, "audioTracks");
+    std::string_view tracksArray = extractJsonArray(resp.body, "audioTracks");
     brls::Logger::debug("audioTracks array length: {}", tracksArray.length());
 
     // Debug: show preview of audioTracks array
@@ -1817,28 +2046,14 @@ bool AudiobookshelfClient::startPlaybackSession(const std::string& itemId, Playb
             }
 
             size_t objStart = pos;
-            int braceCount = 1;
-            pos++; // Move past opening brace
-
-            // Find matching closing brace
-            while (braceCount > 0 && pos < tracksArray.length()) {
-                if (tracksArray[pos] == '{') braceCount++;
-                else if (tracksArray[pos] == '}') braceCount--;
-                pos++;
-            }
+            pos = findJsonContainerEnd(tracksArray, objStart);
 
-            std::string trackObj = tracksArray.substr(objStart, pos - objStart);
+            std::string_view trackObj = tracksArray.substr(objStart, pos - objStart);
             trackCount++;
             brls::Logger::debug("Track #{} object ({} chars): {}", trackCount, trackObj.length(),
                                trackObj.substr(0, std::min((size_t)200, trackObj.length())));
 
-            AudioTrack track;
-            track.index = extractJsonInt(trackObj, "index");
-            track.title = extractJsonValue(trackObj, "title");
-            track.contentUrl = extractJsonValue(trackObj, "contentUrl");
-            track.startOffset = extractJsonFloat(trackObj, "startOffset");
-            track.duration = extractJsonFloat(trackObj, "duration");
-            track.mimeType = extractJsonValue(trackObj, "mimeType");
+            AudioTrack track = parseAudioTrack(trackObj);
 
             brls::Logger::debug("Parsed track: index={}, title={}, duration={}, contentUrl={}",
                                track.index, track.title, track.duration, track.contentUrl);
@@ -1882,7 +2097,10 @@ bool AudiobookshelfClient::syncPlaybackSession(const std::string& sessionId, flo
     req.body = body;
 
     HttpResponse resp = client.request(req);
-    return resp.statusCode == 200;
+    if (resp.statusCode != 200) return false;
+
+    invalidateProgressCaches();
+    return true;
 }
 
 bool AudiobookshelfClient::closePlaybackSession(const std::string& sessionId, float currentTime,
@@ -1904,7 +2122,10 @@ bool AudiobookshelfClient::closePlaybackSession(const std::string& sessionId, fl
     req.body = body;
 
     HttpResponse resp = client.request(req);
-    return resp.statusCode == 200;
+    if (resp.statusCode != 200) return false;
+
+    invalidateProgressCaches();
+    return true;
 }
 
 std::string AudiobookshelfClient::getStreamUrl(const std::string& itemId, const std::string& episodeId) {
@@ -1958,7 +2179,7 @@ std::string AudiobookshelfClient::getFileDownloadUrl(const std::string& itemId,
     brls::Logger::debug("Response length: {} chars", resp.body.length());
 
     std::string fileIno;
-    std::string mediaObj = extractJsonObject(resp.body, "media");
+    std::string_view mediaObj = extractJsonObject(resp.body, "media");
 
     if (mediaObj.empty()) {
         brls::Logger::error("Media object not found in response");
@@ -1972,7 +2193,7 @@ std::string AudiobookshelfClient::getFileDownloadUrl(const std::string& itemId,
         // Kodi: episodes = item.get('media', {}).get('episodes', [])
         brls::Logger::info("Looking for podcast episode: {}", episodeId);
 
-        std::string episodesArray = extractJsonArray(mediaObj, "episodes");
+        std::string_view episodesArray = extractJsonArray(mediaObj, "episodes");
         brls::Logger::debug("Episodes array: {} chars", episodesArray.length());
 
         if (!episodesArray.empty()) {
@@ -1981,22 +2202,16 @@ std::string AudiobookshelfClient::getFileDownloadUrl(const std::string& itemId,
                 size_t objStart = episodesArray.rfind('{', pos);
                 if (objStart == std::string::npos) { pos++; continue; }
 
-                int braceCount = 1;
-                size_t objEnd = objStart + 1;
-                while (braceCount > 0 && objEnd < episodesArray.length()) {
-                    if (episodesArray[objEnd] == '{') braceCount++;
-                    else if (episodesArray[objEnd] == '}') braceCount--;
-                    objEnd++;
-                }
+                size_t objEnd = findJsonContainerEnd(episodesArray, objStart);
 
-                std::string epObj = episodesArray.substr(objStart, objEnd - objStart);
+                std::string_view epObj = episodesArray.substr(objStart, objEnd - objStart);
                 std::string epId = extractJsonValue(epObj, "id");
 
                 if (epId == episodeId) {
                     brls::Logger::info("Found episode: {}", episodeId);
                     // Kodi: audio_file = episode_data['audioFile']
                     //       ino = audio_file.get('ino')
-                    std::string audioFileObj = extractJsonObject(epObj, "audioFile");
+                    std::string_view audioFileObj = extractJsonObject(epObj, "audioFile");
                     if (!audioFileObj.empty()) {
                         fileIno = extractJsonValue(audioFileObj, "ino");
                         brls::Logger::info("Episode audio file ino: {}", fileIno);
@@ -2021,21 +2236,15 @@ std::string AudiobookshelfClient::getFileDownloadUrl(const std::string& itemId,
         //       ino = sorted_files[0].get('ino')
         brls::Logger::info("Looking for audiobook audio files");
 
-        std::string audioFilesArray = extractJsonArray(mediaObj, "audioFiles");
+        std::string_view audioFilesArray = extractJsonArray(mediaObj, "audioFiles");
         brls::Logger::debug("audioFiles array: {} chars", audioFilesArray.length());
 
         if (!audioFilesArray.empty()) {
             // Find first audio file (lowest index)
             size_t objStart = audioFilesArray.find('{');
             if (objStart != std::string::npos) {
-                int braceCount = 1;
-                size_t objEnd = objStart + 1;
-                while (braceCount > 0 && objEnd < audioFilesArray.length()) {
-                    if (audioFilesArray[objEnd] == '{') braceCount++;
-                    else if (audioFilesArray[objEnd] == '}') braceCount--;
-                    objEnd++;
-                }
-                std::string firstFile = audioFilesArray.substr(objStart, objEnd - objStart);
+                size_t objEnd = findJsonContainerEnd(audioFilesArray, objStart);
+                std::string_view firstFile = audioFilesArray.substr(objStart, objEnd - objStart);
                 fileIno = extractJsonValue(firstFile, "ino");
                 brls::Logger::info("First audio file ino: {}", fileIno);
             }
@@ -2046,18 +2255,12 @@ std::string AudiobookshelfClient::getFileDownloadUrl(const std::string& itemId,
         //       content_url = tracks[0].get('contentUrl')
         if (fileIno.empty()) {
             brls::Logger::debug("No ino found, checking tracks for contentUrl");
-            std::string tracksArray = extractJsonArray(mediaObj, "tracks");
+            std::string_view tracksArray = extractJsonArray(mediaObj, "tracks");
             if (!tracksArray.empty()) {
                 size_t objStart = tracksArray.find('{');
                 if (objStart != std::string::npos) {
-                    int braceCount = 1;
-                    size_t objEnd = objStart + 1;
-                    while (braceCount > 0 && objEnd < tracksArray.length()) {
-                        if (tracksArray[objEnd] == '{') braceCount++;
-                        else if (tracksArray[objEnd] == '}') braceCount--;
-                        objEnd++;
-                    }
-                    std::string firstTrack = tracksArray.substr(objStart, objEnd - objStart);
+                    size_t objEnd = findJsonContainerEnd(tracksArray, objStart);
+                    std::string_view firstTrack = tracksArray.substr(objStart, objEnd - objStart);
                     std::string contentUrl = extractJsonValue(firstTrack, "contentUrl");
                     if (!contentUrl.empty()) {
                         // Use contentUrl directly
@@ -2072,7 +2275,7 @@ std::string AudiobookshelfClient::getFileDownloadUrl(const std::string& itemId,
         // Fallback to libraryFiles if audioFiles doesn't have ino
         if (fileIno.empty()) {
             brls::Logger::debug("Trying libraryFiles fallback");
-            std::string libFilesArray = extractJsonArray(resp.body, "libraryFiles");
+            std::string_view libFilesArray = extractJsonArray(resp.body, "libraryFiles");
             if (!libFilesArray.empty()) {
                 // Find first audio file
                 size_t pos = 0;
@@ -2080,15 +2283,9 @@ std::string AudiobookshelfClient::getFileDownloadUrl(const std::string& itemId,
                     size_t objStart = libFilesArray.rfind('{', pos);
                     if (objStart == std::string::npos) { pos++; continue; }
 
-                    int braceCount = 1;
-                    size_t objEnd = objStart + 1;
-                    while (braceCount > 0 && objEnd < libFilesArray.length()) {
-                        if (libFilesArray[objEnd] == '{') braceCount++;
-                        else if (libFilesArray[objEnd] == '}') braceCount--;
-                        objEnd++;
-                    }
+                    size_t objEnd = findJsonContainerEnd(libFilesArray, objStart);
 
-                    std::string fileObj = libFilesArray.substr(objStart, objEnd - objStart);
+                    std::string_view fileObj = libFilesArray.substr(objStart, objEnd - objStart);
                     std::string fileType = extractJsonValue(fileObj, "fileType");
 
                     // Check if it's an audio file
@@ -2135,8 +2332,8 @@ bool AudiobookshelfClient::getAudioFiles(const std::string& itemId, std::vector<
         return false;
     }
 
-    std::string mediaObj = extractJsonObject(resp.body, "media");
-    std::string audioFilesArray = extractJsonArray(mediaObj, "audioFiles");
+    std::string_view mediaObj = extractJsonObject(resp.body, "media");
+    std::string_view audioFilesArray = extractJsonArray(mediaObj, "audioFiles");
 
     if (audioFilesArray.empty()) {
         brls::Logger::debug("No audio files in item");
@@ -2149,30 +2346,10 @@ bool AudiobookshelfClient::getAudioFiles(const std::string& itemId, std::vector<
         size_t objStart = audioFilesArray.find('{', pos);
         if (objStart == std::string::npos) break;
 
-        int braceCount = 1;
-        size_t objEnd = objStart + 1;
-        while (braceCount > 0 && objEnd < audioFilesArray.length()) {
-            if (audioFilesArray[objEnd] == '{') braceCount++;
-            else if (audioFilesArray[objEnd] == '}') braceCount--;
-            objEnd++;
-        }
-
-        std::string fileObj = audioFilesArray.substr(objStart, objEnd - objStart);
+        size_t objEnd = findJsonContainerEnd(audioFilesArray, objStart);
 
-        AudioFileInfo info;
-        info.ino = extractJsonValue(fileObj, "ino");
-        info.index = extractJsonInt(fileObj, "index");
-
-        // Get metadata from nested object
-        std::string metadataObj = extractJsonObject(fileObj, "metadata");
-        if (!metadataObj.empty()) {
-            info.filename = extractJsonValue(metadataObj, "filename");
-            // Use int64 for file size to support files > 2GB
-            info.size = extractJsonInt64(metadataObj, "size");
-        }
-
-        info.duration = extractJsonFloat(fileObj, "duration");
-        info.mimeType = extractJsonValue(fileObj, "mimeType");
+        std::string_view fileObj = audioFilesArray.substr(objStart, objEnd - objStart);
+        AudioFileInfo info = parseAudioFileInfo(fileObj);
 
         if (!info.ino.empty()) {
             files.push_back(info);
@@ -2191,6 +2368,128 @@ bool AudiobookshelfClient::getAudioFiles(const std::string& itemId, std::vector<
     return !files.empty();
 }
 
+AudioFileInfo AudiobookshelfClient::parseAudioFileInfo(std::string_view json) {
+    AudioFileInfo info;
+    info.ino = extractJsonValue(json, "ino");
+    info.index = extractJsonInt(json, "index");
+
+    // Get metadata from nested object
+    std::string_view metadataObj = extractJsonObject(json, "metadata");
+    if (!metadataObj.empty()) {
+        info.filename = extractJsonValue(metadataObj, "filename");
+        // Use int64 for file size to support files > 2GB
+        info.size = extractJsonInt64(metadataObj, "size");
+    }
+
+    info.duration = extractJsonFloat(json, "duration");
+    info.mimeType = extractJsonValue(json, "mimeType");
+    return info;
+}
+
+bool AudiobookshelfClient::fetchDownloadPlan(const std::string& itemId, const std::string& episodeId,
+                                              DownloadPlan& plan) {
+    brls::Logger::debug("Fetching download plan: item={}, episode={}",
+                        itemId, episodeId.empty() ? "(none)" : episodeId);
+
+    HttpClient client;
+    HttpRequest req;
+    req.url = buildApiUrl("/api/items/" + itemId + "?expanded=1");
+    req.method = "GET";
+    req.headers["Accept"] = "application/json";
+    req.headers["Authorization"] = "Bearer " + m_authToken;
+
+    HttpResponse resp = client.request(req);
+
+    if (resp.statusCode != 200) {
+        brls::Logger::error("Failed to fetch download plan: {}", resp.statusCode);
+        return false;
+    }
+
+    plan = DownloadPlan();
+    plan.itemId = itemId;
+    plan.episodeId = episodeId;
+    plan.item = parseMediaItem(resp.body);
+    parseItemDetails(resp.body, plan.item);
+    plan.coverUrl = getCoverUrl(itemId);
+
+    std::string_view mediaObj = extractJsonObject(resp.body, "media");
+
+    if (!episodeId.empty()) {
+        // Podcast episode - its single file is episodes[].audioFile
+        std::string_view episodesArray = extractJsonArray(mediaObj, "episodes");
+        bool found = false;
+        forEachItemObject(episodesArray, [&](std::string_view epObj) {
+            if (found || extractJsonValue(epObj, "id") != episodeId) return;
+            found = true;
+
+            std::string_view audioFileObj = extractJsonObject(epObj, "audioFile");
+            if (!audioFileObj.empty()) {
+                plan.files.push_back(parseAudioFileInfo(audioFileObj));
+            } else {
+                brls::Logger::warning("Episode has no audioFile - not downloaded on server?");
+            }
+        });
+        if (!found) {
+            brls::Logger::error("Episode {} not found in episodes list", episodeId);
+        }
+    } else {
+        // Audiobook - every file of media.audioFiles, in index order
+        std::string_view audioFilesArray = extractJsonArray(mediaObj, "audioFiles");
+        size_t pos = 0;
+        while (true) {
+            size_t objStart = audioFilesArray.find('{', pos);
+            if (objStart == std::string::npos) break;
+
+            size_t objEnd = findJsonContainerEnd(audioFilesArray, objStart);
+            AudioFileInfo info = parseAudioFileInfo(audioFilesArray.substr(objStart, objEnd - objStart));
+            if (!info.ino.empty()) {
+                plan.files.push_back(std::move(info));
+            }
+            pos = objEnd;
+        }
+        std::sort(plan.files.begin(), plan.files.end(), [](const AudioFileInfo& a, const AudioFileInfo& b) {
+            return a.index < b.index;
+        });
+
+        // Fallback to the first audio file of libraryFiles
+        if (plan.files.empty()) {
+            std::string_view libFilesArray = extractJsonArray(resp.body, "libraryFiles");
+            size_t pos = 0;
+            while ((pos = libFilesArray.find("\"ino\"", pos)) != std::string::npos) {
+                size_t objStart = libFilesArray.rfind('{', pos);
+                if (objStart == std::string::npos) { pos++; continue; }
+
+                size_t objEnd = findJsonContainerEnd(libFilesArray, objStart);
+                std::string_view fileObj = libFilesArray.substr(objStart, objEnd - objStart);
+                if (extractJsonValue(fileObj, "fileType") == "audio") {
+                    plan.files.push_back(parseAudioFileInfo(fileObj));
+                    break;
+                }
+                pos = objEnd;
+            }
+        }
+    }
+
+    if (plan.files.empty()) {
+        brls::Logger::warning("No file ino found for item {}, will use direct stream URL", itemId);
+        plan.files.push_back(AudioFileInfo());
+    }
+    for (const auto& file : plan.files) {
+        plan.totalSize += file.size;
+    }
+
+    brls::Logger::info("Download plan for {}: {} files, {} bytes, {} chapters",
+                       itemId, plan.files.size(), plan.totalSize, plan.item.chapters.size());
+    return true;
+}
+
+std::string AudiobookshelfClient::getFileDownloadUrl(const DownloadPlan& plan, size_t fileIndex) {
+    if (fileIndex >= plan.files.size() || plan.files[fileIndex].ino.empty()) {
+        return getDirectStreamUrl(plan.itemId, static_cast<int>(fileIndex));
+    }
+    return getFileDownloadUrlByIno(plan.itemId, plan.files[fileIndex].ino);
+}
+
 std::string AudiobookshelfClient::getFileDownloadUrlByIno(const std::string& itemId, const std::string& ino) {
     std::string url = m_serverUrl + "/api/items/" + itemId + "/file/" + ino;
     url += "?token=" + m_authToken;
@@ -2220,7 +2519,10 @@ bool AudiobookshelfClient::updateProgress(const std::string& itemId, float curre
     req.body = body;
 
     HttpResponse resp = client.request(req);
-    return resp.statusCode == 200;
+    if (resp.statusCode != 200) return false;
+
+    invalidateProgressCaches();
+    return true;
 }
 
 bool AudiobookshelfClient::getProgress(const std::string& itemId, float& currentTime, float& progress,
@@ -2269,7 +2571,10 @@ bool AudiobookshelfClient::removeItemFromContinueListening(const std::string& it
     req.headers["Authorization"] = "Bearer " + m_authToken;
 
     HttpResponse resp = client.request(req);
-    return resp.statusCode == 200;
+    if (resp.statusCode != 200) return false;
+
+    invalidateProgressCaches();
+    return true;
 }
 
 bool AudiobookshelfClient::createBookmark(const std::string& itemId, float time, const std::string& title) {
@@ -2288,7 +2593,10 @@ bool AudiobookshelfClient::createBookmark(const std::string& itemId, float time,
     req.body = body;
 
     HttpResponse resp = client.request(req);
-    return resp.statusCode == 200;
+    if (resp.statusCode != 200) return false;
+
+    HttpCache::getInstance().invalidate("/api/me");
+    return true;
 }
 
 bool AudiobookshelfClient::deleteBookmark(const std::string& itemId, float time) {
@@ -2302,7 +2610,10 @@ bool AudiobookshelfClient::deleteBookmark(const std::string& itemId, float time)
     req.headers["Authorization"] = "Bearer " + m_authToken;
 
     HttpResponse resp = client.request(req);
-    return resp.statusCode == 200;
+    if (resp.statusCode != 200) return false;
+
+    HttpCache::getInstance().invalidate("/api/me");
+    return true;
 }
 
 std::string AudiobookshelfClient::getCoverUrl(const std::string& itemId, int width, int height) {
@@ -2337,6 +2648,7 @@ bool AudiobookshelfClient::fetchCollection(const std::string& collectionId, Coll
     req.method = "GET";
     req.headers["Accept"] = "application/json";
     req.headers["Authorization"] = "Bearer " + m_authToken;
+    req.cacheTtl = CACHE_TTL_BROWSE;
 
     HttpResponse resp = client.request(req);
 
@@ -2353,7 +2665,7 @@ bool AudiobookshelfClient::fetchCollection(const std::string& collectionId, Coll
     return true;
 }
 
-bool AudiobookshelfClient::fetchCollectionBooks(const std::string& collectionId, std::vector<MediaItem>& books) {
+bool AudiobookshelfClient::fetchCollectionBooks(const std::string& collectionId, std::vector<MediaItemSummary>& books) {
     brls::Logger::debug("Fetching collection books: {}", collectionId);
 
     HttpClient client;
@@ -2362,6 +2674,7 @@ bool AudiobookshelfClient::fetchCollectionBooks(const std::string& collectionId,
     req.method = "GET";
     req.headers["Accept"] = "application/json";
     req.headers["Authorization"] = "Bearer " + m_authToken;
+    req.cacheTtl = CACHE_TTL_BROWSE;
 
     HttpResponse resp = client.request(req);
 
@@ -2372,40 +2685,19 @@ bool AudiobookshelfClient::fetchCollectionBooks(const std::string& collectionId,
 
     books.clear();
 
-    std::string booksArray = extractJsonArray(resp.body, "books");
-    if (!booksArray.empty()) {
-        size_t pos = 0;
-        while ((pos = booksArray.find("\"id\"", pos)) != std::string::npos) {
-            size_t objStart = booksArray.rfind('{', pos);
-            if (objStart == std::string::npos) {
-                pos++;
-                continue;
-            }
-
-            int braceCount = 1;
-            size_t objEnd = objStart + 1;
-            while (braceCount > 0 && objEnd < booksArray.length()) {
-                if (booksArray[objEnd] == '{') braceCount++;
-                else if (booksArray[objEnd] == '}') braceCount--;
-                objEnd++;
-            }
-
-            std::string obj = booksArray.substr(objStart, objEnd - objStart);
-            MediaItem item = parseMediaItem(obj);
-
-            if (!item.id.empty() && !item.title.empty()) {
-                books.push_back(item);
-            }
-
-            pos = objEnd;
+    std::string_view booksArray = extractJsonArray(resp.body, "books");
+    forEachItemObject(booksArray, [&](std::string_view obj) {
+        MediaItemSummary item = parseMediaItemSummary(obj);
+        if (!item.id.empty() && !item.title.empty()) {
+            books.push_back(std::move(item));
         }
-    }
+    });
 
     brls::Logger::info("Found {} books in collection", books.size());
     return true;
 }
 
-bool AudiobookshelfClient::fetchSeriesBooks(const std::string& seriesId, std::vector<MediaItem>& books) {
+bool AudiobookshelfClient::fetchSeriesBooks(const std::string& seriesId, std::vector<MediaItemSummary>& books) {
     brls::Logger::debug("Fetching series books: {}", seriesId);
 
     HttpClient client;
@@ -2414,6 +2706,7 @@ bool AudiobookshelfClient::fetchSeriesBooks(const std::string& seriesId, std::ve
     req.method = "GET";
     req.headers["Accept"] = "application/json";
     req.headers["Authorization"] = "Bearer " + m_authToken;
+    req.cacheTtl = CACHE_TTL_BROWSE;
 
     HttpResponse resp = client.request(req);
 
@@ -2424,34 +2717,13 @@ bool AudiobookshelfClient::fetchSeriesBooks(const std::string& seriesId, std::ve
 
     books.clear();
 
-    std::string booksArray = extractJsonArray(resp.body, "books");
-    if (!booksArray.empty()) {
-        size_t pos = 0;
-        while ((pos = booksArray.find("\"id\"", pos)) != std::string::npos) {
-            size_t objStart = booksArray.rfind('{', pos);
-            if (objStart == std::string::npos) {
-                pos++;
-                continue;
-            }
-
-            int braceCount = 1;
-            size_t objEnd = objStart + 1;
-            while (braceCount > 0 && objEnd < booksArray.length()) {
-                if (booksArray[objEnd] == '{') braceCount++;
-                else if (booksArray[objEnd] == '}') braceCount--;
-                objEnd++;
-            }
-
-            std::string obj = booksArray.substr(objStart, objEnd - objStart);
-            MediaItem item = parseMediaItem(obj);
-
-            if (!item.id.empty() && !item.title.empty()) {
-                books.push_back(item);
-            }
-
-            pos = objEnd;
+    std::string_view booksArray = extractJsonArray(resp.body, "books");
+    forEachItemObject(booksArray, [&](std::string_view obj) {
+        MediaItemSummary item = parseMediaItemSummary(obj);
+        if (!item.id.empty() && !item.title.empty()) {
+            books.push_back(std::move(item));
         }
-    }
+    });
 
     brls::Logger::info("Found {} books in series", books.size());
     return true;
@@ -2466,6 +2738,7 @@ bool AudiobookshelfClient::fetchAuthor(const std::string& authorId, Author& auth
     req.method = "GET";
     req.headers["Accept"] = "application/json";
     req.headers["Authorization"] = "Bearer " + m_authToken;
+    req.cacheTtl = CACHE_TTL_BROWSE;
 
     HttpResponse resp = client.request(req);
 
@@ -2482,7 +2755,7 @@ bool AudiobookshelfClient::fetchAuthor(const std::string& authorId, Author& auth
     return true;
 }
 
-bool AudiobookshelfClient::fetchAuthorBooks(const std::string& authorId, std::vector<MediaItem>& books) {
+bool AudiobookshelfClient::fetchAuthorBooks(const std::string& authorId, std::vector<MediaItemSummary>& books) {
     brls::Logger::debug("Fetching author books: {}", authorId);
 
     HttpClient client;
@@ -2491,6 +2764,7 @@ bool AudiobookshelfClient::fetchAuthorBooks(const std::string& authorId, std::ve
     req.method = "GET";
     req.headers["Accept"] = "application/json";
     req.headers["Authorization"] = "Bearer " + m_authToken;
+    req.cacheTtl = CACHE_TTL_BROWSE;
 
     HttpResponse resp = client.request(req);
 
@@ -2501,40 +2775,46 @@ bool AudiobookshelfClient::fetchAuthorBooks(const std::string& authorId, std::ve
 
     books.clear();
 
-    std::string itemsArray = extractJsonArray(resp.body, "libraryItems");
-    if (!itemsArray.empty()) {
-        size_t pos = 0;
-        while ((pos = itemsArray.find("\"id\"", pos)) != std::string::npos) {
-            size_t objStart = itemsArray.rfind('{', pos);
-            if (objStart == std::string::npos) {
-                pos++;
-                continue;
-            }
-
-            int braceCount = 1;
-            size_t objEnd = objStart + 1;
-            while (braceCount > 0 && objEnd < itemsArray.length()) {
-                if (itemsArray[objEnd] == '{') braceCount++;
-                else if (itemsArray[objEnd] == '}') braceCount--;
-                objEnd++;
-            }
+    std::string_view itemsArray = extractJsonArray(resp.body, "libraryItems");
+    forEachItemObject(itemsArray, [&](std::string_view obj) {
+        MediaItemSummary item = parseMediaItemSummary(obj);
+        if (!item.id.empty() && !item.title.empty()) {
+            books.push_back(std::move(item));
+        }
+    });
 
-            std::string obj = itemsArray.substr(objStart, objEnd - objStart);
-            MediaItem item = parseMediaItem(obj);
+    brls::Logger::info("Found {} books by author", books.size());
+    return true;
+}
 
-            if (!item.id.empty() && !item.title.empty()) {
-                books.push_back(item);
+// Offset of the '[' opening the array value of "key", or npos. Unlike
+// extractJsonArray this doesn't scan ahead to the end of the array.
+static size_t findJsonArrayStart(std::string_view json, std::string_view key) {
+    size_t keyPos = 0;
+    while ((keyPos = findJsonKey(json, key, keyPos)) != std::string_view::npos) {
+        size_t valueStart = json.find_first_not_of(" \t\n\r", keyPos + key.size() + 2);
+        if (valueStart != std::string_view::npos && json[valueStart] == ':') {
+            valueStart = json.find_first_not_of(" \t\n\r", valueStart + 1);
+            if (valueStart != std::string_view::npos && json[valueStart] == '[') {
+                return valueStart;
             }
-
-            pos = objEnd;
         }
+        keyPos += key.size() + 2;
     }
-
-    brls::Logger::info("Found {} books by author", books.size());
-    return true;
+    return std::string_view::npos;
 }
 
 bool AudiobookshelfClient::fetchPodcastEpisodes(const std::string& podcastId, std::vector<MediaItem>& episodes) {
+    episodes.clear();
+    return fetchPodcastEpisodes(podcastId, 100, [&episodes](std::vector<MediaItem>& page) {
+        episodes.insert(episodes.end(), std::make_move_iterator(page.begin()),
+                        std::make_move_iterator(page.end()));
+        return true;
+    });
+}
+
+bool AudiobookshelfClient::fetchPodcastEpisodes(const std::string& podcastId, size_t pageSize,
+                                                const std::function<bool(std::vector<MediaItem>& page)>& onPage) {
     brls::Logger::debug("Fetching podcast episodes: {}", podcastId);
 
     HttpClient client;
@@ -2551,52 +2831,60 @@ bool AudiobookshelfClient::fetchPodcastEpisodes(const std::string& podcastId, st
         return false;
     }
 
-    episodes.clear();
-
-    std::string mediaObj = extractJsonObject(resp.body, "media");
-    std::string episodesArray = extractJsonArray(mediaObj, "episodes");
-
-    if (!episodesArray.empty()) {
-        size_t pos = 0;
-        while ((pos = episodesArray.find("\"id\"", pos)) != std::string::npos) {
-            size_t objStart = episodesArray.rfind('{', pos);
-            if (objStart == std::string::npos) {
-                pos++;
-                continue;
-            }
-
-            int braceCount = 1;
-            size_t objEnd = objStart + 1;
-            while (braceCount > 0 && objEnd < episodesArray.length()) {
-                if (episodesArray[objEnd] == '{') braceCount++;
-                else if (episodesArray[objEnd] == '}') braceCount--;
-                objEnd++;
-            }
+    // The server has no episode paging, so the pages are cut while walking
+    // media.episodes: each object is parsed once, its top-level members only
+    // (descriptions and audio file objects are skipped over, not copied)
+    std::string_view body = resp.body;
+    size_t arrayStart = findJsonArrayStart(body, "episodes");
+    if (pageSize == 0) pageSize = 1;
+
+    std::vector<MediaItem> page;
+    page.reserve(pageSize);
+    size_t count = 0;
+    bool stopped = false;
+
+    size_t pos = arrayStart == std::string_view::npos ? body.size() : arrayStart + 1;
+    while (!stopped && (pos = findJsonStructural(body, pos)) != std::string_view::npos) {
+        char c = body[pos];
+        if (c == ']') break;
+        if (c != '{') {
+            // Stray string or bracket between the episode objects
+            pos = (c == '"') ? findJsonStringEnd(body, pos) + 1 : pos + 1;
+            continue;
+        }
 
-            std::string obj = episodesArray.substr(objStart, objEnd - objStart);
+        size_t objEnd = findJsonContainerEnd(body, pos);
+        ItemEpisodeJson fields;
+        kItemEpisodeTable.parse(body.substr(pos, objEnd - pos), fields);
+        pos = objEnd;
 
-            MediaItem ep;
-            ep.episodeId = extractJsonValue(obj, "id");
-            ep.id = podcastId;  // Parent podcast ID
-            ep.podcastId = podcastId;
-            ep.title = extractJsonValue(obj, "title");
-            ep.description = extractJsonValue(obj, "description");
-            ep.pubDate = extractJsonValue(obj, "pubDate");
-            ep.duration = extractJsonFloat(obj, "duration");
-            ep.episodeNumber = extractJsonInt(obj, "episode");
-            ep.seasonNumber = extractJsonInt(obj, "season");
-            ep.mediaType = MediaType::PODCAST_EPISODE;
-            ep.type = "podcastEpisode";
+        if (fields.id.empty() || fields.title.empty()) continue;
 
-            if (!ep.episodeId.empty() && !ep.title.empty()) {
-                episodes.push_back(ep);
-            }
+        MediaItem ep;
+        ep.episodeId = std::string(fields.id);
+        ep.id = podcastId;  // Parent podcast ID
+        ep.podcastId = podcastId;
+        ep.title = std::string(fields.title);
+        ep.pubDate = std::string(fields.pubDate);
+        ep.duration = parseJsonFloat(fields.duration);
+        ep.episodeNumber = parseJsonInt(fields.episode);
+        ep.seasonNumber = parseJsonInt(fields.season);
+        ep.mediaType = MediaType::PODCAST_EPISODE;
+        ep.type = "podcastEpisode";
+        page.push_back(std::move(ep));
+        count++;
 
-            pos = objEnd;
+        if (page.size() >= pageSize) {
+            stopped = !onPage(page);
+            page.clear();
         }
     }
 
-    brls::Logger::info("Found {} podcast episodes", episodes.size());
+    if (!stopped && !page.empty()) {
+        onPage(page);
+    }
+
+    brls::Logger::info("Found {} podcast episodes{}", count, stopped ? " (stopped early)" : "");
     return true;
 }
 
@@ -2623,7 +2911,7 @@ bool AudiobookshelfClient::searchPodcasts(const std::string& query, std::vector<
     }
 
     // Parse results array
-    std::string resultsArray = extractJsonArray(resp.body, "results");
+    std::string_view resultsArray = extractJsonArray(resp.body, "results");
     if (resultsArray.empty()) {
         brls::Logger::debug("No podcast results found");
         return true;
@@ -2637,15 +2925,9 @@ bool AudiobookshelfClient::searchPodcasts(const std::string& query, std::vector<
             continue;
         }
 
-        int braceCount = 1;
-        size_t objEnd = objStart + 1;
-        while (braceCount > 0 && objEnd < resultsArray.length()) {
-            if (resultsArray[objEnd] == '{') braceCount++;
-            else if (resultsArray[objEnd] == '}') braceCount--;
-            objEnd++;
-        }
+        size_t objEnd = findJsonContainerEnd(resultsArray, objStart);
 
-        std::string obj = resultsArray.substr(objStart, objEnd - objStart);
+        std::string_view obj = resultsArray.substr(objStart, objEnd - objStart);
 
         PodcastSearchResult result;
         result.title = extractJsonValue(obj, "collectionName");
@@ -2683,11 +2965,12 @@ bool AudiobookshelfClient::addPodcastToLibrary(const std::string& libraryId, con
     libReq.method = "GET";
     libReq.headers["Accept"] = "application/json";
     libReq.headers["Authorization"] = "Bearer " + m_authToken;
+    libReq.cacheTtl = CACHE_TTL_LIBRARIES;
 
     HttpResponse libResp = libClient.request(libReq);
     if (libResp.statusCode == 200) {
         // Extract folder info from library
-        std::string foldersArray = extractJsonArray(libResp.body, "folders");
+        std::string_view foldersArray = extractJsonArray(libResp.body, "folders");
         if (!foldersArray.empty()) {
             // If no folder ID provided, use the first one
             if (folder.empty()) {
@@ -2792,6 +3075,7 @@ bool AudiobookshelfClient::addPodcastToLibrary(const std::string& libraryId, con
 
     if (resp.statusCode == 200 || resp.statusCode == 201) {
         brls::Logger::info("Successfully added podcast '{}' to library", podcast.title);
+        HttpCache::getInstance().invalidate("/api/libraries/" + libraryId);
         return true;
     }
 
@@ -2820,8 +3104,8 @@ bool AudiobookshelfClient::checkNewEpisodes(const std::string& podcastId, std::v
     }
 
     // Extract feedUrl from metadata
-    std::string mediaObj = extractJsonObject(itemResp.body, "media");
-    std::string metadataObj = extractJsonObject(mediaObj, "metadata");
+    std::string_view mediaObj = extractJsonObject(itemResp.body, "media");
+    std::string_view metadataObj = extractJsonObject(mediaObj, "metadata");
     std::string feedUrl = extractJsonValue(metadataObj, "feedUrl");
 
     if (feedUrl.empty()) {
@@ -2834,22 +3118,16 @@ bool AudiobookshelfClient::checkNewEpisodes(const std::string& podcastId, std::v
     // Get existing episode GUIDs/titles for comparison
     std::vector<std::string> existingGuids;
     std::vector<std::string> existingTitles;
-    std::string existingEpisodes = extractJsonArray(mediaObj, "episodes");
+    std::string_view existingEpisodes = extractJsonArray(mediaObj, "episodes");
     if (!existingEpisodes.empty()) {
         size_t pos = 0;
         while ((pos = existingEpisodes.find("\"id\"", pos)) != std::string::npos) {
             size_t objStart = existingEpisodes.rfind('{', pos);
             if (objStart == std::string::npos) { pos++; continue; }
 
-            int braceCount = 1;
-            size_t objEnd = objStart + 1;
-            while (braceCount > 0 && objEnd < existingEpisodes.length()) {
-                if (existingEpisodes[objEnd] == '{') braceCount++;
-                else if (existingEpisodes[objEnd] == '}') braceCount--;
-                objEnd++;
-            }
+            size_t objEnd = findJsonContainerEnd(existingEpisodes, objStart);
 
-            std::string obj = existingEpisodes.substr(objStart, objEnd - objStart);
+            std::string_view obj = existingEpisodes.substr(objStart, objEnd - objStart);
             std::string guid = extractJsonValue(obj, "guid");
             std::string title = extractJsonValue(obj, "title");
             if (!guid.empty()) existingGuids.push_back(guid);
@@ -2879,8 +3157,8 @@ bool AudiobookshelfClient::checkNewEpisodes(const std::string& podcastId, std::v
     }
 
     // Parse episodes from RSS feed response
-    std::string podcastObj = extractJsonObject(feedResp.body, "podcast");
-    std::string rssEpisodes = extractJsonArray(podcastObj, "episodes");
+    std::string_view podcastObj = extractJsonObject(feedResp.body, "podcast");
+    std::string_view rssEpisodes = extractJsonArray(podcastObj, "episodes");
 
     if (rssEpisodes.empty()) {
         brls::Logger::debug("No episodes in RSS feed");
@@ -2896,15 +3174,9 @@ bool AudiobookshelfClient::checkNewEpisodes(const std::string& podcastId, std::v
             continue;
         }
 
-        int braceCount = 1;
-        size_t objEnd = objStart + 1;
-        while (braceCount > 0 && objEnd < rssEpisodes.length()) {
-            if (rssEpisodes[objEnd] == '{') braceCount++;
-            else if (rssEpisodes[objEnd] == '}') braceCount--;
-            objEnd++;
-        }
+        size_t objEnd = findJsonContainerEnd(rssEpisodes, objStart);
 
-        std::string obj = rssEpisodes.substr(objStart, objEnd - objStart);
+        std::string_view obj = rssEpisodes.substr(objStart, objEnd - objStart);
 
         std::string title = extractJsonValue(obj, "title");
         std::string guid = extractJsonValue(obj, "guid");
@@ -2934,7 +3206,7 @@ bool AudiobookshelfClient::checkNewEpisodes(const std::string& podcastId, std::v
             ep.type = "podcastEpisode";
 
             // Store enclosure info for download - this is the audio URL
-            std::string enclosureObj = extractJsonObject(obj, "enclosure");
+            std::string_view enclosureObj = extractJsonObject(obj, "enclosure");
             if (!enclosureObj.empty()) {
                 ep.coverPath = extractJsonValue(enclosureObj, "url");  // Reusing coverPath for enclosure URL
                 ep.enclosureType = extractJsonValue(enclosureObj, "type");
@@ -3131,7 +3403,7 @@ bool AudiobookshelfClient::fetchEpisodeDownloads(const std::string& libraryId,
     queue.clear();
 
     // Parse currentDownload object
-    std::string currentObj = extractJsonObject(resp.body, "currentDownload");
+    std::string_view currentObj = extractJsonObject(resp.body, "currentDownload");
     if (!currentObj.empty() && currentObj != "null") {
         std::string dlId = extractJsonValue(currentObj, "id");
         if (!dlId.empty()) {
@@ -3146,22 +3418,16 @@ bool AudiobookshelfClient::fetchEpisodeDownloads(const std::string& libraryId,
     }
 
     // Parse queue array
-    std::string queueArray = extractJsonArray(resp.body, "queue");
+    std::string_view queueArray = extractJsonArray(resp.body, "queue");
     if (!queueArray.empty()) {
         size_t pos = 0;
         while ((pos = queueArray.find("\"id\"", pos)) != std::string::npos) {
             size_t objStart = queueArray.rfind('{', pos);
             if (objStart == std::string::npos) { pos++; continue; }
 
-            int braceCount = 1;
-            size_t objEnd = objStart + 1;
-            while (braceCount > 0 && objEnd < queueArray.length()) {
-                if (queueArray[objEnd] == '{') braceCount++;
-                else if (queueArray[objEnd] == '}') braceCount--;
-                objEnd++;
-            }
+            size_t objEnd = findJsonContainerEnd(queueArray, objStart);
 
-            std::string obj = queueArray.substr(objStart, objEnd - objStart);
+            std::string_view obj = queueArray.substr(objStart, objEnd - objStart);
             ServerEpisodeDownload dl;
             dl.id = extractJsonValue(obj, "id");
             dl.episodeTitle = extractJsonValue(obj, "episodeDisplayTitle");
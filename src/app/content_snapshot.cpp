@@ -0,0 +1,276 @@
+/**
+ * VitaABS - Content Snapshot implementation
+ *
+ * File layout (native endianness, the file never leaves the device):
+ *   magic "VSNP" | u16 version | u16 sectionCount | str serverUrl | str username
+ *   per section: u32 itemCount, then itemCount item records
+ *
+ * Strings are u16 length + bytes. Records are MediaItemSummary - what a
+ * MediaItemCell draws; the detail view fetches everything else on open.
+ */
+
+#include "app/content_snapshot.hpp"
+#include "app/application.hpp"
+#include "platform/platform.hpp"
+#include <borealis.hpp>
+#include <algorithm>
+#include <cstring>
+
+namespace vitaabs {
+
+static const char SNAPSHOT_MAGIC[4] = {'V', 'S', 'N', 'P'};
+static const uint16_t SNAPSHOT_VERSION = 2;
+
+// Item records are also bounded to keep a corrupt file from exhausting memory
+static const uint32_t SNAPSHOT_MAX_ITEMS = 5000;
+
+namespace {
+
+class SnapshotWriter {
+public:
+    template <typename T>
+    void put(T value) {
+        const char* p = reinterpret_cast<const char*>(&value);
+        m_buf.append(p, sizeof(T));
+    }
+
+    void putString(const std::string& s) {
+        uint16_t len = (uint16_t)std::min<size_t>(s.size(), 0xFFFF);
+        put(len);
+        m_buf.append(s.data(), len);
+    }
+
+    const std::string& data() const { return m_buf; }
+
+private:
+    std::string m_buf;
+};
+
+class SnapshotReader {
+public:
+    SnapshotReader(const std::vector<uint8_t>& data) : m_data(data) {}
+
+    template <typename T>
+    bool get(T& value) {
+        if (m_pos + sizeof(T) > m_data.size()) return false;
+        std::memcpy(&value, m_data.data() + m_pos, sizeof(T));
+        m_pos += sizeof(T);
+        return true;
+    }
+
+    bool getString(std::string& s) {
+        uint16_t len = 0;
+        if (!get(len)) return false;
+        if (m_pos + len > m_data.size()) return false;
+        s.assign(reinterpret_cast<const char*>(m_data.data()) + m_pos, len);
+        m_pos += len;
+        return true;
+    }
+
+    bool getString(InternedString& s) {
+        std::string value;
+        if (!getString(value)) return false;
+        s = value;
+        return true;
+    }
+
+private:
+    const std::vector<uint8_t>& m_data;
+    size_t m_pos = 0;
+};
+
+void writeItem(SnapshotWriter& w, const MediaItemSummary& item) {
+    w.putString(item.id);
+    w.putString(item.libraryId);
+    w.putString(item.episodeId);
+    w.putString(item.podcastId);
+    w.putString(item.title);
+    w.putString(item.authorName);
+    w.putString(item.coverPath);
+    w.putString(item.type);
+    w.putString(item.blurb);
+    w.put<uint8_t>(static_cast<uint8_t>(item.mediaType));
+    w.put<uint8_t>((item.isFinished ? 0x01 : 0x00) | (item.isDownloaded ? 0x02 : 0x00));
+    w.put<float>(item.duration);
+    w.put<float>(item.currentTime);
+    w.put<float>(item.progress);
+    w.put<int32_t>(item.episodeNumber);
+}
+
+bool readItem(SnapshotReader& r, MediaItemSummary& item) {
+    uint8_t mediaType = 0;
+    uint8_t flags = 0;
+    int32_t episodeNumber = 0;
+
+    bool ok = r.getString(item.id) &&
+              r.getString(item.libraryId) &&
+              r.getString(item.episodeId) &&
+              r.getString(item.podcastId) &&
+              r.getString(item.title) &&
+              r.getString(item.authorName) &&
+              r.getString(item.coverPath) &&
+              r.getString(item.type) &&
+              r.getString(item.blurb) &&
+              r.get(mediaType) &&
+              r.get(flags) &&
+              r.get(item.duration) &&
+              r.get(item.currentTime) &&
+              r.get(item.progress) &&
+              r.get(episodeNumber);
+    if (!ok) return false;
+
+    if (mediaType > static_cast<uint8_t>(MediaType::PODCAST_EPISODE)) {
+        mediaType = static_cast<uint8_t>(MediaType::UNKNOWN);
+    }
+    item.mediaType = static_cast<MediaType>(mediaType);
+    item.isFinished = (flags & 0x01) != 0;
+    item.isDownloaded = (flags & 0x02) != 0;
+    item.episodeNumber = episodeNumber;
+    return true;
+}
+
+} // namespace
+
+ContentSnapshot& ContentSnapshot::getInstance() {
+    static ContentSnapshot instance;
+    return instance;
+}
+
+std::string ContentSnapshot::getSnapshotDir() const {
+    return platform::path("snapshots");
+}
+
+std::string ContentSnapshot::getSnapshotPath(const std::string& name) const {
+    return getSnapshotDir() + "/" + name + ".bin";
+}
+
+bool ContentSnapshot::writeSnapshot(const std::string& name,
+                                    const std::vector<const std::vector<MediaItemSummary>*>& sections) {
+    Application& app = Application::getInstance();
+
+    SnapshotWriter w;
+    for (char c : SNAPSHOT_MAGIC) w.put<char>(c);
+    w.put<uint16_t>(SNAPSHOT_VERSION);
+    w.put<uint16_t>((uint16_t)sections.size());
+    w.putString(app.getServerUrl());
+    w.putString(app.getUsername());
+
+    for (const auto* section : sections) {
+        uint32_t count = (uint32_t)std::min<size_t>(section->size(), SNAPSHOT_MAX_ITEMS);
+        w.put<uint32_t>(count);
+        for (uint32_t i = 0; i < count; i++) {
+            writeItem(w, (*section)[i]);
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    platform::createDirRecursive(getSnapshotDir());
+    if (!platform::writeFile(getSnapshotPath(name), w.data())) {
+        brls::Logger::warning("ContentSnapshot: Failed to write snapshot '{}'", name);
+        return false;
+    }
+
+    brls::Logger::debug("ContentSnapshot: Wrote snapshot '{}' ({} bytes)", name, w.data().size());
+    return true;
+}
+
+bool ContentSnapshot::readSnapshot(const std::string& name,
+                                   std::vector<std::vector<MediaItemSummary>*>& sections) {
+    std::vector<uint8_t> data;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        data = platform::readFile(getSnapshotPath(name));
+    }
+    if (data.empty()) return false;
+
+    SnapshotReader r(data);
+
+    char magic[4];
+    for (char& c : magic) {
+        if (!r.get(c)) return false;
+    }
+    if (std::memcmp(magic, SNAPSHOT_MAGIC, sizeof(magic)) != 0) {
+        brls::Logger::warning("ContentSnapshot: Bad magic in snapshot '{}'", name);
+        return false;
+    }
+
+    uint16_t version = 0;
+    uint16_t sectionCount = 0;
+    if (!r.get(version) || !r.get(sectionCount)) return false;
+    if (version != SNAPSHOT_VERSION || sectionCount != sections.size()) {
+        brls::Logger::debug("ContentSnapshot: Ignoring snapshot '{}' (version {}, {} sections)",
+                           name, version, sectionCount);
+        return false;
+    }
+
+    // Snapshots belong to one server/account - never show another user's shelves
+    std::string serverUrl, username;
+    if (!r.getString(serverUrl) || !r.getString(username)) return false;
+    Application& app = Application::getInstance();
+    if (serverUrl != app.getServerUrl() || username != app.getUsername()) {
+        brls::Logger::debug("ContentSnapshot: Snapshot '{}' is for a different account", name);
+        return false;
+    }
+
+    for (auto* section : sections) {
+        uint32_t count = 0;
+        if (!r.get(count) || count > SNAPSHOT_MAX_ITEMS) return false;
+
+        std::vector<MediaItemSummary> items;
+        items.reserve(count);
+        for (uint32_t i = 0; i < count; i++) {
+            MediaItemSummary item;
+            if (!readItem(r, item)) {
+                brls::Logger::warning("ContentSnapshot: Truncated snapshot '{}'", name);
+                return false;
+            }
+            items.push_back(std::move(item));
+        }
+        *section = std::move(items);
+    }
+
+    return true;
+}
+
+bool ContentSnapshot::loadHome(std::vector<MediaItemSummary>& continueItems,
+                               std::vector<MediaItemSummary>& recentEpisodes) {
+    std::vector<MediaItemSummary> cont, recent;
+    std::vector<std::vector<MediaItemSummary>*> sections = {&cont, &recent};
+    if (!readSnapshot("home", sections)) return false;
+
+    continueItems = std::move(cont);
+    recentEpisodes = std::move(recent);
+    return true;
+}
+
+bool ContentSnapshot::saveHome(const std::vector<MediaItemSummary>& continueItems,
+                               const std::vector<MediaItemSummary>& recentEpisodes) {
+    return writeSnapshot("home", {&continueItems, &recentEpisodes});
+}
+
+bool ContentSnapshot::loadLibrary(const std::string& libraryId, std::vector<MediaItemSummary>& items) {
+    if (libraryId.empty()) return false;
+
+    std::vector<MediaItemSummary> loaded;
+    std::vector<std::vector<MediaItemSummary>*> sections = {&loaded};
+    if (!readSnapshot("library_" + libraryId, sections)) return false;
+
+    items = std::move(loaded);
+    return true;
+}
+
+bool ContentSnapshot::saveLibrary(const std::string& libraryId, const std::vector<MediaItemSummary>& items) {
+    if (libraryId.empty()) return false;
+    return writeSnapshot("library_" + libraryId, {&items});
+}
+
+void ContentSnapshot::clear() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    std::string dir = getSnapshotDir();
+    for (const auto& name : platform::listDir(dir)) {
+        platform::deleteFile(dir + "/" + name);
+    }
+    brls::Logger::info("ContentSnapshot: Cleared snapshots");
+}
+
+} // namespace vitaabs
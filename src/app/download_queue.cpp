@@ -0,0 +1,176 @@
+/**
+ * VitaABS - Download Queue implementation
+ */
+
+#include "app/download_queue.hpp"
+#include <algorithm>
+
+namespace vitaabs {
+
+int64_t DownloadQueue::nextRound(const std::string& group) {
+    if (!m_roundRobin) return 0;
+
+    // A group that has been idle starts in the current round rather than
+    // catching up on the turns it missed
+    int64_t round = m_currentRound;
+    auto it = m_groupRounds.find(group);
+    if (it != m_groupRounds.end()) {
+        round = std::max(round, it->second + 1);
+    }
+    m_groupRounds[group] = round;
+    return round;
+}
+
+void DownloadQueue::insert(Entry entry) {
+    std::string key = entry.key;
+    m_nextPosition = std::max(m_nextPosition, entry.position + 1);
+    m_index[key] = m_entries.insert(std::move(entry)).first;
+}
+
+int64_t DownloadQueue::push(const std::string& key, const std::string& group) {
+    auto existing = m_index.find(key);
+    if (existing != m_index.end()) {
+        return existing->second->position;
+    }
+
+    Entry entry;
+    entry.round = nextRound(group);
+    entry.position = m_nextPosition;
+    entry.key = key;
+    entry.group = group;
+    insert(entry);
+    return entry.position;
+}
+
+void DownloadQueue::restore(const std::string& key, const std::string& group, int64_t position) {
+    if (m_index.count(key)) return;
+
+    Entry entry;
+    entry.round = nextRound(group);
+    entry.position = position;
+    entry.key = key;
+    entry.group = group;
+    insert(entry);
+}
+
+bool DownloadQueue::pop(std::string& key) {
+    if (m_entries.empty()) return false;
+
+    auto it = m_entries.begin();
+    key = it->key;
+    m_currentRound = it->round;
+    m_index.erase(key);
+    m_entries.erase(it);
+    return true;
+}
+
+void DownloadQueue::remove(const std::string& key) {
+    auto it = m_index.find(key);
+    if (it == m_index.end()) return;
+    m_entries.erase(it->second);
+    m_index.erase(it);
+}
+
+std::vector<DownloadQueue::Entry> DownloadQueue::entriesByPosition() const {
+    std::vector<Entry> entries(m_entries.begin(), m_entries.end());
+    std::sort(entries.begin(), entries.end(), [](const Entry& a, const Entry& b) {
+        if (a.position != b.position) return a.position < b.position;
+        return a.key < b.key;
+    });
+    return entries;
+}
+
+int64_t DownloadQueue::boost(const std::string& key) {
+    auto it = m_index.find(key);
+    if (it == m_index.end()) return 0;
+
+    Entry boosted = *it->second;
+    boosted.round = m_entries.begin()->round;
+    m_entries.erase(it->second);
+    m_index.erase(it);
+
+    // Renumber from 1 in user order with the boosted job first, so positions
+    // stay unique and never reach 0 however often jobs are boosted
+    std::vector<Entry> entries = entriesByPosition();
+    m_entries.clear();
+    m_index.clear();
+    m_nextPosition = 1;
+
+    boosted.position = 1;
+    insert(boosted);
+    for (auto& entry : entries) {
+        entry.position = m_nextPosition;
+        insert(entry);
+    }
+    return boosted.position;
+}
+
+std::string DownloadQueue::move(const std::string& key, int delta) {
+    auto it = m_index.find(key);
+    if (it == m_index.end() || delta == 0) return "";
+
+    auto self = it->second;
+    auto other = self;
+    if (delta < 0) {
+        if (self == m_entries.begin()) return "";
+        --other;
+    } else {
+        ++other;
+        if (other == m_entries.end()) return "";
+    }
+
+    // Rounds stay with their jobs - swapping them across podcasts would
+    // reorder the podcasts' turns
+    if (other->round != self->round) return "";
+
+    // Trade places within the round: swap positions
+    Entry a = *self;
+    Entry b = *other;
+    std::swap(a.position, b.position);
+    m_entries.erase(self);
+    m_entries.erase(other);
+    m_index[a.key] = m_entries.insert(a).first;
+    m_index[b.key] = m_entries.insert(b).first;
+    return b.key;
+}
+
+void DownloadQueue::setRoundRobin(bool enabled) {
+    if (enabled == m_roundRobin) return;
+    m_roundRobin = enabled;
+
+    // Re-push in user order so rounds are handed out from scratch
+    std::vector<Entry> entries = entriesByPosition();
+
+    m_entries.clear();
+    m_index.clear();
+    m_groupRounds.clear();
+    m_currentRound = 0;
+    for (auto& entry : entries) {
+        entry.round = nextRound(entry.group);
+        insert(entry);
+    }
+}
+
+int64_t DownloadQueue::position(const std::string& key) const {
+    auto it = m_index.find(key);
+    return it != m_index.end() ? it->second->position : 0;
+}
+
+void DownloadQueue::clear() {
+    m_entries.clear();
+    m_index.clear();
+    m_groupRounds.clear();
+    m_currentRound = 0;
+    m_nextPosition = 1;
+}
+
+std::vector<std::string> DownloadQueue::keys() const {
+    std::vector<std::string> result;
+    result.reserve(m_entries.size());
+    for (const auto& entry : m_entries) {
+        result.push_back(entry.key);
+    }
+    return result;
+}
+
+} // namespace vitaabs
@@ -0,0 +1,122 @@
+/**
+ * VitaABS - Download Store implementation
+ */
+
+#include "app/download_store.hpp"
+#include <algorithm>
+
+namespace vitaabs {
+
+std::string DownloadStore::makeKey(const std::string& itemId, const std::string& episodeId) {
+    return episodeId.empty() ? itemId : itemId + "/" + episodeId;
+}
+
+DownloadHandle DownloadStore::insert(const DownloadItem& item) {
+    uint32_t index;
+    if (!m_free.empty()) {
+        index = m_free.back();
+        m_free.pop_back();
+    } else {
+        index = static_cast<uint32_t>(m_slots.size());
+        m_slots.emplace_back();
+    }
+
+    Slot& slot = m_slots[index];
+    slot.item = item;
+    slot.live = true;
+    slot.prev = m_tail;
+    slot.next = NONE;
+    if (m_tail != NONE) {
+        m_slots[m_tail].next = index;
+    } else {
+        m_head = index;
+    }
+    m_tail = index;
+    m_size++;
+
+    m_byKey[makeKey(item.itemId, item.episodeId)] = index;
+    m_byItemId[item.itemId].push_back(index);
+
+    return DownloadHandle{index, slot.generation};
+}
+
+void DownloadStore::erase(DownloadHandle handle) {
+    if (!get(handle)) return;
+
+    uint32_t index = handle.index;
+    Slot& slot = m_slots[index];
+    const DownloadItem& item = slot.item;
+
+    m_byKey.erase(makeKey(item.itemId, item.episodeId));
+    auto group = m_byItemId.find(item.itemId);
+    if (group != m_byItemId.end()) {
+        auto& indices = group->second;
+        indices.erase(std::remove(indices.begin(), indices.end(), index), indices.end());
+        if (indices.empty()) m_byItemId.erase(group);
+    }
+
+    if (slot.prev != NONE) m_slots[slot.prev].next = slot.next; else m_head = slot.next;
+    if (slot.next != NONE) m_slots[slot.next].prev = slot.prev; else m_tail = slot.prev;
+    slot.prev = slot.next = NONE;
+
+    // Outstanding handles go stale
+    slot.live = false;
+    slot.generation++;
+    slot.item = DownloadItem();
+    m_size--;
+    m_free.push_back(index);
+}
+
+void DownloadStore::clear() {
+    while (m_head != NONE) {
+        erase(DownloadHandle{m_head, m_slots[m_head].generation});
+    }
+}
+
+DownloadItem* DownloadStore::get(DownloadHandle handle) {
+    if (handle.index >= m_slots.size()) return nullptr;
+    Slot& slot = m_slots[handle.index];
+    return (slot.live && slot.generation == handle.generation) ? &slot.item : nullptr;
+}
+
+const DownloadItem* DownloadStore::get(DownloadHandle handle) const {
+    if (handle.index >= m_slots.size()) return nullptr;
+    const Slot& slot = m_slots[handle.index];
+    return (slot.live && slot.generation == handle.generation) ? &slot.item : nullptr;
+}
+
+DownloadHandle DownloadStore::find(const std::string& itemId, const std::string& episodeId) const {
+    return findKey(makeKey(itemId, episodeId));
+}
+
+DownloadHandle DownloadStore::findKey(const std::string& key) const {
+    auto it = m_byKey.find(key);
+    if (it == m_byKey.end()) return DownloadHandle();
+    return DownloadHandle{it->second, m_slots[it->second].generation};
+}
+
+std::vector<DownloadHandle> DownloadStore::findAll(const std::string& itemId) const {
+    std::vector<DownloadHandle> handles;
+    auto it = m_byItemId.find(itemId);
+    if (it != m_byItemId.end()) {
+        handles.reserve(it->second.size());
+        for (uint32_t index : it->second) {
+            handles.push_back(DownloadHandle{index, m_slots[index].generation});
+        }
+    }
+    return handles;
+}
+
+DownloadItem& DownloadStore::itemAt(uint32_t index) {
+    return m_slots[index].item;
+}
+
+const DownloadItem& DownloadStore::itemAt(uint32_t index) const {
+    return m_slots[index].item;
+}
+
+uint32_t DownloadStore::nextOf(uint32_t index) const {
+    return m_slots[index].next;
+}
+
+} // namespace vitaabs
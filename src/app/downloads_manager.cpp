@@ -7,6 +7,7 @@
 #include "app/audiobookshelf_client.hpp"
 #include "app/application.hpp"
 #include "utils/http_client.hpp"
+#include "utils/json_scan.hpp"
 #include "platform/platform.hpp"
 #include <borealis.hpp>
 #include <fstream>
@@ -17,6 +18,8 @@
 #include <thread>
 #include <utility>
 #include <atomic>
+#include <unordered_map>
+#include <algorithm>
 
 #ifdef __vita__
 #include <psp2/io/fcntl.h>
@@ -28,339 +31,8 @@
 #include <sys/stat.h>
 #endif
 
-#ifndef VitaABS_NO_FFMPEG
-extern "C" {
-#include <libavformat/avformat.h>
-#include <libavcodec/avcodec.h>
-#include <libavutil/opt.h>
-#include <libavutil/timestamp.h>
-}
-#endif
-
 namespace vitaabs {
 
-// Helper function to concatenate audio files using FFmpeg
-// Uses stream copy for fast concatenation without re-encoding
-static bool concatenateAudioFiles(const std::vector<std::string>& inputFiles,
-                                   const std::string& outputPath,
-                                   std::function<void(int, int)> progressCallback = nullptr) {
-    if (inputFiles.empty()) {
-        brls::Logger::error("concatenateAudioFiles: No input files provided");
-        return false;
-    }
-
-    brls::Logger::info("concatenateAudioFiles: Combining {} files into {}", inputFiles.size(), outputPath);
-
-    // Determine output format based on extension
-    std::string outputExt = ".m4b";
-    size_t dotPos = outputPath.rfind('.');
-    if (dotPos != std::string::npos) {
-        outputExt = outputPath.substr(dotPos);
-    }
-
-    // For MP3 files, use simple binary concatenation (MP3 frames are self-contained)
-    if (outputExt == ".mp3") {
-        brls::Logger::info("concatenateAudioFiles: Using binary concatenation for MP3");
-
-        // Use heap allocation to avoid stack overflow on Vita
-        const size_t BUFFER_SIZE = 8192;
-        char* buffer = new char[BUFFER_SIZE];
-        if (!buffer) {
-            brls::Logger::error("concatenateAudioFiles: Failed to allocate buffer");
-            return false;
-        }
-
-#ifdef __vita__
-        SceUID outFd = sceIoOpen(outputPath.c_str(), SCE_O_WRONLY | SCE_O_CREAT | SCE_O_TRUNC, 0777);
-        if (outFd < 0) {
-            brls::Logger::error("concatenateAudioFiles: Could not create output file");
-            delete[] buffer;
-            return false;
-        }
-
-        int filesProcessed = 0;
-
-        for (size_t fileIdx = 0; fileIdx < inputFiles.size(); fileIdx++) {
-            const std::string& inputFile = inputFiles[fileIdx];
-
-            SceUID inFd = sceIoOpen(inputFile.c_str(), SCE_O_RDONLY, 0);
-            if (inFd < 0) {
-                brls::Logger::warning("concatenateAudioFiles: Could not open {}", inputFile);
-                continue;
-            }
-
-            int bytesRead;
-            while ((bytesRead = sceIoRead(inFd, buffer, BUFFER_SIZE)) > 0) {
-                sceIoWrite(outFd, buffer, bytesRead);
-            }
-
-            sceIoClose(inFd);
-            filesProcessed++;
-
-            if (progressCallback) {
-                progressCallback(filesProcessed, static_cast<int>(inputFiles.size()));
-            }
-        }
-
-        sceIoClose(outFd);
-        delete[] buffer;
-        brls::Logger::info("concatenateAudioFiles: Successfully concatenated {} MP3 files", filesProcessed);
-        return filesProcessed > 0;
-#else
-        std::ofstream outFile(outputPath, std::ios::binary);
-        if (!outFile) {
-            brls::Logger::error("concatenateAudioFiles: Could not create output file");
-            delete[] buffer;
-            return false;
-        }
-
-        int filesProcessed = 0;
-
-        for (size_t fileIdx = 0; fileIdx < inputFiles.size(); fileIdx++) {
-            const std::string& inputFile = inputFiles[fileIdx];
-
-            std::ifstream inFile(inputFile, std::ios::binary);
-            if (!inFile) {
-                brls::Logger::warning("concatenateAudioFiles: Could not open {}", inputFile);
-                continue;
-            }
-
-            while (inFile.read(buffer, BUFFER_SIZE) || inFile.gcount() > 0) {
-                outFile.write(buffer, inFile.gcount());
-            }
-
-            filesProcessed++;
-
-            if (progressCallback) {
-                progressCallback(filesProcessed, static_cast<int>(inputFiles.size()));
-            }
-        }
-
-        delete[] buffer;
-        brls::Logger::info("concatenateAudioFiles: Successfully concatenated {} MP3 files", filesProcessed);
-        return filesProcessed > 0;
-#endif
-    }
-
-#ifdef VitaABS_NO_FFMPEG
-    brls::Logger::error("concatenateAudioFiles: Non-MP3 concatenation requires FFmpeg (not available on this platform)");
-    return false;
-#else
-    // For non-MP3, use FFmpeg concat demuxer
-    // Create a concat file list for the concat demuxer
-    std::string concatListPath = outputPath + ".concat.txt";
-
-#ifdef __vita__
-    SceUID listFd = sceIoOpen(concatListPath.c_str(), SCE_O_WRONLY | SCE_O_CREAT | SCE_O_TRUNC, 0777);
-    if (listFd >= 0) {
-        for (const auto& file : inputFiles) {
-            std::string line = "file '" + file + "'\n";
-            sceIoWrite(listFd, line.c_str(), line.size());
-        }
-        sceIoClose(listFd);
-    } else {
-        brls::Logger::error("concatenateAudioFiles: Failed to create concat list file");
-        return false;
-    }
-#else
-    std::ofstream listFile(concatListPath);
-    if (listFile.is_open()) {
-        for (const auto& file : inputFiles) {
-            listFile << "file '" << file << "'\n";
-        }
-        listFile.close();
-    } else {
-        brls::Logger::error("concatenateAudioFiles: Failed to create concat list file");
-        return false;
-    }
-#endif
-
-    // Open input using concat demuxer
-    AVFormatContext* inputFmtCtx = nullptr;
-    AVDictionary* options = nullptr;
-
-    // Set safe option for concat demuxer to allow absolute paths
-    av_dict_set(&options, "safe", "0", 0);
-
-    std::string concatUrl = "concat:" + concatListPath;
-
-    // Use the concat demuxer format
-    const AVInputFormat* concatFmt = av_find_input_format("concat");
-    if (!concatFmt) {
-        brls::Logger::error("concatenateAudioFiles: concat demuxer not available");
-        av_dict_free(&options);
-        return false;
-    }
-
-    int ret = avformat_open_input(&inputFmtCtx, concatListPath.c_str(), concatFmt, &options);
-    av_dict_free(&options);
-
-    if (ret < 0) {
-        char errbuf[128];
-        av_strerror(ret, errbuf, sizeof(errbuf));
-        brls::Logger::error("concatenateAudioFiles: Could not open input: {}", errbuf);
-        return false;
-    }
-
-    ret = avformat_find_stream_info(inputFmtCtx, nullptr);
-    if (ret < 0) {
-        brls::Logger::error("concatenateAudioFiles: Could not find stream info");
-        avformat_close_input(&inputFmtCtx);
-        return false;
-    }
-
-    // Create output format context (for non-MP3 formats)
-    AVFormatContext* outputFmtCtx = nullptr;
-
-    // Try multiple formats in order of preference
-    // Note: "ipod" format may not be available on all platforms (like Vita)
-    // MP3 is handled above via binary concatenation
-    const char* formatOptions[] = { nullptr, nullptr, nullptr };
-    int numFormats = 0;
-
-    if (outputExt == ".ogg") {
-        formatOptions[0] = "ogg";
-        numFormats = 1;
-    } else {
-        // For m4b/m4a, try mp4 first (more compatible), then ipod, then mov
-        formatOptions[0] = "mp4";
-        formatOptions[1] = "ipod";
-        formatOptions[2] = "mov";
-        numFormats = 3;
-    }
-
-    const char* usedFormat = nullptr;
-    for (int i = 0; i < numFormats; i++) {
-        ret = avformat_alloc_output_context2(&outputFmtCtx, nullptr, formatOptions[i], outputPath.c_str());
-        if (ret >= 0 && outputFmtCtx) {
-            usedFormat = formatOptions[i];
-            brls::Logger::info("concatenateAudioFiles: Using output format '{}'", usedFormat);
-            break;
-        }
-        if (outputFmtCtx) {
-            avformat_free_context(outputFmtCtx);
-            outputFmtCtx = nullptr;
-        }
-    }
-
-    if (ret < 0 || !outputFmtCtx) {
-        brls::Logger::error("concatenateAudioFiles: Could not create output context");
-        avformat_close_input(&inputFmtCtx);
-        return false;
-    }
-
-    // Copy streams from input to output
-    int audioStreamIndex = -1;
-    for (unsigned int i = 0; i < inputFmtCtx->nb_streams; i++) {
-        AVStream* inStream = inputFmtCtx->streams[i];
-        if (inStream->codecpar->codec_type == AVMEDIA_TYPE_AUDIO) {
-            AVStream* outStream = avformat_new_stream(outputFmtCtx, nullptr);
-            if (!outStream) {
-                brls::Logger::error("concatenateAudioFiles: Could not create output stream");
-                avformat_close_input(&inputFmtCtx);
-                avformat_free_context(outputFmtCtx);
-                return false;
-            }
-
-            ret = avcodec_parameters_copy(outStream->codecpar, inStream->codecpar);
-            if (ret < 0) {
-                brls::Logger::error("concatenateAudioFiles: Could not copy codec parameters");
-                avformat_close_input(&inputFmtCtx);
-                avformat_free_context(outputFmtCtx);
-                return false;
-            }
-
-            outStream->codecpar->codec_tag = 0;
-            audioStreamIndex = i;
-            break;
-        }
-    }
-
-    if (audioStreamIndex < 0) {
-        brls::Logger::error("concatenateAudioFiles: No audio stream found");
-        avformat_close_input(&inputFmtCtx);
-        avformat_free_context(outputFmtCtx);
-        return false;
-    }
-
-    // Open output file
-    if (!(outputFmtCtx->oformat->flags & AVFMT_NOFILE)) {
-        ret = avio_open(&outputFmtCtx->pb, outputPath.c_str(), AVIO_FLAG_WRITE);
-        if (ret < 0) {
-            char errbuf[128];
-            av_strerror(ret, errbuf, sizeof(errbuf));
-            brls::Logger::error("concatenateAudioFiles: Could not open output file: {}", errbuf);
-            avformat_close_input(&inputFmtCtx);
-            avformat_free_context(outputFmtCtx);
-            return false;
-        }
-    }
-
-    // Write header
-    ret = avformat_write_header(outputFmtCtx, nullptr);
-    if (ret < 0) {
-        brls::Logger::error("concatenateAudioFiles: Could not write header");
-        avformat_close_input(&inputFmtCtx);
-        if (!(outputFmtCtx->oformat->flags & AVFMT_NOFILE))
-            avio_closep(&outputFmtCtx->pb);
-        avformat_free_context(outputFmtCtx);
-        return false;
-    }
-
-    // Copy packets
-    AVPacket* pkt = av_packet_alloc();
-    int64_t packetsWritten = 0;
-    int64_t lastProgressReport = 0;
-
-    while (av_read_frame(inputFmtCtx, pkt) >= 0) {
-        if (pkt->stream_index == audioStreamIndex) {
-            // Rescale timestamps
-            AVStream* inStream = inputFmtCtx->streams[audioStreamIndex];
-            AVStream* outStream = outputFmtCtx->streams[0];
-
-            pkt->stream_index = 0;
-            av_packet_rescale_ts(pkt, inStream->time_base, outStream->time_base);
-
-            ret = av_interleaved_write_frame(outputFmtCtx, pkt);
-            if (ret < 0) {
-                brls::Logger::warning("concatenateAudioFiles: Error writing packet");
-            }
-
-            packetsWritten++;
-
-            // Report progress periodically
-            if (progressCallback && packetsWritten - lastProgressReport > 1000) {
-                progressCallback(static_cast<int>(packetsWritten), 0);
-                lastProgressReport = packetsWritten;
-            }
-        }
-        av_packet_unref(pkt);
-    }
-
-    av_packet_free(&pkt);
-
-    // Write trailer
-    av_write_trailer(outputFmtCtx);
-
-    // Cleanup
-    avformat_close_input(&inputFmtCtx);
-    if (!(outputFmtCtx->oformat->flags & AVFMT_NOFILE))
-        avio_closep(&outputFmtCtx->pb);
-    avformat_free_context(outputFmtCtx);
-
-    // Remove concat list file
-#ifdef __vita__
-    sceIoRemove(concatListPath.c_str());
-#else
-    std::remove(concatListPath.c_str());
-#endif
-
-    brls::Logger::info("concatenateAudioFiles: Successfully combined {} files ({} packets)",
-                       inputFiles.size(), packetsWritten);
-    return true;
-#endif // VitaABS_NO_FFMPEG
-}
-
 static std::string getDownloadsDir() { return platform::path("downloads"); }
 static std::string getStateFile()    { return platform::path("downloads/state.json"); }
 
@@ -389,66 +61,89 @@ bool DownloadsManager::queueDownload(const std::string& itemId, const std::strin
                                       const std::string& mediaType,
                                       const std::string& seriesName,
                                       const std::string& episodeId) {
-    brls::Logger::info("DownloadsManager::queueDownload called:");
-    brls::Logger::info("  - itemId: {}", itemId);
-    brls::Logger::info("  - title: {}", title);
-    brls::Logger::info("  - mediaType: {}", mediaType);
-    brls::Logger::info("  - episodeId: {}", episodeId.empty() ? "(none)" : episodeId);
+    DownloadRequest request;
+    request.itemId = itemId;
+    request.title = title;
+    request.authorName = authorName;
+    request.duration = duration;
+    request.mediaType = mediaType;
+    request.seriesName = seriesName;
+    request.episodeId = episodeId;
+    return queueDownloads({request}) > 0;
+}
 
-    std::lock_guard<std::mutex> lock(m_mutex);
+int DownloadsManager::queueDownloads(const std::vector<DownloadRequest>& requests) {
+    AudiobookshelfClient& client = AudiobookshelfClient::getInstance();
+    int queued = 0;
+    size_t total = 0;
+    std::string data;
+    size_t itemCount = 0;
 
-    // Check if already in queue - for episodes, check both itemId AND episodeId
-    for (const auto& item : m_downloads) {
-        if (item.itemId == itemId) {
-            // For podcast episodes, also check episodeId since multiple episodes share podcastId
-            if (episodeId.empty() || item.episodeId == episodeId) {
-                brls::Logger::warning("DownloadsManager: {} already in queue", title);
-                return false;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        for (const auto& request : requests) {
+            brls::Logger::info("DownloadsManager::queueDownload: itemId={} episodeId={} mediaType={} ({})",
+                               request.itemId, request.episodeId.empty() ? "(none)" : request.episodeId,
+                               request.mediaType, request.title);
+
+            // Check if already in queue - for episodes, check both itemId AND episodeId
+            if (findDownloadUnlocked(request.itemId, request.episodeId).valid()) {
+                brls::Logger::warning("DownloadsManager: {} already in queue", request.title);
+                continue;
             }
-        }
-    }
 
-    DownloadItem item;
-    item.itemId = itemId;
-    item.title = title;
-    item.authorName = authorName;
-    item.parentTitle = seriesName.empty() ? authorName : seriesName;
-    item.duration = duration;
-    item.mediaType = mediaType;
-    item.seriesName = seriesName;
-    item.episodeId = episodeId;
-    item.state = DownloadState::QUEUED;
+            DownloadItem item;
+            item.itemId = request.itemId;
+            item.title = request.title;
+            item.authorName = request.authorName;
+            item.parentTitle = request.seriesName.empty() ? request.authorName : request.seriesName;
+            item.duration = request.duration;
+            item.mediaType = request.mediaType;
+            item.seriesName = request.seriesName;
+            item.episodeId = request.episodeId;
+            item.state = DownloadState::QUEUED;
 
-    // Get cover URL from client
-    AudiobookshelfClient& client = AudiobookshelfClient::getInstance();
-    item.coverUrl = client.getCoverUrl(itemId);
+            // Get cover URL from client
+            item.coverUrl = client.getCoverUrl(request.itemId);
+
+            // Generate local path - for episodes use episodeId to ensure unique filenames
+            std::string extension;
+            std::string fileId;
+            if (!request.episodeId.empty()) {
+                // Podcast episode - use episodeId for unique filename
+                extension = ".mp3";
+                fileId = request.episodeId;
+            } else if (request.mediaType == "podcast") {
+                extension = ".mp3";
+                fileId = request.itemId;
+            } else {
+                // For audiobooks, use m4b (common audiobook format)
+                extension = ".m4b";
+                fileId = request.itemId;
+            }
+            item.localPath = m_downloadsPath + "/" + fileId + extension;
 
-    // Generate local path - for episodes use episodeId to ensure unique filenames
-    std::string extension;
-    std::string fileId;
-    if (!episodeId.empty()) {
-        // Podcast episode - use episodeId for unique filename
-        extension = ".mp3";
-        fileId = episodeId;
-    } else if (mediaType == "podcast") {
-        extension = ".mp3";
-        fileId = itemId;
-    } else {
-        // For audiobooks, use m4b (common audiobook format)
-        extension = ".m4b";
-        fileId = itemId;
-    }
-    std::string filename = fileId + extension;
-    item.localPath = m_downloadsPath + "/" + filename;
+            brls::Logger::info("DownloadsManager: Local path: {}", item.localPath);
 
-    brls::Logger::info("DownloadsManager: Local path: {}", item.localPath);
+            enqueueUnlocked(item);
+            m_downloads.insert(item);
+            queued++;
+        }
 
-    m_downloads.push_back(item);
-    saveState();
+        if (queued == 0) return 0;
+        total = m_downloads.size();
 
-    brls::Logger::info("DownloadsManager: Successfully queued {} for download (total in queue: {})",
-                       title, m_downloads.size());
-    return true;
+        // One snapshot and one save for the whole batch
+        publishSnapshotUnlocked();
+        data = serializeStateUnlocked(itemCount);
+    }
+
+    if (!data.empty()) writeStateToDisk(data, itemCount);
+
+    brls::Logger::info("DownloadsManager: Successfully queued {} download(s) (total in queue: {})",
+                       queued, total);
+    return queued;
 }
 
 void DownloadsManager::startDownloads() {
@@ -462,6 +157,7 @@ void DownloadsManager::startDownloads() {
     }
 
     brls::Logger::info("DownloadsManager: Starting download queue");
+    postEvent(DownloadEvent{DownloadEventType::DOWNLOADER_CHANGED});
 
     // Process downloads in background
     std::thread([this]() {
@@ -469,39 +165,43 @@ void DownloadsManager::startDownloads() {
         brls::Logger::info("DownloadsManager: Download thread started");
 
         while (m_downloading.load()) {
-            DownloadItem* nextItem = nullptr;
+            // The download runs on a copy of the item; the stored item is only
+            // touched under m_mutex (commitDownload / publishProgress)
+            DownloadItem work;
+            DownloadHandle nextHandle;
+            bool found = false;
 
             {
                 std::lock_guard<std::mutex> lock(m_mutex);
-                for (auto& item : m_downloads) {
-                    if (item.state == DownloadState::QUEUED) {
-                        item.state = DownloadState::DOWNLOADING;
-                        nextItem = &item;
-                        brls::Logger::info("DownloadsManager: Found queued item: {}", item.title);
-                        break;
+                std::string key;
+                while (!found && m_queue.pop(key)) {
+                    // Entries of items cancelled since they were queued are skipped
+                    DownloadHandle handle = m_downloads.findKey(key);
+                    DownloadItem* item = m_downloads.get(handle);
+                    if (item && item->state == DownloadState::QUEUED) {
+                        item->state = DownloadState::DOWNLOADING;
+                        markDirtyUnlocked(*item);
+                        work = *item;
+                        nextHandle = handle;
+                        found = true;
+                        brls::Logger::info("DownloadsManager: Found queued item: {}", item->title);
                     }
                 }
+                if (found) publishSnapshotUnlocked();
             }
 
-            if (nextItem) {
-                brls::Logger::info("DownloadsManager: Starting download of {}", nextItem->title);
-                downloadItem(*nextItem);
+            if (found) {
+                brls::Logger::info("DownloadsManager: Starting download of {}", work.title);
+                downloadItem(nextHandle, work);
             } else {
                 // No more items found - but re-check with lock held to prevent race condition
                 // where an item is queued just as we're about to exit
                 std::lock_guard<std::mutex> lock(m_mutex);
 
-                bool hasQueued = false;
-                for (const auto& item : m_downloads) {
-                    if (item.state == DownloadState::QUEUED) {
-                        hasQueued = true;
-                        break;
-                    }
-                }
-
-                if (!hasQueued) {
+                if (m_queue.empty()) {
                     // Truly no more items, safe to exit
                     m_downloading.store(false);
+                    postEvent(DownloadEvent{DownloadEventType::DOWNLOADER_CHANGED});
                     brls::Logger::info("DownloadsManager: All downloads complete");
                     break;
                 }
@@ -514,13 +214,93 @@ void DownloadsManager::startDownloads() {
     }).detach();
 }
 
+void DownloadsManager::enqueueUnlocked(DownloadItem& item) {
+    m_layoutDirty = true;
+    std::string key = DownloadStore::makeKey(item.itemId, item.episodeId);
+    if (item.queuePosition > 0) {
+        m_queue.restore(key, item.itemId, item.queuePosition);
+    } else {
+        item.queuePosition = m_queue.push(key, item.itemId);
+    }
+}
+
+void DownloadsManager::rebuildQueueUnlocked() {
+    m_queue.clear();
+    m_queue.setRoundRobin(Application::getInstance().getSettings().downloadRoundRobin);
+    m_layoutDirty = true;
+
+    // Saved places first, in order; items without one go to the back
+    std::vector<DownloadItem*> queued;
+    for (auto& item : m_downloads) {
+        if (item.state == DownloadState::QUEUED) {
+            queued.push_back(&item);
+        }
+    }
+    std::stable_sort(queued.begin(), queued.end(), [](const DownloadItem* a, const DownloadItem* b) {
+        if ((a->queuePosition > 0) != (b->queuePosition > 0)) return b->queuePosition <= 0;
+        return a->queuePosition < b->queuePosition;
+    });
+    for (DownloadItem* item : queued) {
+        enqueueUnlocked(*item);
+    }
+}
+
+bool DownloadsManager::moveDownload(const std::string& itemId, const std::string& episodeId, int delta) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    std::string key = DownloadStore::makeKey(itemId, episodeId);
+    std::string swapped = m_queue.move(key, delta);
+    if (swapped.empty()) return false;
+
+    for (const std::string& movedKey : {key, swapped}) {
+        if (DownloadItem* item = m_downloads.get(m_downloads.findKey(movedKey))) {
+            item->queuePosition = m_queue.position(movedKey);
+            markDirtyUnlocked(*item);
+        }
+    }
+    m_layoutDirty = true;
+    saveStateUnlocked();
+    return true;
+}
+
+bool DownloadsManager::prioritizeDownload(const std::string& itemId, const std::string& episodeId) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    std::string key = DownloadStore::makeKey(itemId, episodeId);
+    if (!m_queue.contains(key)) return false;
+
+    // Boosting renumbers the whole queue - store every job's new place
+    m_queue.boost(key);
+    for (const std::string& queuedKey : m_queue.keys()) {
+        if (DownloadItem* item = m_downloads.get(m_downloads.findKey(queuedKey))) {
+            item->queuePosition = m_queue.position(queuedKey);
+            markDirtyUnlocked(*item);
+        }
+    }
+    m_layoutDirty = true;
+    if (const DownloadItem* item = m_downloads.get(m_downloads.findKey(key))) {
+        brls::Logger::info("DownloadsManager: {} moved to the front of the queue", item->title);
+    }
+    saveStateUnlocked();
+    return true;
+}
+
+void DownloadsManager::setRoundRobin(bool enabled) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_queue.setRoundRobin(enabled);
+    publishSnapshotUnlocked();
+    brls::Logger::info("DownloadsManager: Round-robin queue {}", enabled ? "enabled" : "disabled");
+}
+
 void DownloadsManager::pauseDownloads() {
     m_downloading.store(false);
+    postEvent(DownloadEvent{DownloadEventType::DOWNLOADER_CHANGED});
 
     std::lock_guard<std::mutex> lock(m_mutex);
     for (auto& item : m_downloads) {
         if (item.state == DownloadState::DOWNLOADING) {
             item.state = DownloadState::PAUSED;
+            markDirtyUnlocked(item);
         }
     }
     saveStateUnlocked();
@@ -542,188 +322,412 @@ void DownloadsManager::waitForDownloadThread(int timeoutMs) {
 }
 
 bool DownloadsManager::cancelDownload(const std::string& itemId) {
-    brls::Logger::info("DownloadsManager: Cancelling download {}", itemId);
+    return cancelDownload(itemId, "");
+}
 
-    {
-        std::lock_guard<std::mutex> lock(m_mutex);
+bool DownloadsManager::cancelDownload(const std::string& itemId, const std::string& episodeId) {
+    brls::Logger::info("DownloadsManager: Cancelling download itemId={}, episodeId={}", itemId, episodeId);
 
-        for (auto it = m_downloads.begin(); it != m_downloads.end(); ++it) {
-            if (it->itemId == itemId) {
-                // If currently downloading, set cancellation flag
-                if (it->state == DownloadState::DOWNLOADING) {
-                    m_cancelledItemId = itemId;
-                    m_cancelledEpisodeId = it->episodeId;
-                    m_cancelRequested.store(true, std::memory_order_release);
-                    brls::Logger::info("DownloadsManager: Set cancellation flag for active download");
-                }
+    std::lock_guard<std::mutex> lock(m_mutex);
 
-                // Delete partial file if exists
-                if (!it->localPath.empty()) {
+    DownloadHandle handle = findDownloadUnlocked(itemId, episodeId);
+    DownloadItem* item = m_downloads.get(handle);
+    if (!item) return false;
+
+    // If currently downloading, set cancellation flag
+    if (item->state == DownloadState::DOWNLOADING) {
+        m_cancelledItemId = itemId;
+        m_cancelledEpisodeId = item->episodeId;
+        m_cancelRequested.store(true, std::memory_order_release);
+        brls::Logger::info("DownloadsManager: Set cancellation flag for active download");
+    }
+
+    // Delete partial file(s) if any
+    removeLocalFiles(*item);
+
+    m_queue.remove(DownloadStore::makeKey(item->itemId, item->episodeId));
+    m_dirtyItems.erase(item);
+    m_downloads.erase(handle);
+    m_layoutDirty = true;
+    saveStateUnlocked();
+    brls::Logger::info("DownloadsManager: Download cancelled and removed");
+    return true;
+}
+
+void DownloadsManager::removeLocalFiles(const DownloadItem& item) {
+    // Multi-file downloads keep their files in a folder named after the item
+    if (item.numFiles > 1) {
+        for (const auto& fi : item.files) {
+            if (!fi.localPath.empty()) {
 #ifdef __vita__
-                    sceIoRemove(it->localPath.c_str());
+                sceIoRemove(fi.localPath.c_str());
 #else
-                    std::remove(it->localPath.c_str());
+                std::remove(fi.localPath.c_str());
 #endif
-                }
+            }
+        }
+        std::string folderPath = m_downloadsPath + "/" + item.itemId;
+#ifdef __vita__
+        sceIoRmdir(folderPath.c_str());
+#else
+        std::remove(folderPath.c_str());
+#endif
+        if (item.localPath == folderPath) return;
+    }
 
-                // Delete multi-file folder if exists
-                if (it->numFiles > 1) {
-                    std::string folderPath = m_downloadsPath + "/" + it->itemId;
-                    for (const auto& fi : it->files) {
-                        if (!fi.localPath.empty()) {
+    if (!item.localPath.empty()) {
 #ifdef __vita__
-                            sceIoRemove(fi.localPath.c_str());
+        sceIoRemove(item.localPath.c_str());
 #else
-                            std::remove(fi.localPath.c_str());
+        std::remove(item.localPath.c_str());
 #endif
-                        }
-                    }
+    }
+}
+
+bool DownloadsManager::deleteDownload(const std::string& itemId) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return deleteDownloadUnlocked(findDownloadUnlocked(itemId, ""));
+}
+
+bool DownloadsManager::deleteDownloadByEpisodeId(const std::string& itemId, const std::string& episodeId) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return deleteDownloadUnlocked(m_downloads.find(itemId, episodeId));
+}
+
+bool DownloadsManager::deleteDownloadUnlocked(DownloadHandle handle) {
+    DownloadItem* item = m_downloads.get(handle);
+    if (!item) return false;
+
+    // Delete audio file(s)
+    removeLocalFiles(*item);
+    brls::Logger::info("DownloadsManager: Deleted file {}", item->localPath);
+    // Delete cover image if exists
+    if (!item->localCoverPath.empty()) {
 #ifdef __vita__
-                    sceIoRmdir(folderPath.c_str());
+        sceIoRemove(item->localCoverPath.c_str());
 #else
-                    std::remove(folderPath.c_str());
+        std::remove(item->localCoverPath.c_str());
 #endif
-                }
+        brls::Logger::debug("DownloadsManager: Deleted cover {}", item->localCoverPath);
+    }
+    std::string title = item->title;
+    m_queue.remove(DownloadStore::makeKey(item->itemId, item->episodeId));
+    m_dirtyItems.erase(item);
+    m_downloads.erase(handle);
+    m_layoutDirty = true;
+    saveStateUnlocked();
+    brls::Logger::info("DownloadsManager: Deleted download {}", title);
+    return true;
+}
 
-                m_downloads.erase(it);
-                saveStateUnlocked();
-                brls::Logger::info("DownloadsManager: Download cancelled and removed");
-                return true;
+DownloadHandle DownloadsManager::findDownloadUnlocked(const std::string& itemId, const std::string& episodeId) const {
+    if (!episodeId.empty()) {
+        return m_downloads.find(itemId, episodeId);
+    }
+    std::vector<DownloadHandle> handles = m_downloads.findAll(itemId);
+    return handles.empty() ? DownloadHandle() : handles.front();
+}
+
+DownloadHandle DownloadsManager::findCompletedUnlocked(const std::string& itemId, const std::string& episodeId) const {
+    if (!episodeId.empty()) {
+        DownloadHandle handle = m_downloads.find(itemId, episodeId);
+        const DownloadItem* item = m_downloads.get(handle);
+        return (item && item->state == DownloadState::COMPLETED) ? handle : DownloadHandle();
+    }
+    for (DownloadHandle handle : m_downloads.findAll(itemId)) {
+        if (m_downloads.get(handle)->state == DownloadState::COMPLETED) {
+            return handle;
+        }
+    }
+    return DownloadHandle();
+}
+
+static bool sameIds(const DownloadItem& a, const DownloadItem& b) {
+    return a.itemId == b.itemId && a.episodeId == b.episodeId;
+}
+
+const DownloadItem* DownloadsSnapshot::find(const std::string& itemId, const std::string& episodeId) const {
+    if (!index) return nullptr;
+    if (episodeId.empty()) {
+        auto it = index->byItemId.find(itemId);
+        return it != index->byItemId.end() ? items[it->second].get() : nullptr;
+    }
+    auto it = index->byKey.find(DownloadStore::makeKey(itemId, episodeId));
+    return it != index->byKey.end() ? items[it->second].get() : nullptr;
+}
+
+static std::shared_ptr<const DownloadsSnapshot::Index> makeIndex(
+        const std::vector<std::shared_ptr<const DownloadItem>>& items) {
+    auto index = std::make_shared<DownloadsSnapshot::Index>();
+    index->byKey.reserve(items.size());
+    for (size_t i = 0; i < items.size(); i++) {
+        index->byKey[DownloadStore::makeKey(items[i]->itemId, items[i]->episodeId)] = i;
+        index->byItemId.emplace(items[i]->itemId, i);  // Keeps the first
+    }
+    return index;
+}
+
+DownloadsSnapshotRef DownloadsManager::getSnapshot() const {
+    return std::atomic_load(&m_snapshot);
+}
+
+static DownloadEvent makeEvent(DownloadEventType type, const DownloadItem& item) {
+    DownloadEvent event;
+    event.type = type;
+    event.itemId = item.itemId;
+    event.episodeId = item.episodeId;
+    event.state = item.state;
+    event.downloadedBytes = item.downloadedBytes;
+    event.totalBytes = item.totalBytes;
+    return event;
+}
+
+void DownloadsManager::publishSnapshotUnlocked() {
+    DownloadsSnapshotRef previous = std::atomic_load(&m_snapshot);
+
+    std::unordered_map<std::string, int> queueRanks;
+    std::vector<std::string> queueKeys = m_queue.keys();
+    for (size_t i = 0; i < queueKeys.size(); i++) {
+        queueRanks[queueKeys[i]] = static_cast<int>(i);
+    }
+
+    auto snapshot = std::make_shared<DownloadsSnapshot>();
+    snapshot->version = ++m_snapshotVersion;
+    snapshot->items.reserve(m_downloads.size());
+    snapshot->queueRanks.reserve(m_downloads.size());
+
+    // Both lists are in insertion order, so one pass over the previous
+    // snapshot finds each item's old copy; the ones skipped were removed
+    size_t old = 0;
+    bool membershipChanged = false;
+    for (const auto& item : m_downloads) {
+        int rank = -1;
+        if (item.state == DownloadState::QUEUED) {
+            auto it = queueRanks.find(DownloadStore::makeKey(item.itemId, item.episodeId));
+            if (it != queueRanks.end()) rank = it->second;
+        }
+
+        size_t match = old;
+        while (match < previous->items.size() && !sameIds(*previous->items[match], item)) {
+            match++;
+        }
+
+        if (match < previous->items.size()) {
+            for (; old < match; old++) {
+                postEvent(makeEvent(DownloadEventType::REMOVED, *previous->items[old]));
+                membershipChanged = true;
+            }
+            const auto& before = previous->items[match];
+            bool moved = previous->queueRanks[match] != rank;
+            if (m_dirtyItems.count(&item)) {
+                snapshot->items.push_back(std::make_shared<const DownloadItem>(item));
+                postChangeEvent(*before, item, moved);
+            } else {
+                snapshot->items.push_back(before);
+                if (moved) postEvent(makeEvent(DownloadEventType::STATE_CHANGED, item));
             }
+            old = match + 1;
+        } else {
+            snapshot->items.push_back(std::make_shared<const DownloadItem>(item));
+            postEvent(makeEvent(DownloadEventType::ADDED, item));
+            membershipChanged = true;
+        }
+        snapshot->queueRanks.push_back(rank);
+    }
+    for (; old < previous->items.size(); old++) {
+        postEvent(makeEvent(DownloadEventType::REMOVED, *previous->items[old]));
+        membershipChanged = true;
+    }
+    snapshot->index = (membershipChanged || !previous->index) ? makeIndex(snapshot->items) : previous->index;
+
+    m_dirtyItems.clear();
+    m_layoutDirty = false;
+    std::atomic_store(&m_snapshot, DownloadsSnapshotRef(std::move(snapshot)));
+}
+
+void DownloadsManager::publishItemUnlocked(const DownloadItem& item) {
+    DownloadsSnapshotRef previous = std::atomic_load(&m_snapshot);
+    if (previous->index) {
+        auto it = previous->index->byKey.find(DownloadStore::makeKey(item.itemId, item.episodeId));
+        if (it != previous->index->byKey.end()) {
+            size_t i = it->second;
+            auto snapshot = std::make_shared<DownloadsSnapshot>(*previous);
+            snapshot->version = ++m_snapshotVersion;
+            snapshot->items[i] = std::make_shared<const DownloadItem>(item);
+            postChangeEvent(*previous->items[i], item, false);
+            m_dirtyItems.erase(&item);
+            std::atomic_store(&m_snapshot, DownloadsSnapshotRef(std::move(snapshot)));
+            return;
         }
     }
-    return false;
+
+    // Not published yet
+    publishSnapshotUnlocked();
 }
 
-bool DownloadsManager::cancelDownload(const std::string& itemId, const std::string& episodeId) {
-    brls::Logger::info("DownloadsManager: Cancelling download itemId={}, episodeId={}", itemId, episodeId);
+void DownloadsManager::markDirtyUnlocked(const DownloadItem& item) {
+    m_dirtyItems.insert(&item);
+}
 
-    {
-        std::lock_guard<std::mutex> lock(m_mutex);
+void DownloadsManager::publishChangesUnlocked() {
+    if (m_layoutDirty) {
+        publishSnapshotUnlocked();
+        return;
+    }
+    if (m_dirtyItems.empty()) return;
 
-        for (auto it = m_downloads.begin(); it != m_downloads.end(); ++it) {
-            if (it->itemId == itemId && (episodeId.empty() || it->episodeId == episodeId)) {
-                // If currently downloading, set cancellation flag
-                if (it->state == DownloadState::DOWNLOADING) {
-                    m_cancelledItemId = itemId;
-                    m_cancelledEpisodeId = it->episodeId;
-                    m_cancelRequested.store(true, std::memory_order_release);
-                    brls::Logger::info("DownloadsManager: Set cancellation flag for active download");
-                }
+    DownloadsSnapshotRef previous = std::atomic_load(&m_snapshot);
+    if (!previous->index) {
+        publishSnapshotUnlocked();
+        return;
+    }
 
-                // Delete partial file if exists
-                if (!it->localPath.empty()) {
-#ifdef __vita__
-                    sceIoRemove(it->localPath.c_str());
-#else
-                    std::remove(it->localPath.c_str());
-#endif
-                }
+    std::vector<std::pair<size_t, const DownloadItem*>> changed;
+    changed.reserve(m_dirtyItems.size());
+    for (const DownloadItem* item : m_dirtyItems) {
+        auto it = previous->index->byKey.find(DownloadStore::makeKey(item->itemId, item->episodeId));
+        if (it == previous->index->byKey.end()) {
+            // Not published yet
+            publishSnapshotUnlocked();
+            return;
+        }
+        changed.emplace_back(it->second, item);
+    }
 
-                // Delete multi-file folder if exists
-                if (it->numFiles > 1) {
-                    std::string folderPath = m_downloadsPath + "/" + it->itemId;
-                    for (const auto& fi : it->files) {
-                        if (!fi.localPath.empty()) {
-#ifdef __vita__
-                            sceIoRemove(fi.localPath.c_str());
-#else
-                            std::remove(fi.localPath.c_str());
-#endif
-                        }
-                    }
-#ifdef __vita__
-                    sceIoRmdir(folderPath.c_str());
-#else
-                    std::remove(folderPath.c_str());
-#endif
-                }
+    auto snapshot = std::make_shared<DownloadsSnapshot>(*previous);
+    snapshot->version = ++m_snapshotVersion;
+    for (const auto& entry : changed) {
+        size_t i = entry.first;
+        const DownloadItem& item = *entry.second;
+        snapshot->items[i] = std::make_shared<const DownloadItem>(item);
+        // Entering the queue marks the layout dirty; leaving it only drops the rank
+        if (item.state != DownloadState::QUEUED) snapshot->queueRanks[i] = -1;
+        postChangeEvent(*previous->items[i], item, snapshot->queueRanks[i] != previous->queueRanks[i]);
+    }
+    m_dirtyItems.clear();
+    std::atomic_store(&m_snapshot, DownloadsSnapshotRef(std::move(snapshot)));
+}
 
-                m_downloads.erase(it);
-                saveStateUnlocked();
-                brls::Logger::info("DownloadsManager: Download cancelled and removed");
-                return true;
-            }
-        }
+void DownloadsManager::postChangeEvent(const DownloadItem& before, const DownloadItem& after, bool moved) {
+    if (moved || before.state != after.state || before.title != after.title ||
+        before.authorName != after.authorName || before.coverUrl != after.coverUrl ||
+        before.localCoverPath != after.localCoverPath) {
+        postEvent(makeEvent(DownloadEventType::STATE_CHANGED, after));
+    } else if (before.downloadedBytes != after.downloadedBytes || before.totalBytes != after.totalBytes) {
+        postEvent(makeEvent(DownloadEventType::PROGRESS, after));
     }
-    return false;
 }
 
-bool DownloadsManager::deleteDownload(const std::string& itemId) {
-    std::lock_guard<std::mutex> lock(m_mutex);
+void DownloadsManager::postEvent(DownloadEvent event) {
+    std::lock_guard<std::mutex> lock(m_eventMutex);
+    if (m_eventListeners.empty()) return;
 
-    for (auto it = m_downloads.begin(); it != m_downloads.end(); ++it) {
-        if (it->itemId == itemId) {
-            // Delete audio file
-            if (!it->localPath.empty()) {
-#ifdef __vita__
-                sceIoRemove(it->localPath.c_str());
-#else
-                std::remove(it->localPath.c_str());
-#endif
-                brls::Logger::info("DownloadsManager: Deleted file {}", it->localPath);
-            }
-            // Delete cover image if exists
-            if (!it->localCoverPath.empty()) {
-#ifdef __vita__
-                sceIoRemove(it->localCoverPath.c_str());
-#else
-                std::remove(it->localCoverPath.c_str());
-#endif
-                brls::Logger::debug("DownloadsManager: Deleted cover {}", it->localCoverPath);
-            }
-            m_downloads.erase(it);
-            saveStateUnlocked();
-            brls::Logger::info("DownloadsManager: Deleted download {}", itemId);
-            return true;
+    for (auto& pending : m_pendingEvents) {
+        if (pending.itemId == event.itemId && pending.episodeId == event.episodeId) {
+            // Newer data wins, but progress doesn't hide an earlier change
+            if (event.type == DownloadEventType::PROGRESS) event.type = pending.type;
+            pending = std::move(event);
+            return;
         }
     }
-    return false;
+    m_pendingEvents.push_back(std::move(event));
+
+    // One dispatch per batch, however many events arrive before it runs
+    if (!m_dispatchScheduled) {
+        m_dispatchScheduled = true;
+        brls::sync([this]() { dispatchEvents(); });
+    }
 }
 
-bool DownloadsManager::deleteDownloadByEpisodeId(const std::string& itemId, const std::string& episodeId) {
+void DownloadsManager::dispatchEvents() {
+    std::vector<DownloadEvent> events;
+    std::vector<DownloadEventListener> listeners;
+    {
+        std::lock_guard<std::mutex> lock(m_eventMutex);
+        events.swap(m_pendingEvents);
+        m_dispatchScheduled = false;
+        // Copy the listeners so they may (un)subscribe while being called
+        for (const auto& entry : m_eventListeners) {
+            listeners.push_back(entry.second);
+        }
+    }
+
+    for (const auto& listener : listeners) {
+        listener(events);
+    }
+}
+
+int DownloadsManager::subscribeEvents(DownloadEventListener listener) {
+    std::lock_guard<std::mutex> lock(m_eventMutex);
+    int id = m_nextListenerId++;
+    m_eventListeners[id] = std::move(listener);
+    return id;
+}
+
+void DownloadsManager::unsubscribeEvents(int id) {
+    std::lock_guard<std::mutex> lock(m_eventMutex);
+    m_eventListeners.erase(id);
+    if (m_eventListeners.empty()) {
+        m_pendingEvents.clear();
+    }
+}
+
+void DownloadsManager::publishProgress(DownloadHandle handle, const DownloadItem& item) {
+    // Chunks arrive far more often than the UI can show them
+    auto now = std::chrono::steady_clock::now();
+    if (now - m_lastProgressPublish < std::chrono::milliseconds(250)) return;
+    m_lastProgressPublish = now;
+
     std::lock_guard<std::mutex> lock(m_mutex);
+    DownloadItem* stored = m_downloads.get(handle);
+    if (!stored) return;  // Cancelled meanwhile
 
-    for (auto it = m_downloads.begin(); it != m_downloads.end(); ++it) {
-        if (it->itemId == itemId && it->episodeId == episodeId) {
-            // Delete audio file
-            if (!it->localPath.empty()) {
-#ifdef __vita__
-                sceIoRemove(it->localPath.c_str());
-#else
-                std::remove(it->localPath.c_str());
-#endif
-                brls::Logger::info("DownloadsManager: Deleted file {}", it->localPath);
-            }
-            // Delete cover image if exists
-            if (!it->localCoverPath.empty()) {
-#ifdef __vita__
-                sceIoRemove(it->localCoverPath.c_str());
-#else
-                std::remove(it->localCoverPath.c_str());
-#endif
-                brls::Logger::debug("DownloadsManager: Deleted cover {}", it->localCoverPath);
-            }
-            std::string title = it->title;
-            m_downloads.erase(it);
-            saveStateUnlocked();
-            brls::Logger::info("DownloadsManager: Deleted episode download {} ({})", title, episodeId);
-            return true;
-        }
+    stored->downloadedBytes = item.downloadedBytes;
+    stored->totalBytes = item.totalBytes;
+    stored->currentFileIndex = item.currentFileIndex;
+    publishItemUnlocked(*stored);
+}
+
+void DownloadsManager::commitDownload(DownloadHandle handle, const DownloadItem& item) {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        DownloadItem* stored = m_downloads.get(handle);
+        if (!stored) return;  // Cancelled or deleted meanwhile
+
+        // Only the fields the download thread fills in; progress and metadata
+        // updates made while it ran are kept
+        stored->state = item.state;
+        stored->localPath = item.localPath;
+        stored->localCoverPath = item.localCoverPath;
+        stored->description = item.description;
+        stored->totalBytes = item.totalBytes;
+        stored->downloadedBytes = item.downloadedBytes;
+        stored->numChapters = item.numChapters;
+        stored->chapters = item.chapters;
+        stored->numFiles = item.numFiles;
+        stored->currentFileIndex = item.currentFileIndex;
+        stored->files = item.files;
+        markDirtyUnlocked(*stored);
     }
-    return false;
+    saveState();
 }
 
 std::vector<DownloadItem> DownloadsManager::getDownloads() const {
-    std::lock_guard<std::mutex> lock(m_mutex);
-    return m_downloads;
+    DownloadsSnapshotRef snapshot = getSnapshot();
+    std::vector<DownloadItem> downloads;
+    downloads.reserve(snapshot->items.size());
+    for (const auto& item : snapshot->items) {
+        downloads.push_back(*item);
+    }
+    return downloads;
 }
 
 std::vector<DownloadsManager::DownloadStateInfo> DownloadsManager::getDownloadStates() const {
-    std::lock_guard<std::mutex> lock(m_mutex);
+    DownloadsSnapshotRef snapshot = getSnapshot();
     std::vector<DownloadStateInfo> states;
-    states.reserve(m_downloads.size());
-    for (const auto& item : m_downloads) {
+    states.reserve(snapshot->items.size());
+    for (size_t i = 0; i < snapshot->items.size(); i++) {
+        const DownloadItem& item = *snapshot->items[i];
         DownloadStateInfo info;
         info.itemId = item.itemId;
         info.episodeId = item.episodeId;
@@ -734,85 +738,59 @@ std::vector<DownloadsManager::DownloadStateInfo> DownloadsManager::getDownloadSt
         info.downloadedBytes = item.downloadedBytes;
         info.totalBytes = item.totalBytes;
         info.state = item.state;
+        info.queueRank = snapshot->queueRanks[i];
         states.push_back(std::move(info));
     }
     return states;
 }
 
-DownloadItem* DownloadsManager::getDownload(const std::string& itemId) {
-    std::lock_guard<std::mutex> lock(m_mutex);
-    for (auto& item : m_downloads) {
-        if (item.itemId == itemId) {
-            return &item;
-        }
-    }
-    return nullptr;
-}
-
-DownloadItem* DownloadsManager::getDownload(const std::string& itemId, const std::string& episodeId) {
-    std::lock_guard<std::mutex> lock(m_mutex);
-    for (auto& item : m_downloads) {
-        if (item.itemId == itemId) {
-            // For episodes, also check episodeId
-            if (episodeId.empty() || item.episodeId == episodeId) {
-                return &item;
-            }
-        }
-    }
-    return nullptr;
-}
-
 bool DownloadsManager::isDownloaded(const std::string& itemId, const std::string& episodeId) const {
     std::lock_guard<std::mutex> lock(m_mutex);
-    for (const auto& item : m_downloads) {
-        if (item.itemId == itemId && item.state == DownloadState::COMPLETED) {
-            // For episodes, also check episodeId
-            if (episodeId.empty() || item.episodeId == episodeId) {
-                return true;
-            }
-        }
-    }
-    return false;
+    return findCompletedUnlocked(itemId, episodeId).valid();
 }
 
 std::string DownloadsManager::getLocalPath(const std::string& itemId) const {
     std::lock_guard<std::mutex> lock(m_mutex);
-    for (const auto& item : m_downloads) {
-        if (item.itemId == itemId && item.state == DownloadState::COMPLETED) {
-            return item.localPath;
+    const DownloadItem* item = m_downloads.get(findCompletedUnlocked(itemId, ""));
+    return item ? item->localPath : "";
+}
+
+VirtualTimeline DownloadsManager::makeTimeline(const DownloadItem& item) {
+    VirtualTimeline timeline;
+    if (item.numFiles > 1 && !item.files.empty()) {
+        for (const auto& fi : item.files) {
+            timeline.addSegment(fi.localPath, fi.duration);
         }
+    } else {
+        timeline.addSegment(item.localPath, item.duration);
     }
-    return "";
+    return timeline;
 }
 
 std::string DownloadsManager::getPlaybackPath(const std::string& itemId) const {
     std::lock_guard<std::mutex> lock(m_mutex);
-    for (const auto& item : m_downloads) {
-        if (item.itemId == itemId && item.state == DownloadState::COMPLETED) {
-            // For multi-file audiobooks, return the first file
-            if (item.numFiles > 1 && !item.files.empty()) {
-                brls::Logger::debug("DownloadsManager: Multi-file audiobook, returning first file: {}",
-                                   item.files[0].localPath);
-                return item.files[0].localPath;
-            }
-            // Single file or direct path
-            return item.localPath;
-        }
+    const DownloadItem* item = m_downloads.get(findCompletedUnlocked(itemId, ""));
+    if (!item) return "";
+
+    // Multi-file audiobooks play all files as one timeline
+    if (item->numFiles > 1 && !item->files.empty()) {
+        brls::Logger::debug("DownloadsManager: Multi-file audiobook, playing {} files as one timeline",
+                           item->files.size());
+        return makeTimeline(*item).toEdlUrl();
     }
-    return "";
+    // Single file or direct path
+    return item->localPath;
 }
 
 void DownloadsManager::updateProgress(const std::string& itemId, float currentTime, const std::string& episodeId) {
     std::lock_guard<std::mutex> lock(m_mutex);
-    for (auto& item : m_downloads) {
-        // Match by itemId and episodeId (episodeId is empty for books, non-empty for podcasts)
-        if (item.itemId == itemId && (episodeId.empty() || item.episodeId == episodeId)) {
-            item.currentTime = currentTime;
-            item.viewOffset = static_cast<int64_t>(currentTime * 1000.0f);  // Convert to milliseconds
-            brls::Logger::debug("DownloadsManager: Updated progress for '{}' to {}s",
-                               item.title, currentTime);
-            break;
-        }
+    // Match by itemId and episodeId (episodeId is empty for books, non-empty for podcasts)
+    if (DownloadItem* item = m_downloads.get(findDownloadUnlocked(itemId, episodeId))) {
+        item->currentTime = currentTime;
+        item->viewOffset = static_cast<int64_t>(currentTime * 1000.0f);  // Convert to milliseconds
+        publishItemUnlocked(*item);
+        brls::Logger::debug("DownloadsManager: Updated progress for '{}' to {}s",
+                           item->title, currentTime);
     }
     // Don't save on every update - too frequent
 }
@@ -840,11 +818,9 @@ void DownloadsManager::syncProgressToServer() {
         if (client.updateProgress(item.itemId, item.currentTime, item.duration, isFinished, item.episodeId)) {
             std::lock_guard<std::mutex> lock(m_mutex);
             // Update last synced time
-            for (auto& d : m_downloads) {
-                if (d.itemId == item.itemId) {
-                    d.lastSynced = std::time(nullptr);
-                    break;
-                }
+            if (DownloadItem* d = m_downloads.get(m_downloads.find(item.itemId, item.episodeId))) {
+                d->lastSynced = std::time(nullptr);
+                markDirtyUnlocked(*d);
             }
             brls::Logger::debug("DownloadsManager: Synced progress for {}", item.title);
         }
@@ -897,23 +873,19 @@ bool DownloadsManager::fetchProgressFromServer(const std::string& itemId, const
     brls::Logger::info("DownloadsManager: Server returned progress {}s for {}", serverTime, itemId);
 
     std::lock_guard<std::mutex> lock(m_mutex);
-    for (auto& item : m_downloads) {
-        brls::Logger::debug("DownloadsManager: Checking download item '{}' itemId={} episodeId={}",
-                           item.title, item.itemId, item.episodeId.empty() ? "(none)" : item.episodeId);
-
-        if (item.itemId == itemId && item.episodeId == episodeId) {
-            // Only update if server progress is ahead of local progress
-            if (serverTime > item.currentTime) {
-                brls::Logger::info("DownloadsManager: Updating '{}' from {}s to {}s (from server)",
-                                  item.title, item.currentTime, serverTime);
-                item.currentTime = serverTime;
-                item.viewOffset = static_cast<int64_t>(serverTime * 1000.0f);
-            } else {
-                brls::Logger::info("DownloadsManager: Local progress {}s >= server {}s for '{}', keeping local",
-                                   item.currentTime, serverTime, item.title);
-            }
-            return true;
+    if (DownloadItem* item = m_downloads.get(m_downloads.find(itemId, episodeId))) {
+        // Only update if server progress is ahead of local progress
+        if (serverTime > item->currentTime) {
+            brls::Logger::info("DownloadsManager: Updating '{}' from {}s to {}s (from server)",
+                              item->title, item->currentTime, serverTime);
+            item->currentTime = serverTime;
+            item->viewOffset = static_cast<int64_t>(serverTime * 1000.0f);
+            publishItemUnlocked(*item);
+        } else {
+            brls::Logger::info("DownloadsManager: Local progress {}s >= server {}s for '{}', keeping local",
+                               item->currentTime, serverTime, item->title);
         }
+        return true;
     }
 
     brls::Logger::warning("DownloadsManager: No matching download found for itemId={} episodeId={}",
@@ -933,7 +905,21 @@ void DownloadsManager::clearCancelFlag() {
     m_cancelledEpisodeId.clear();
 }
 
-void DownloadsManager::downloadItem(DownloadItem& item) {
+void DownloadsManager::storePlanMetadata(DownloadItem& item, const DownloadPlan& plan) {
+    item.description = plan.item.description;
+    item.chapters.clear();
+    for (const auto& ch : plan.item.chapters) {
+        DownloadChapter dch;
+        dch.title = ch.title;
+        dch.start = ch.start;
+        dch.end = ch.end;
+        item.chapters.push_back(dch);
+    }
+    item.numChapters = static_cast<int>(item.chapters.size());
+    brls::Logger::info("DownloadsManager: Stored {} chapters for offline use", item.chapters.size());
+}
+
+void DownloadsManager::downloadItem(DownloadHandle handle, DownloadItem& item) {
     brls::Logger::info("DownloadsManager: Starting download of {}", item.title);
     brls::Logger::info("DownloadsManager: Item ID: {}, Episode ID: {}, Type: {}",
                        item.itemId, item.episodeId.empty() ? "(none)" : item.episodeId, item.mediaType);
@@ -951,17 +937,20 @@ void DownloadsManager::downloadItem(DownloadItem& item) {
     if (serverUrl.empty() || token.empty()) {
         brls::Logger::error("DownloadsManager: Not connected to server");
         item.state = DownloadState::FAILED;
-        saveState();
+        commitDownload(handle, item);
         return;
     }
 
-    // Check if this is a multi-file audiobook
-    std::vector<AudioFileInfo> audioFiles;
-    if (item.episodeId.empty() && item.mediaType == "book") {
-        brls::Logger::info("DownloadsManager: Checking for multi-file audiobook...");
-        client.getAudioFiles(item.itemId, audioFiles);
-        brls::Logger::info("DownloadsManager: Found {} audio files", audioFiles.size());
+    // Files, chapters and description all come from one item request
+    DownloadPlan plan;
+    if (!client.fetchDownloadPlan(item.itemId, item.episodeId, plan)) {
+        brls::Logger::error("DownloadsManager: Failed to get download plan for {}", item.itemId);
+        item.state = DownloadState::FAILED;
+        commitDownload(handle, item);
+        return;
     }
+    const std::vector<AudioFileInfo>& audioFiles = plan.files;
+    brls::Logger::info("DownloadsManager: Found {} audio files", audioFiles.size());
 
     if (audioFiles.size() > 1) {
         // Multi-file audiobook - download all files and create M3U playlist
@@ -986,6 +975,7 @@ void DownloadsManager::downloadItem(DownloadItem& item) {
             fi.filename = af.filename;
             fi.localPath = folderPath + "/" + af.filename;
             fi.size = af.size;
+            fi.duration = af.duration;
             fi.downloaded = false;
             item.files.push_back(fi);
             item.totalBytes += af.size;
@@ -1011,7 +1001,7 @@ void DownloadsManager::downloadItem(DownloadItem& item) {
             auto& fi = item.files[i];
             item.currentFileIndex = static_cast<int>(i);
 
-            std::string url = client.getFileDownloadUrlByIno(item.itemId, fi.ino);
+            std::string url = client.getFileDownloadUrl(plan, i);
             brls::Logger::info("DownloadsManager: Downloading file {}/{}: {}",
                               i + 1, item.files.size(), fi.filename);
 
@@ -1042,6 +1032,7 @@ void DownloadsManager::downloadItem(DownloadItem& item) {
                     file.write(data, size);
 #endif
                     item.downloadedBytes += size;
+                    publishProgress(handle, item);
                     if (m_progressCallback && item.totalBytes > 0) {
                         m_progressCallback(static_cast<float>(item.downloadedBytes),
                                            static_cast<float>(item.totalBytes));
@@ -1075,112 +1066,31 @@ void DownloadsManager::downloadItem(DownloadItem& item) {
         }
 
         if (allComplete) {
-            // Use FFmpeg to combine all files into a single audiobook
-            brls::Logger::info("DownloadsManager: All {} files downloaded, combining with FFmpeg...", item.files.size());
-
-            // Collect file paths in order for concatenation
-            std::vector<std::string> filePaths;
-            for (const auto& fi : item.files) {
-                filePaths.push_back(fi.localPath);
-            }
+            // The files stay as they are and play back to back through a
+            // virtual timeline - no second pass to concatenate them
+            item.localPath = folderPath;
+            item.state = DownloadState::COMPLETED;
+            brls::Logger::info("DownloadsManager: Completed multi-file download: {} ({} files)",
+                              item.title, item.files.size());
 
-            // Determine output extension from source files (mp3 -> mp3, m4a -> m4b)
-            std::string outputExt = ".mp3";  // Default to mp3 since Vita lacks mp4 muxer
-            if (!item.files.empty()) {
-                const std::string& firstFile = item.files[0].localPath;
-                size_t dotPos = firstFile.rfind('.');
-                if (dotPos != std::string::npos) {
-                    std::string srcExt = firstFile.substr(dotPos);
-                    if (srcExt == ".m4a" || srcExt == ".m4b" || srcExt == ".mp4") {
-                        outputExt = ".m4b";
-                    } else if (srcExt == ".ogg") {
-                        outputExt = ".ogg";
-                    } else if (srcExt == ".flac") {
-                        outputExt = ".flac";
-                    }
-                    // else keep .mp3 for mp3 and other formats
-                }
+            // Download cover image for offline use
+            if (!item.coverUrl.empty()) {
+                item.localCoverPath = downloadCoverImage(item.itemId, item.coverUrl);
             }
 
-            // Combined output file path
-            std::string combinedPath = m_downloadsPath + "/" + item.itemId + outputExt;
-
-            // Run FFmpeg concatenation
-            bool concatSuccess = concatenateAudioFiles(filePaths, combinedPath,
-                [this](int current, int total) {
-                    brls::Logger::debug("DownloadsManager: Concatenation progress: {} packets", current);
-                }
-            );
-
-            if (concatSuccess) {
-                brls::Logger::info("DownloadsManager: Successfully combined {} files into {}", item.files.size(), combinedPath);
-
-                // Delete individual files to save space
-                for (const auto& fi : item.files) {
-#ifdef __vita__
-                    sceIoRemove(fi.localPath.c_str());
-#else
-                    std::remove(fi.localPath.c_str());
-#endif
-                }
-
-                // Remove the temp folder
-#ifdef __vita__
-                sceIoRmdir(folderPath.c_str());
-#else
-                std::remove(folderPath.c_str());
-#endif
-
-                // Update item to point to combined file
-                item.localPath = combinedPath;
-                item.files.clear();
-                item.numFiles = 1;
-                item.state = DownloadState::COMPLETED;
-                brls::Logger::info("DownloadsManager: Completed combined download: {}", item.title);
-
-                // Download cover image for offline use
-                if (!item.coverUrl.empty()) {
-                    item.localCoverPath = downloadCoverImage(item.itemId, item.coverUrl);
-                }
-
-                // Fetch and store metadata (description, chapters) for offline use
-                MediaItem mediaInfo;
-                if (client.fetchItem(item.itemId, mediaInfo)) {
-                    item.description = mediaInfo.description;
-                    item.numChapters = static_cast<int>(mediaInfo.chapters.size());
-                    item.chapters.clear();
-                    for (const auto& ch : mediaInfo.chapters) {
-                        DownloadChapter dch;
-                        dch.title = ch.title;
-                        dch.start = ch.start;
-                        dch.end = ch.end;
-                        item.chapters.push_back(dch);
-                    }
-                    brls::Logger::info("DownloadsManager: Stored {} chapters for offline use", item.chapters.size());
-                }
-
-                // Notify completion
-                if (m_itemCompletionCallback) {
-                    m_itemCompletionCallback(item.itemId, item.episodeId, true);
-                }
-            } else {
-                brls::Logger::error("DownloadsManager: FFmpeg concatenation failed, falling back to first file");
-                // Fallback: use first file if concatenation fails
-                item.localPath = item.files[0].localPath;
-                item.state = DownloadState::COMPLETED;
-                if (m_itemCompletionCallback) {
-                    m_itemCompletionCallback(item.itemId, item.episodeId, true);
-                }
-            }
+            // Store metadata (description, chapters) for offline use
+            storePlanMetadata(item, plan);
         } else if (!m_downloading.load()) {
             item.state = DownloadState::PAUSED;
         } else {
             item.state = DownloadState::FAILED;
-            if (m_itemCompletionCallback) {
-                m_itemCompletionCallback(item.itemId, item.episodeId, false);
-            }
         }
-        saveState();
+        commitDownload(handle, item);
+
+        // Notify completion once the stored item shows the result
+        if (m_itemCompletionCallback && item.state != DownloadState::PAUSED) {
+            m_itemCompletionCallback(item.itemId, item.episodeId, item.state == DownloadState::COMPLETED);
+        }
         return;
     }
 
@@ -1189,15 +1099,7 @@ void DownloadsManager::downloadItem(DownloadItem& item) {
     brls::Logger::info("DownloadsManager: Getting download URL for item: {}, episode: {}",
                        item.itemId, item.episodeId.empty() ? "(none)" : item.episodeId);
 
-    std::string url = client.getFileDownloadUrl(item.itemId, item.episodeId);
-
-    if (url.empty()) {
-        brls::Logger::error("DownloadsManager: Failed to get download URL for {}", item.itemId);
-        brls::Logger::error("DownloadsManager: This usually means the file ino could not be found");
-        item.state = DownloadState::FAILED;
-        saveState();
-        return;
-    }
+    std::string url = client.getFileDownloadUrl(plan);
 
     brls::Logger::info("DownloadsManager: Download URL: {}", url);
     brls::Logger::info("DownloadsManager: Local path: {}", item.localPath);
@@ -1208,7 +1110,7 @@ void DownloadsManager::downloadItem(DownloadItem& item) {
     if (fd < 0) {
         brls::Logger::error("DownloadsManager: Failed to create file {}", item.localPath);
         item.state = DownloadState::FAILED;
-        saveState();
+        commitDownload(handle, item);
         return;
     }
 #else
@@ -1216,7 +1118,7 @@ void DownloadsManager::downloadItem(DownloadItem& item) {
     if (!file.is_open()) {
         brls::Logger::error("DownloadsManager: Failed to create file {}", item.localPath);
         item.state = DownloadState::FAILED;
-        saveState();
+        commitDownload(handle, item);
         return;
     }
 #endif
@@ -1247,6 +1149,7 @@ void DownloadsManager::downloadItem(DownloadItem& item) {
             file.write(data, size);
 #endif
             item.downloadedBytes += size;
+            publishProgress(handle, item);
 
             // Call progress callback
             if (m_progressCallback && item.totalBytes > 0) {
@@ -1290,26 +1193,8 @@ void DownloadsManager::downloadItem(DownloadItem& item) {
             item.localCoverPath = downloadCoverImage(item.itemId, item.coverUrl);
         }
 
-        // Fetch and store metadata (description, chapters) for offline use
-        MediaItem mediaInfo;
-        if (client.fetchItem(item.itemId, mediaInfo)) {
-            item.description = mediaInfo.description;
-            item.numChapters = static_cast<int>(mediaInfo.chapters.size());
-            item.chapters.clear();
-            for (const auto& ch : mediaInfo.chapters) {
-                DownloadChapter dch;
-                dch.title = ch.title;
-                dch.start = ch.start;
-                dch.end = ch.end;
-                item.chapters.push_back(dch);
-            }
-            brls::Logger::info("DownloadsManager: Stored {} chapters for offline use", item.chapters.size());
-        }
-
-        // Notify completion
-        if (m_itemCompletionCallback) {
-            m_itemCompletionCallback(item.itemId, item.episodeId, true);
-        }
+        // Store metadata (description, chapters) for offline use
+        storePlanMetadata(item, plan);
     } else if (!m_downloading.load()) {
         item.state = DownloadState::PAUSED;
         brls::Logger::info("DownloadsManager: Paused download of {}", item.title);
@@ -1322,12 +1207,13 @@ void DownloadsManager::downloadItem(DownloadItem& item) {
 #else
         std::remove(item.localPath.c_str());
 #endif
-        if (m_itemCompletionCallback) {
-            m_itemCompletionCallback(item.itemId, item.episodeId, false);
-        }
     }
+    commitDownload(handle, item);
 
-    saveState();
+    // Notify completion once the stored item shows the result
+    if (m_itemCompletionCallback && item.state != DownloadState::PAUSED) {
+        m_itemCompletionCallback(item.itemId, item.episodeId, item.state == DownloadState::COMPLETED);
+    }
 }
 
 // Helper to escape JSON strings
@@ -1353,6 +1239,7 @@ void DownloadsManager::saveState() {
     size_t itemCount = 0;
     {
         std::lock_guard<std::mutex> lock(m_mutex);
+        publishChangesUnlocked();
         data = serializeStateUnlocked(itemCount);
         if (data.empty()) return;  // Debounced, nothing to write
     }
@@ -1364,15 +1251,14 @@ void DownloadsManager::saveState() {
 
 void DownloadsManager::saveStateUnlocked() {
     // Called from code that already holds m_mutex
+    publishChangesUnlocked();
     size_t itemCount = 0;
     std::string data = serializeStateUnlocked(itemCount);
     if (data.empty()) return;  // Debounced
 
-    // Note: When called from the download thread (which holds m_mutex),
-    // we still do disk I/O under lock here. This is acceptable because:
-    // 1) The 500ms debounce limits frequency
-    // 2) The UI thread now uses getDownloadStates() which is fast
-    // 3) The download thread is the only one calling this path frequently
+    // The write happens under m_mutex, so this is for changes made under the
+    // lock (cancel, delete, reorder, registering downloads). The download
+    // thread saves through saveState, which writes outside the lock
     writeStateToDisk(data, itemCount);
 }
 
@@ -1391,8 +1277,10 @@ std::string DownloadsManager::serializeStateUnlocked(size_t& outItemCount) {
     std::stringstream ss;
     ss << "{\n\"downloads\":[\n";
 
-    for (size_t i = 0; i < m_downloads.size(); ++i) {
-        const auto& item = m_downloads[i];
+    bool firstItem = true;
+    for (const auto& item : m_downloads) {
+        if (!firstItem) ss << ",\n";
+        firstItem = false;
         ss << "{\n"
            << "\"itemId\":\"" << item.itemId << "\",\n"
            << "\"episodeId\":\"" << item.episodeId << "\",\n"
@@ -1413,7 +1301,8 @@ std::string DownloadsManager::serializeStateUnlocked(size_t& outItemCount) {
            << "\"numChapters\":" << item.numChapters << ",\n"
            << "\"numFiles\":" << item.numFiles << ",\n"
            << "\"state\":" << static_cast<int>(item.state) << ",\n"
-           << "\"lastSynced\":" << item.lastSynced << ",\n";
+           << "\"lastSynced\":" << item.lastSynced << ",\n"
+           << "\"queuePosition\":" << item.queuePosition << ",\n";
 
         // Save chapters for offline use
         ss << "\"chapters\":[";
@@ -1437,17 +1326,15 @@ std::string DownloadsManager::serializeStateUnlocked(size_t& outItemCount) {
                << "\"filename\":\"" << fi.filename << "\","
                << "\"localPath\":\"" << fi.localPath << "\","
                << "\"size\":" << fi.size << ","
+               << "\"duration\":" << fi.duration << ","
                << "\"downloaded\":" << (fi.downloaded ? "true" : "false")
                << "}";
             if (j < item.files.size() - 1) ss << ",";
         }
         ss << "]\n}";
-
-        if (i < m_downloads.size() - 1) ss << ",";
-        ss << "\n";
     }
 
-    ss << "]\n}";
+    ss << "\n]\n}";
     return ss.str();
 }
 
@@ -1502,6 +1389,7 @@ void DownloadsManager::loadState() {
     // Clear existing downloads before loading to prevent duplicates
     {
         std::lock_guard<std::mutex> lock(m_mutex);
+        m_dirtyItems.clear();
         m_downloads.clear();
     }
 
@@ -1515,11 +1403,7 @@ void DownloadsManager::loadState() {
         if (valueStart == std::string::npos) return "";
 
         if (json[valueStart] == '"') {
-            size_t valueEnd = valueStart + 1;
-            while (valueEnd < json.length()) {
-                if (json[valueEnd] == '"' && json[valueEnd - 1] != '\\') break;
-                valueEnd++;
-            }
+            size_t valueEnd = findJsonStringEnd(json, valueStart);
             return json.substr(valueStart + 1, valueEnd - valueStart - 1);
         } else if (json[valueStart] == 't' || json[valueStart] == 'f') {
             // Boolean
@@ -1572,13 +1456,7 @@ void DownloadsManager::loadState() {
         }
 
         // Find the end of this object (matching braces)
-        int braceCount = 1;
-        size_t objEnd = objStart + 1;
-        while (braceCount > 0 && objEnd < content.length()) {
-            if (content[objEnd] == '{') braceCount++;
-            else if (content[objEnd] == '}') braceCount--;
-            objEnd++;
-        }
+        size_t objEnd = findJsonContainerEnd(content, objStart);
 
         std::string itemJson = content.substr(objStart, objEnd - objStart);
 
@@ -1648,6 +1526,9 @@ void DownloadsManager::loadState() {
         std::string lastSyncedStr = extractValue(itemJson, "lastSynced");
         item.lastSynced = lastSyncedStr.empty() ? 0 : std::stoll(lastSyncedStr);
 
+        std::string queuePositionStr = extractValue(itemJson, "queuePosition");
+        item.queuePosition = queuePositionStr.empty() ? 0 : std::stoll(queuePositionStr);
+
         // Parse chapters array for offline playback
         size_t chaptersStart = itemJson.find("\"chapters\":[");
         if (chaptersStart != std::string::npos) {
@@ -1710,6 +1591,9 @@ void DownloadsManager::loadState() {
                     std::string sizeStr = extractValue(fileJson, "size");
                     fi.size = sizeStr.empty() ? 0 : std::stoll(sizeStr);
 
+                    std::string fileDurationStr = extractValue(fileJson, "duration");
+                    fi.duration = fileDurationStr.empty() ? 0.0f : std::stof(fileDurationStr);
+
                     fi.downloaded = extractValue(fileJson, "downloaded") == "true";
 
                     if (!fi.localPath.empty()) {
@@ -1723,17 +1607,12 @@ void DownloadsManager::loadState() {
 
         if (!item.itemId.empty()) {
             // Check for duplicates - skip if already have this itemId/episodeId combo
-            bool isDuplicate = false;
-            for (const auto& existing : m_downloads) {
-                if (existing.itemId == item.itemId && existing.episodeId == item.episodeId) {
-                    isDuplicate = true;
-                    brls::Logger::warning("DownloadsManager: Skipping duplicate item: {} ({})",
-                                         item.title, item.itemId);
-                    break;
-                }
-            }
-            if (!isDuplicate) {
-                m_downloads.push_back(item);
+            bool isDuplicate = m_downloads.find(item.itemId, item.episodeId).valid();
+            if (isDuplicate) {
+                brls::Logger::warning("DownloadsManager: Skipping duplicate item: {} ({})",
+                                     item.title, item.itemId);
+            } else {
+                m_downloads.insert(item);
                 parsedCount++;
                 brls::Logger::debug("DownloadsManager: Loaded download: {} (itemId: {}, state: {})",
                                    item.title, item.itemId, static_cast<int>(item.state));
@@ -1745,6 +1624,16 @@ void DownloadsManager::loadState() {
         pos = objEnd;
     }
 
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        // Every item is new to the snapshot, even one with an id it already holds
+        for (const auto& item : m_downloads) {
+            markDirtyUnlocked(item);
+        }
+        rebuildQueueUnlocked();
+        publishSnapshotUnlocked();
+    }
+
     brls::Logger::info("DownloadsManager: Loaded {} downloads from state (parsed: {}, skipped nested: {})",
                        m_downloads.size(), parsedCount, skippedCount);
 }
@@ -1849,11 +1738,7 @@ int DownloadsManager::scanDownloadsFolder() {
             if (valueStart == std::string::npos) return "";
 
             if (json[valueStart] == '"') {
-                size_t valueEnd = valueStart + 1;
-                while (valueEnd < json.length()) {
-                    if (json[valueEnd] == '"' && json[valueEnd - 1] != '\\') break;
-                    valueEnd++;
-                }
+                size_t valueEnd = findJsonStringEnd(json, valueStart);
                 return json.substr(valueStart + 1, valueEnd - valueStart - 1);
             } else {
                 size_t valueEnd = json.find_first_of(",}]", valueStart);
@@ -1922,6 +1807,7 @@ int DownloadsManager::scanDownloadsFolder() {
 
     // Collect new items first, then add them (to avoid holding lock during network calls)
     std::vector<DownloadItem> newItems;
+    std::vector<size_t> needsServerMetadata;  // Indices into newItems
 
 #ifdef __vita__
     SceUID dir = sceIoDopen(m_downloadsPath.c_str());
@@ -1996,47 +1882,9 @@ int DownloadsManager::scanDownloadsFolder() {
         if (hasLocalMetadata) {
             brls::Logger::info("DownloadsManager: Using local metadata for {}", itemId);
         } else {
-            // Try to fetch metadata from server if connected
-            AudiobookshelfClient& client = AudiobookshelfClient::getInstance();
-            if (client.isAuthenticated()) {
-                MediaItem mediaInfo;
-                if (client.fetchItem(itemId, mediaInfo)) {
-                    brls::Logger::info("DownloadsManager: Fetched metadata for {} from server", itemId);
-                    item.title = mediaInfo.title;
-                    item.authorName = mediaInfo.authorName;
-                    item.parentTitle = mediaInfo.authorName;
-                    item.duration = mediaInfo.duration;
-                    item.mediaType = mediaInfo.type;
-
-                    // Download cover if we don't have a local one
-                    if (item.localCoverPath.empty()) {
-                        std::string coverUrl = client.getCoverUrl(itemId);
-                        if (!coverUrl.empty()) {
-                            item.coverUrl = coverUrl;
-                            item.localCoverPath = downloadCoverImage(itemId, coverUrl);
-                        }
-                    }
-
-                    // Store chapters
-                    for (const auto& ch : mediaInfo.chapters) {
-                        DownloadChapter dch;
-                        dch.title = ch.title;
-                        dch.start = ch.start;
-                        dch.end = ch.end;
-                        item.chapters.push_back(dch);
-                    }
-                    item.numChapters = static_cast<int>(item.chapters.size());
-
-                    // Save metadata locally for future offline use
-                    saveLocalMetadata(itemId, item);
-                } else {
-                    brls::Logger::warning("DownloadsManager: Could not fetch metadata for {} from server", itemId);
-                    item.title = itemId;  // Use item ID as fallback title
-                }
-            } else {
-                brls::Logger::info("DownloadsManager: Not connected to server, using itemId as title");
-                item.title = itemId;  // Use item ID as fallback title
-            }
+            // Fetched from the server in batches once the scan is done
+            item.title = itemId;  // Use item ID as fallback title
+            needsServerMetadata.push_back(newItems.size());
         }
 
         newItems.push_back(item);
@@ -2125,47 +1973,9 @@ int DownloadsManager::scanDownloadsFolder() {
         if (hasLocalMetadata) {
             brls::Logger::info("DownloadsManager: Using local metadata for {}", itemId);
         } else {
-            // Try to fetch metadata from server if connected
-            AudiobookshelfClient& client = AudiobookshelfClient::getInstance();
-            if (client.isAuthenticated()) {
-                MediaItem mediaInfo;
-                if (client.fetchItem(itemId, mediaInfo)) {
-                    brls::Logger::info("DownloadsManager: Fetched metadata for {} from server", itemId);
-                    item.title = mediaInfo.title;
-                    item.authorName = mediaInfo.authorName;
-                    item.parentTitle = mediaInfo.authorName;
-                    item.duration = mediaInfo.duration;
-                    item.mediaType = mediaInfo.type;
-
-                    // Download cover if we don't have a local one
-                    if (item.localCoverPath.empty()) {
-                        std::string coverUrl = client.getCoverUrl(itemId);
-                        if (!coverUrl.empty()) {
-                            item.coverUrl = coverUrl;
-                            item.localCoverPath = downloadCoverImage(itemId, coverUrl);
-                        }
-                    }
-
-                    // Store chapters
-                    for (const auto& ch : mediaInfo.chapters) {
-                        DownloadChapter dch;
-                        dch.title = ch.title;
-                        dch.start = ch.start;
-                        dch.end = ch.end;
-                        item.chapters.push_back(dch);
-                    }
-                    item.numChapters = static_cast<int>(item.chapters.size());
-
-                    // Save metadata locally for future offline use
-                    saveLocalMetadata(itemId, item);
-                } else {
-                    brls::Logger::warning("DownloadsManager: Could not fetch metadata for {} from server", itemId);
-                    item.title = itemId;  // Use item ID as fallback title
-                }
-            } else {
-                brls::Logger::info("DownloadsManager: Not connected to server, using itemId as title");
-                item.title = itemId;  // Use item ID as fallback title
-            }
+            // Fetched from the server in batches once the scan is done
+            item.title = itemId;  // Use item ID as fallback title
+            needsServerMetadata.push_back(newItems.size());
         }
 
         newItems.push_back(item);
@@ -2175,12 +1985,58 @@ int DownloadsManager::scanDownloadsFolder() {
     closedir(dir);
 #endif
 
+    // Fill in server metadata for files without a local copy, many items per request
+    if (!needsServerMetadata.empty()) {
+        AudiobookshelfClient& client = AudiobookshelfClient::getInstance();
+        if (client.isAuthenticated()) {
+            std::vector<std::string> itemIds;
+            itemIds.reserve(needsServerMetadata.size());
+            for (size_t index : needsServerMetadata) {
+                itemIds.push_back(newItems[index].itemId);
+            }
+
+            std::vector<MediaItem> fetched;
+            client.fetchItemsBatch(itemIds, fetched);
+            std::unordered_map<std::string, const MediaItem*> fetchedById;
+            for (const auto& mediaInfo : fetched) {
+                fetchedById[mediaInfo.id] = &mediaInfo;
+            }
+
+            for (size_t index : needsServerMetadata) {
+                DownloadItem& item = newItems[index];
+                auto it = fetchedById.find(item.itemId);
+                if (it == fetchedById.end()) {
+                    brls::Logger::warning("DownloadsManager: Could not fetch metadata for {} from server", item.itemId);
+                    continue;
+                }
+
+                brls::Logger::info("DownloadsManager: Fetched metadata for {} from server", item.itemId);
+                applyServerMetadata(item, *it->second);
+
+                // Download cover if we don't have a local one
+                if (item.localCoverPath.empty()) {
+                    std::string coverUrl = client.getCoverUrl(item.itemId);
+                    if (!coverUrl.empty()) {
+                        item.coverUrl = coverUrl;
+                        item.localCoverPath = downloadCoverImage(item.itemId, coverUrl);
+                    }
+                }
+
+                // Save metadata locally for future offline use
+                saveLocalMetadata(item.itemId, item);
+            }
+        } else {
+            brls::Logger::info("DownloadsManager: Not connected to server, using itemId as title");
+        }
+    }
+
     // Now add all new items to the downloads list
     if (!newItems.empty()) {
         {
             std::lock_guard<std::mutex> lock(m_mutex);
             for (const auto& item : newItems) {
-                m_downloads.push_back(item);
+                m_downloads.insert(item);
+                m_layoutDirty = true;
                 newFilesFound++;
                 brls::Logger::info("DownloadsManager: Added to library: {} ({})", item.title, item.itemId);
             }
@@ -2197,6 +2053,25 @@ int DownloadsManager::scanDownloadsFolder() {
     return newFilesFound;
 }
 
+void DownloadsManager::applyServerMetadata(DownloadItem& item, const MediaItem& mediaInfo) {
+    item.title = mediaInfo.title;
+    item.authorName = mediaInfo.authorName;
+    item.parentTitle = mediaInfo.authorName;
+    item.duration = mediaInfo.duration;
+    item.mediaType = mediaInfo.type;
+
+    // Store chapters
+    item.chapters.clear();
+    for (const auto& ch : mediaInfo.chapters) {
+        DownloadChapter dch;
+        dch.title = ch.title;
+        dch.start = ch.start;
+        dch.end = ch.end;
+        item.chapters.push_back(dch);
+    }
+    item.numChapters = static_cast<int>(item.chapters.size());
+}
+
 int DownloadsManager::updateMissingMetadata() {
     brls::Logger::info("DownloadsManager: Checking for items with missing metadata...");
 
@@ -2226,47 +2101,46 @@ int DownloadsManager::updateMissingMetadata() {
         return 0;
     }
 
-    // Update each item
-    for (const auto& itemId : itemsToUpdate) {
-        MediaItem mediaInfo;
-        if (client.fetchItem(itemId, mediaInfo)) {
-            std::lock_guard<std::mutex> lock(m_mutex);
+    std::vector<MediaItem> fetched;
+    if (!client.fetchItemsBatch(itemsToUpdate, fetched)) {
+        brls::Logger::warning("DownloadsManager: Could not fetch metadata for {} items", itemsToUpdate.size());
+        return 0;
+    }
+
+    // Covers are downloaded outside the lock, after the metadata is in
+    std::vector<std::string> needsCover;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (const auto& mediaInfo : fetched) {
             for (auto& item : m_downloads) {
-                if (item.itemId == itemId) {
+                if (item.itemId == mediaInfo.id) {
                     brls::Logger::info("DownloadsManager: Updating metadata for {} -> {}",
-                                       itemId, mediaInfo.title);
-                    item.title = mediaInfo.title;
-                    item.authorName = mediaInfo.authorName;
-                    item.parentTitle = mediaInfo.authorName;
-                    item.duration = mediaInfo.duration;
-                    item.mediaType = mediaInfo.type;
-
-                    // Download cover if needed
+                                       mediaInfo.id, mediaInfo.title);
+                    applyServerMetadata(item, mediaInfo);
+                    markDirtyUnlocked(item);
                     if (item.localCoverPath.empty()) {
-                        std::string coverUrl = client.getCoverUrl(itemId);
-                        if (!coverUrl.empty()) {
-                            item.coverUrl = coverUrl;
-                            item.localCoverPath = downloadCoverImage(itemId, coverUrl);
-                        }
-                    }
-
-                    // Store chapters
-                    item.chapters.clear();
-                    for (const auto& ch : mediaInfo.chapters) {
-                        DownloadChapter dch;
-                        dch.title = ch.title;
-                        dch.start = ch.start;
-                        dch.end = ch.end;
-                        item.chapters.push_back(dch);
+                        needsCover.push_back(item.itemId);
                     }
-                    item.numChapters = static_cast<int>(item.chapters.size());
-
                     updatedCount++;
                     break;
                 }
             }
-        } else {
-            brls::Logger::warning("DownloadsManager: Could not fetch metadata for {}", itemId);
+        }
+    }
+
+    for (const auto& itemId : needsCover) {
+        std::string coverUrl = client.getCoverUrl(itemId);
+        if (coverUrl.empty()) continue;
+
+        std::string localCoverPath = downloadCoverImage(itemId, coverUrl);
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (auto& item : m_downloads) {
+            if (item.itemId == itemId) {
+                item.coverUrl = coverUrl;
+                item.localCoverPath = localCoverPath;
+                markDirtyUnlocked(item);
+                break;
+            }
         }
     }
 
@@ -2287,6 +2161,8 @@ void DownloadsManager::resumeIncompleteDownloads() {
             item.state == DownloadState::PAUSED ||
             item.state == DownloadState::FAILED) {
             item.state = DownloadState::QUEUED;
+            enqueueUnlocked(item);
+            markDirtyUnlocked(item);
             resumed++;
         }
     }
@@ -2449,29 +2325,28 @@ bool DownloadsManager::registerCompletedDownload(const std::string& itemId, cons
     std::lock_guard<std::mutex> lock(m_mutex);
 
     // Check if already registered
-    for (auto& item : m_downloads) {
-        if (item.itemId == itemId && item.episodeId == episodeId) {
-            // Update existing entry
-            item.localPath = localPath;
-            item.totalBytes = fileSize;
-            item.downloadedBytes = fileSize;
-            item.state = DownloadState::COMPLETED;
-            // Update metadata if provided
-            if (!localCoverPath.empty()) {
-                item.localCoverPath = localCoverPath;
-                item.coverUrl = coverUrl;
-            }
-            if (!description.empty()) {
-                item.description = description;
-            }
-            if (!chapters.empty()) {
-                item.chapters = chapters;
-                item.numChapters = static_cast<int>(chapters.size());
-            }
-            brls::Logger::info("DownloadsManager: Updated existing download: {}", title);
-            saveStateUnlocked();  // Already holding the lock
-            return true;
-        }
+    if (DownloadItem* existing = m_downloads.get(m_downloads.find(itemId, episodeId))) {
+        // Update existing entry
+        existing->localPath = localPath;
+        existing->totalBytes = fileSize;
+        existing->downloadedBytes = fileSize;
+        existing->state = DownloadState::COMPLETED;
+        // Update metadata if provided
+        if (!localCoverPath.empty()) {
+            existing->localCoverPath = localCoverPath;
+            existing->coverUrl = coverUrl;
+        }
+        if (!description.empty()) {
+            existing->description = description;
+        }
+        if (!chapters.empty()) {
+            existing->chapters = chapters;
+            existing->numChapters = static_cast<int>(chapters.size());
+        }
+        markDirtyUnlocked(*existing);
+        brls::Logger::info("DownloadsManager: Updated existing download: {}", title);
+        saveStateUnlocked();  // Already holding the lock
+        return true;
     }
 
     // Create new download entry
@@ -2500,7 +2375,8 @@ bool DownloadsManager::registerCompletedDownload(const std::string& itemId, cons
         item.parentTitle = authorName;
     }
 
-    m_downloads.push_back(item);
+    m_downloads.insert(item);
+    m_layoutDirty = true;
     brls::Logger::info("DownloadsManager: Registered completed download: {} ({} bytes, cover: {})",
                        title, fileSize, !localCoverPath.empty() ? "yes" : "no");
 
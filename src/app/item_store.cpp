@@ -0,0 +1,194 @@
+/**
+ * VitaABS - Item Store implementation
+ */
+
+#include "app/item_store.hpp"
+#include <borealis.hpp>
+#include <algorithm>
+
+namespace vitaabs {
+
+static bool sameItem(const MediaItemSummary& a, const MediaItemSummary& b) {
+    return a.id == b.id &&
+           a.libraryId == b.libraryId &&
+           a.episodeId == b.episodeId &&
+           a.podcastId == b.podcastId &&
+           a.title == b.title &&
+           a.authorName == b.authorName &&
+           a.coverPath == b.coverPath &&
+           a.type == b.type &&
+           a.blurb == b.blurb &&
+           a.mediaType == b.mediaType &&
+           a.duration == b.duration &&
+           a.currentTime == b.currentTime &&
+           a.progress == b.progress &&
+           a.episodeNumber == b.episodeNumber &&
+           a.isFinished == b.isFinished &&
+           a.isDownloaded == b.isDownloaded;
+}
+
+ItemStore& ItemStore::getInstance() {
+    static ItemStore instance;
+    return instance;
+}
+
+std::string ItemStore::makeKey(const std::string& itemId, const std::string& episodeId) {
+    return episodeId.empty() ? itemId : itemId + "/" + episodeId;
+}
+
+std::string ItemStore::makeKey(const MediaItemSummary& item) {
+    return makeKey(item.id, item.episodeId);
+}
+
+ItemRef ItemStore::store(const MediaItemSummary& item, bool replace) {
+    // Collections, genres and other grid entries aren't entities - not shared
+    if (item.id.empty() || item.mediaType == MediaType::UNKNOWN) {
+        return std::make_shared<const MediaItemSummary>(item);
+    }
+
+    std::string key = makeKey(item);
+    ItemRef result;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = m_items.find(key);
+        if (it != m_items.end() && (!replace || sameItem(*it->second, item))) {
+            return it->second;
+        }
+
+        result = std::make_shared<const MediaItemSummary>(item);
+        bool changed = it != m_items.end();
+        m_items[key] = result;
+
+        if (!changed) {
+            if (m_items.size() > m_pruneThreshold) {
+                pruneUnlocked();
+            }
+            return result;
+        }
+    }
+
+    notify(key, result);
+    return result;
+}
+
+ItemRef ItemStore::put(const MediaItemSummary& item) {
+    return store(item, true);
+}
+
+std::vector<ItemRef> ItemStore::putAll(const std::vector<MediaItemSummary>& items) {
+    std::vector<ItemRef> refs;
+    refs.reserve(items.size());
+    for (const auto& item : items) {
+        refs.push_back(store(item, true));
+    }
+    return refs;
+}
+
+ItemRef ItemStore::intern(const MediaItemSummary& item) {
+    return store(item, false);
+}
+
+std::vector<ItemRef> ItemStore::internAll(const std::vector<MediaItemSummary>& items) {
+    std::vector<ItemRef> refs;
+    refs.reserve(items.size());
+    for (const auto& item : items) {
+        refs.push_back(store(item, false));
+    }
+    return refs;
+}
+
+ItemRef ItemStore::get(const std::string& key) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_items.find(key);
+    return it != m_items.end() ? it->second : nullptr;
+}
+
+void ItemStore::updateProgress(const std::string& itemId, const std::string& episodeId,
+                               float currentTime, float duration, bool isFinished) {
+    std::string key = makeKey(itemId, episodeId);
+    ItemRef updated;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = m_items.find(key);
+        if (it == m_items.end()) return;  // Not shown anywhere
+
+        MediaItemSummary copy = *it->second;
+        copy.currentTime = currentTime;
+        if (duration > 0) {
+            copy.duration = duration;
+        }
+        copy.progress = copy.duration > 0 ? currentTime / copy.duration : 0.0f;
+        copy.isFinished = isFinished;
+        if (sameItem(copy, *it->second)) return;
+
+        updated = std::make_shared<const MediaItemSummary>(std::move(copy));
+        it->second = updated;
+    }
+
+    brls::Logger::debug("ItemStore: Progress {}s for {}", currentTime, key);
+    notify(key, updated);
+}
+
+void ItemStore::notify(const std::string& key, const ItemRef& item) {
+    // Copy the listeners so they may (un)subscribe while being called
+    std::vector<ItemChangeListener> listeners;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto range = m_subscriptionsByKey.equal_range(key);
+        for (auto it = range.first; it != range.second; ++it) {
+            auto sub = m_subscriptions.find(it->second);
+            if (sub != m_subscriptions.end()) {
+                listeners.push_back(sub->second.listener);
+            }
+        }
+    }
+
+    for (const auto& listener : listeners) {
+        listener(item);
+    }
+}
+
+int ItemStore::subscribe(const std::string& key, ItemChangeListener listener) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    int id = m_nextSubscriptionId++;
+    m_subscriptions[id] = Subscription{key, std::move(listener)};
+    m_subscriptionsByKey.emplace(key, id);
+    return id;
+}
+
+void ItemStore::unsubscribe(int id) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto sub = m_subscriptions.find(id);
+    if (sub == m_subscriptions.end()) return;
+
+    auto range = m_subscriptionsByKey.equal_range(sub->second.key);
+    for (auto it = range.first; it != range.second; ++it) {
+        if (it->second == id) {
+            m_subscriptionsByKey.erase(it);
+            break;
+        }
+    }
+    m_subscriptions.erase(sub);
+}
+
+// Drop entities no view holds a handle to any more
+void ItemStore::pruneUnlocked() {
+    size_t before = m_items.size();
+    for (auto it = m_items.begin(); it != m_items.end();) {
+        if (it->second.use_count() == 1 && m_subscriptionsByKey.count(it->first) == 0) {
+            it = m_items.erase(it);
+        } else {
+            ++it;
+        }
+    }
+    m_pruneThreshold = std::max<size_t>(256, m_items.size() * 2);
+    brls::Logger::debug("ItemStore: Pruned {} of {} entities", before - m_items.size(), before);
+}
+
+void ItemStore::clear() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_items.clear();
+    m_pruneThreshold = 256;
+}
+
+} // namespace vitaabs
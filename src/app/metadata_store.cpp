@@ -0,0 +1,445 @@
+/**
+ * VitaABS - Metadata Store implementation
+ */
+
+#include "app/metadata_store.hpp"
+#include "platform/platform.hpp"
+#include <borealis.hpp>
+#include <algorithm>
+#include <unordered_map>
+#include <cstring>
+
+namespace vitaabs {
+
+static const char STORE_MAGIC[4] = {'V', 'M', 'D', 'S'};
+static const uint32_t STORE_VERSION = 1;
+
+// Items fetched per page during sync
+static const int SYNC_PAGE_SIZE = 100;
+
+// Safety cap on pages per sync (100k items)
+static const int SYNC_MAX_PAGES = 1000;
+
+// String fields of a record, in on-disk order. Append only - bump
+// STORE_VERSION when changing this list.
+enum StoreString {
+    STR_ID,
+    STR_LIBRARY_ID,
+    STR_TITLE,
+    STR_SUBTITLE,
+    STR_DESCRIPTION,
+    STR_COVER_PATH,
+    STR_TYPE,
+    STR_AUTHOR,
+    STR_NARRATOR,
+    STR_PUBLISHED_YEAR,
+    STR_PUBLISHER,
+    STR_ISBN,
+    STR_ASIN,
+    STR_LANGUAGE,
+    STR_GENRES,         // Joined with '\n'
+    STR_TAGS,           // Joined with '\n'
+    STR_SERIES,
+    STR_SERIES_SEQUENCE,
+    STR_COUNT
+};
+
+struct StoreHeader {
+    char magic[4];
+    uint32_t version;
+    uint32_t recordCount;
+    uint32_t recordSize;
+    uint32_t stringTableOffset;
+    uint32_t stringTableSize;
+    int64_t lastSync;
+};
+
+struct StringRef {
+    uint32_t offset;
+    uint32_t length;
+};
+
+struct StoreRecord {
+    StringRef strings[STR_COUNT];
+    int64_t updatedAt;
+    int64_t size;
+    float duration;
+    float currentTime;
+    float progress;
+    int32_t numChapters;
+    uint8_t mediaType;
+    uint8_t flags;          // bit 0: isFinished
+    uint16_t reserved;
+};
+
+namespace {
+
+std::string joinList(const std::vector<InternedString>& list) {
+    std::string out;
+    for (size_t i = 0; i < list.size(); i++) {
+        if (i > 0) out += '\n';
+        out += list[i];
+    }
+    return out;
+}
+
+std::vector<InternedString> splitList(const std::string& joined) {
+    std::vector<InternedString> out;
+    size_t start = 0;
+    while (start < joined.size()) {
+        size_t end = joined.find('\n', start);
+        if (end == std::string::npos) end = joined.size();
+        if (end > start) out.push_back(joined.substr(start, end - start));
+        start = end + 1;
+    }
+    return out;
+}
+
+// Validated view over a loaded store file
+class StoreView {
+public:
+    bool open(const std::vector<uint8_t>& data) {
+        m_data = &data;
+        if (data.size() < sizeof(StoreHeader)) return false;
+        std::memcpy(&m_header, data.data(), sizeof(StoreHeader));
+
+        if (std::memcmp(m_header.magic, STORE_MAGIC, sizeof(STORE_MAGIC)) != 0) return false;
+        if (m_header.version != STORE_VERSION || m_header.recordSize != sizeof(StoreRecord)) return false;
+
+        uint64_t recordsEnd = sizeof(StoreHeader) + (uint64_t)m_header.recordCount * sizeof(StoreRecord);
+        uint64_t stringsEnd = (uint64_t)m_header.stringTableOffset + m_header.stringTableSize;
+        return recordsEnd <= m_header.stringTableOffset && stringsEnd <= data.size();
+    }
+
+    const StoreHeader& header() const { return m_header; }
+
+    StoreRecord record(uint32_t index) const {
+        StoreRecord rec;
+        std::memcpy(&rec, m_data->data() + sizeof(StoreHeader) + (size_t)index * sizeof(StoreRecord),
+                    sizeof(StoreRecord));
+        return rec;
+    }
+
+    std::string str(const StringRef& ref) const {
+        if ((uint64_t)ref.offset + ref.length > m_header.stringTableSize) return "";
+        const char* base = reinterpret_cast<const char*>(m_data->data()) + m_header.stringTableOffset;
+        return std::string(base + ref.offset, ref.length);
+    }
+
+    MediaItem item(uint32_t index) const {
+        StoreRecord rec = record(index);
+        MediaItem item;
+        item.id = str(rec.strings[STR_ID]);
+        item.libraryId = str(rec.strings[STR_LIBRARY_ID]);
+        item.title = str(rec.strings[STR_TITLE]);
+        item.subtitle = str(rec.strings[STR_SUBTITLE]);
+        item.description = str(rec.strings[STR_DESCRIPTION]);
+        item.coverPath = str(rec.strings[STR_COVER_PATH]);
+        item.type = str(rec.strings[STR_TYPE]);
+        item.authorName = str(rec.strings[STR_AUTHOR]);
+        item.narratorName = str(rec.strings[STR_NARRATOR]);
+        item.publishedYear = str(rec.strings[STR_PUBLISHED_YEAR]);
+        item.publisher = str(rec.strings[STR_PUBLISHER]);
+        item.isbn = str(rec.strings[STR_ISBN]);
+        item.asin = str(rec.strings[STR_ASIN]);
+        item.language = str(rec.strings[STR_LANGUAGE]);
+        item.genres = splitList(str(rec.strings[STR_GENRES]));
+        item.tags = splitList(str(rec.strings[STR_TAGS]));
+        item.seriesName = str(rec.strings[STR_SERIES]);
+        item.seriesSequence = str(rec.strings[STR_SERIES_SEQUENCE]);
+        item.updatedAt = rec.updatedAt;
+        item.size = rec.size;
+        item.duration = rec.duration;
+        item.currentTime = rec.currentTime;
+        item.progress = rec.progress;
+        item.numChapters = rec.numChapters;
+        item.mediaType = rec.mediaType <= static_cast<uint8_t>(MediaType::PODCAST_EPISODE)
+            ? static_cast<MediaType>(rec.mediaType) : MediaType::UNKNOWN;
+        item.isFinished = (rec.flags & 0x01) != 0;
+        return item;
+    }
+
+private:
+    const std::vector<uint8_t>* m_data = nullptr;
+    StoreHeader m_header;
+};
+
+// Builds the de-duplicated string table while records are written
+class StringTableBuilder {
+public:
+    StringRef add(const std::string& s) {
+        auto it = m_offsets.find(s);
+        if (it != m_offsets.end()) {
+            return {it->second, (uint32_t)s.size()};
+        }
+        uint32_t offset = (uint32_t)m_table.size();
+        m_table += s;
+        m_offsets.emplace(s, offset);
+        return {offset, (uint32_t)s.size()};
+    }
+
+    const std::string& data() const { return m_table; }
+
+private:
+    std::string m_table;
+    std::unordered_map<std::string, uint32_t> m_offsets;
+};
+
+} // namespace
+
+MetadataStore& MetadataStore::getInstance() {
+    static MetadataStore instance;
+    return instance;
+}
+
+std::string MetadataStore::getStoreDir() const {
+    return platform::path("metadata");
+}
+
+std::string MetadataStore::getStorePath(const std::string& libraryId) const {
+    return getStoreDir() + "/" + libraryId + ".db";
+}
+
+std::shared_ptr<const MetadataStore::LoadedStore> MetadataStore::getLoaded(const std::string& libraryId) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_loaded.find(libraryId);
+    if (it != m_loaded.end()) return it->second;
+
+    auto loaded = std::make_shared<LoadedStore>();
+    loaded->data = platform::readFile(getStorePath(libraryId));
+
+    StoreView view;
+    if (loaded->data.empty() || !view.open(loaded->data)) {
+        if (!loaded->data.empty()) {
+            brls::Logger::warning("MetadataStore: Ignoring invalid store for library {}", libraryId);
+        }
+        // Remember the miss too; writeStore replaces it
+        m_loaded[libraryId] = nullptr;
+        return nullptr;
+    }
+
+    loaded->recordById.reserve(view.header().recordCount);
+    for (uint32_t i = 0; i < view.header().recordCount; i++) {
+        loaded->recordById.emplace(view.str(view.record(i).strings[STR_ID]), i);
+    }
+    m_loaded[libraryId] = loaded;
+    return loaded;
+}
+
+bool MetadataStore::readStore(const std::string& libraryId, std::vector<MediaItem>& items, int64_t& lastSync) {
+    std::shared_ptr<const LoadedStore> loaded = getLoaded(libraryId);
+    if (!loaded) return false;
+
+    StoreView view;
+    view.open(loaded->data);
+
+    items.clear();
+    items.reserve(view.header().recordCount);
+    for (uint32_t i = 0; i < view.header().recordCount; i++) {
+        items.push_back(view.item(i));
+    }
+    lastSync = view.header().lastSync;
+    return true;
+}
+
+bool MetadataStore::writeStore(const std::string& libraryId, std::vector<MediaItem>& items, int64_t lastSync) {
+    std::sort(items.begin(), items.end(), [](const MediaItem& a, const MediaItem& b) {
+        return a.id < b.id;
+    });
+
+    StringTableBuilder strings;
+    std::vector<StoreRecord> records;
+    records.reserve(items.size());
+
+    for (const auto& item : items) {
+        StoreRecord rec;
+        std::memset(&rec, 0, sizeof(rec));
+        rec.strings[STR_ID] = strings.add(item.id);
+        rec.strings[STR_LIBRARY_ID] = strings.add(item.libraryId);
+        rec.strings[STR_TITLE] = strings.add(item.title);
+        rec.strings[STR_SUBTITLE] = strings.add(item.subtitle);
+        rec.strings[STR_DESCRIPTION] = strings.add(item.description);
+        rec.strings[STR_COVER_PATH] = strings.add(item.coverPath);
+        rec.strings[STR_TYPE] = strings.add(item.type);
+        rec.strings[STR_AUTHOR] = strings.add(item.authorName);
+        rec.strings[STR_NARRATOR] = strings.add(item.narratorName);
+        rec.strings[STR_PUBLISHED_YEAR] = strings.add(item.publishedYear);
+        rec.strings[STR_PUBLISHER] = strings.add(item.publisher);
+        rec.strings[STR_ISBN] = strings.add(item.isbn);
+        rec.strings[STR_ASIN] = strings.add(item.asin);
+        rec.strings[STR_LANGUAGE] = strings.add(item.language);
+        rec.strings[STR_GENRES] = strings.add(joinList(item.genres));
+        rec.strings[STR_TAGS] = strings.add(joinList(item.tags));
+        rec.strings[STR_SERIES] = strings.add(item.seriesName);
+        rec.strings[STR_SERIES_SEQUENCE] = strings.add(item.seriesSequence);
+        rec.updatedAt = item.updatedAt;
+        rec.size = item.size;
+        rec.duration = item.duration;
+        rec.currentTime = item.currentTime;
+        rec.progress = item.progress;
+        rec.numChapters = item.numChapters;
+        rec.mediaType = static_cast<uint8_t>(item.mediaType);
+        rec.flags = item.isFinished ? 0x01 : 0x00;
+        records.push_back(rec);
+    }
+
+    StoreHeader header;
+    std::memcpy(header.magic, STORE_MAGIC, sizeof(STORE_MAGIC));
+    header.version = STORE_VERSION;
+    header.recordCount = (uint32_t)records.size();
+    header.recordSize = sizeof(StoreRecord);
+    header.stringTableOffset = (uint32_t)(sizeof(StoreHeader) + records.size() * sizeof(StoreRecord));
+    header.stringTableSize = (uint32_t)strings.data().size();
+    header.lastSync = lastSync;
+
+    std::string out;
+    out.reserve(header.stringTableOffset + header.stringTableSize);
+    out.append(reinterpret_cast<const char*>(&header), sizeof(header));
+    if (!records.empty()) {
+        out.append(reinterpret_cast<const char*>(records.data()), records.size() * sizeof(StoreRecord));
+    }
+    out += strings.data();
+
+    auto loaded = std::make_shared<LoadedStore>();
+    loaded->data.assign(out.begin(), out.end());
+    loaded->recordById.reserve(items.size());
+    for (size_t i = 0; i < items.size(); i++) {
+        loaded->recordById.emplace(items[i].id, (uint32_t)i);
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    platform::createDirRecursive(getStoreDir());
+    if (!platform::writeFile(getStorePath(libraryId), out)) {
+        brls::Logger::error("MetadataStore: Failed to write store for library {}", libraryId);
+        return false;
+    }
+    m_loaded[libraryId] = std::move(loaded);
+
+    brls::Logger::debug("MetadataStore: Wrote {} items for library {} ({} bytes, {} string bytes)",
+                       records.size(), libraryId, out.size(), strings.data().size());
+    return true;
+}
+
+bool MetadataStore::loadLibrary(const std::string& libraryId, std::vector<MediaItem>& items) {
+    int64_t lastSync = 0;
+    return readStore(libraryId, items, lastSync) && !items.empty();
+}
+
+bool MetadataStore::getItem(const std::string& libraryId, const std::string& itemId, MediaItem& item) {
+    std::shared_ptr<const LoadedStore> loaded = getLoaded(libraryId);
+    if (!loaded) return false;
+
+    auto it = loaded->recordById.find(itemId);
+    if (it == loaded->recordById.end()) return false;
+
+    StoreView view;
+    view.open(loaded->data);
+    item = view.item(it->second);
+    return true;
+}
+
+int64_t MetadataStore::getLastSync(const std::string& libraryId) {
+    std::shared_ptr<const LoadedStore> loaded = getLoaded(libraryId);
+    if (!loaded) return 0;
+
+    StoreView view;
+    view.open(loaded->data);
+    return view.header().lastSync;
+}
+
+bool MetadataStore::syncLibrary(const std::string& libraryId, int* changedCount) {
+    if (libraryId.empty()) return false;
+
+    AudiobookshelfClient& client = AudiobookshelfClient::getInstance();
+
+    std::vector<MediaItem> stored;
+    int64_t lastSync = 0;
+    bool haveStore = readStore(libraryId, stored, lastSync);
+
+    std::unordered_map<std::string, size_t> indexById;
+    for (size_t i = 0; i < stored.size(); i++) {
+        indexById[stored[i].id] = i;
+    }
+
+    int changed = 0;
+    int serverTotal = -1;
+    int64_t newest = lastSync;
+
+    // Page through items newest-updated first. In incremental mode, stop after
+    // the first page that reaches items we already have.
+    auto fetchPages = [&](bool incremental) -> bool {
+        for (int page = 0; page < SYNC_MAX_PAGES; page++) {
+            std::vector<MediaItem> pageItems;
+            int pageTotal = -1;
+            if (!client.fetchLibraryItems(libraryId, pageItems, page, SYNC_PAGE_SIZE,
+                                          "updatedAt", true, &pageTotal)) {
+                return false;
+            }
+            if (page == 0) serverTotal = pageTotal;
+
+            bool reachedKnown = false;
+            for (auto& item : pageItems) {
+                if (incremental && item.updatedAt > 0 && item.updatedAt <= lastSync) {
+                    reachedKnown = true;
+                    continue;
+                }
+                newest = std::max(newest, item.updatedAt);
+                if (item.libraryId.empty()) item.libraryId = libraryId;
+
+                auto it = indexById.find(item.id);
+                if (it != indexById.end()) {
+                    stored[it->second] = std::move(item);
+                } else {
+                    indexById[item.id] = stored.size();
+                    stored.push_back(std::move(item));
+                }
+                changed++;
+            }
+
+            if (reachedKnown || (int)pageItems.size() < SYNC_PAGE_SIZE) {
+                return true;
+            }
+        }
+        return true;
+    };
+
+    if (!fetchPages(haveStore)) {
+        brls::Logger::error("MetadataStore: Sync failed for library {}", libraryId);
+        return false;
+    }
+
+    // Deleted (or missed) items show up as a count mismatch - do a full refresh
+    if (haveStore && serverTotal >= 0 && serverTotal != (int)stored.size()) {
+        brls::Logger::info("MetadataStore: Library {} has {} items on server, {} stored - full resync",
+                          libraryId, serverTotal, stored.size());
+        stored.clear();
+        indexById.clear();
+        changed = 0;
+        if (!fetchPages(false)) {
+            brls::Logger::error("MetadataStore: Full resync failed for library {}", libraryId);
+            return false;
+        }
+    }
+
+    if (changedCount) *changedCount = changed;
+
+    if (changed == 0 && haveStore) {
+        brls::Logger::debug("MetadataStore: Library {} is up to date ({} items)", libraryId, stored.size());
+        return true;
+    }
+
+    brls::Logger::info("MetadataStore: Synced library {} - {} changed, {} total", libraryId, changed, stored.size());
+    return writeStore(libraryId, stored, newest);
+}
+
+void MetadataStore::clear() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_loaded.clear();
+    std::string dir = getStoreDir();
+    for (const auto& name : platform::listDir(dir)) {
+        platform::deleteFile(dir + "/" + name);
+    }
+    brls::Logger::info("MetadataStore: Cleared stored metadata");
+}
+
+} // namespace vitaabs
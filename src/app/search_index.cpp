@@ -0,0 +1,330 @@
+/**
+ * VitaABS - Search Index implementation
+ */
+
+#include "app/search_index.hpp"
+#include "app/downloads_manager.hpp"
+#include <borealis.hpp>
+#include <algorithm>
+#include <iterator>
+#include <chrono>
+#include <cctype>
+
+namespace vitaabs {
+
+SearchIndex& SearchIndex::getInstance() {
+    static SearchIndex instance;
+    return instance;
+}
+
+SearchIndex::SearchIndex() : m_snapshot(std::make_shared<Snapshot>()) {}
+
+std::string SearchIndex::itemKey(const MediaItem& item) {
+    return item.episodeId.empty() ? item.id : item.id + "/" + item.episodeId;
+}
+
+std::string SearchIndex::itemKey(const MediaItemSummary& item) {
+    return item.episodeId.empty() ? item.id : item.id + "/" + item.episodeId;
+}
+
+// Lowercase ASCII and split on anything that isn't a letter/digit.
+// UTF-8 multi-byte sequences are kept as part of the token.
+void SearchIndex::tokenize(const std::string& text, std::vector<std::string>& tokens) {
+    std::string current;
+    for (unsigned char c : text) {
+        if (c >= 0x80 || std::isalnum(c)) {
+            current += (char)std::tolower(c);
+        } else if (!current.empty()) {
+            tokens.push_back(current);
+            current.clear();
+        }
+    }
+    if (!current.empty()) {
+        tokens.push_back(current);
+    }
+}
+
+void SearchIndex::addDocument(MediaItemSummary item, std::string searchText, bool fromDownloads) {
+    if (item.id.empty()) return;
+
+    std::string key = itemKey(item);
+    auto it = m_docByKey.find(key);
+    if (it != m_docByKey.end()) {
+        Document& existing = m_docs[it->second];
+        // Server metadata wins over download metadata, but keep the downloaded flag
+        if (fromDownloads && !existing.fromDownloads) {
+            if (!existing.item->isDownloaded) {
+                auto flagged = std::make_shared<MediaItemSummary>(*existing.item);
+                flagged->isDownloaded = true;
+                existing.item = std::move(flagged);
+                m_generation++;
+            }
+            return;
+        }
+        if (!fromDownloads && existing.fromDownloads) {
+            item.isDownloaded = true;
+        }
+
+        if (existing.searchText == searchText) {
+            // Same tokens: the postings stay, only what the cell shows changes
+            existing.item = std::make_shared<const MediaItemSummary>(std::move(item));
+            existing.fromDownloads = fromDownloads;
+            m_generation++;
+            return;
+        }
+        // The old postings go stale; the replacement is tokenized as a new document
+        removeDocument(existing);
+    }
+
+    Document doc;
+    doc.item = std::make_shared<const MediaItemSummary>(std::move(item));
+    doc.searchText = std::move(searchText);
+    doc.fromDownloads = fromDownloads;
+    m_docByKey[key] = m_docs.size();
+    m_docs.push_back(std::move(doc));
+    m_generation++;
+}
+
+void SearchIndex::removeDocument(Document& doc) {
+    m_docByKey.erase(itemKey(*doc.item));
+    doc.removed = true;
+    m_removedDocs++;
+    m_generation++;
+}
+
+void SearchIndex::indexItems(const std::vector<MediaItem>& items) {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (const auto& item : items) {
+            // Collections and other non-media entries are not searchable
+            if (item.mediaType == MediaType::UNKNOWN) continue;
+            addDocument(MediaItemSummary::fromItem(item),
+                        item.title + " " + item.authorName + " " + item.narratorName + " " + item.seriesName,
+                        false);
+        }
+    }
+    rebuild();
+}
+
+void SearchIndex::indexItems(const std::vector<MediaItemSummary>& items) {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (const auto& item : items) {
+            if (item.mediaType == MediaType::UNKNOWN) continue;
+
+            // Don't let a summary replace a document indexed with narrator/series text
+            if (m_docByKey.count(itemKey(item))) continue;
+
+            addDocument(item, item.title + " " + item.authorName, false);
+        }
+    }
+    rebuild();
+}
+
+void SearchIndex::syncDownloads() {
+    std::vector<DownloadsManager::DownloadStateInfo> downloads =
+        DownloadsManager::getInstance().getDownloadStates();
+
+    std::unordered_map<std::string, MediaItemSummary> completed;
+    for (const auto& dl : downloads) {
+        if (dl.state != DownloadState::COMPLETED) continue;
+
+        MediaItemSummary item;
+        item.id = dl.itemId;
+        item.episodeId = dl.episodeId;
+        item.title = dl.title;
+        item.authorName = dl.authorName;
+        item.coverPath = dl.localCoverPath;
+        item.isDownloaded = true;
+        if (!dl.episodeId.empty()) {
+            item.mediaType = MediaType::PODCAST_EPISODE;
+            item.podcastId = dl.itemId;
+        } else {
+            item.mediaType = MediaType::BOOK;
+        }
+        completed[itemKey(item)] = std::move(item);
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        // Tombstone deleted downloads and refresh the downloaded flag on server items
+        for (auto& doc : m_docs) {
+            if (doc.removed) continue;
+            bool isDownloaded = completed.count(itemKey(*doc.item)) > 0;
+            if (doc.fromDownloads && !isDownloaded) {
+                removeDocument(doc);
+            } else if (doc.item->isDownloaded != isDownloaded) {
+                // Result cells show the flag - the snapshot needs the change too
+                auto flagged = std::make_shared<MediaItemSummary>(*doc.item);
+                flagged->isDownloaded = isDownloaded;
+                doc.item = std::move(flagged);
+                m_generation++;
+            }
+        }
+
+        // Add downloads the index doesn't know about yet (unchanged ones cost nothing)
+        for (auto& entry : completed) {
+            auto it = m_docByKey.find(entry.first);
+            if (it != m_docByKey.end()) {
+                const Document& doc = m_docs[it->second];
+                if (!doc.fromDownloads ||
+                    (doc.item->title == entry.second.title && doc.item->authorName == entry.second.authorName)) {
+                    continue;
+                }
+            }
+            addDocument(entry.second, entry.second.title + " " + entry.second.authorName, true);
+        }
+    }
+    rebuild();
+}
+
+void SearchIndex::rebuild() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_rebuilding) return;
+        m_rebuilding = true;
+    }
+
+    // Loop until the documents stop changing, so a burst of indexItems calls
+    // from several workers costs one pass per batch that actually arrived
+    while (true) {
+        auto start = std::chrono::steady_clock::now();
+
+        auto snapshot = std::make_shared<Snapshot>();
+        std::vector<std::string> texts;
+        uint32_t firstDoc = 0;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            std::shared_ptr<const Snapshot> published = std::atomic_load(&m_snapshot);
+            if (published->generation == m_generation) {
+                m_rebuilding = false;
+                return;
+            }
+            snapshot->generation = m_generation;
+
+            // Once tombstones dominate, compact and re-tokenize everything
+            if (m_removedDocs > 64 && m_removedDocs * 2 > m_docs.size()) {
+                std::vector<Document> live;
+                live.reserve(m_docs.size() - m_removedDocs);
+                m_docByKey.clear();
+                for (auto& doc : m_docs) {
+                    if (doc.removed) continue;
+                    m_docByKey[itemKey(*doc.item)] = live.size();
+                    live.push_back(std::move(doc));
+                }
+                m_docs = std::move(live);
+                m_removedDocs = 0;
+                m_postedDocs = 0;
+            }
+            if (m_postedDocs > 0) {
+                snapshot->runs = published->runs;
+            }
+
+            snapshot->items.reserve(m_docs.size());
+            for (const auto& doc : m_docs) {
+                snapshot->items.push_back(doc.removed ? nullptr : doc.item);
+            }
+            firstDoc = (uint32_t)m_postedDocs;
+            for (size_t i = m_postedDocs; i < m_docs.size(); i++) {
+                texts.push_back(m_docs[i].removed ? std::string() : m_docs[i].searchText);
+            }
+            m_postedDocs = m_docs.size();
+        }
+
+        auto run = std::make_shared<Postings>();
+        std::vector<std::string> tokens;
+        for (size_t i = 0; i < texts.size(); i++) {
+            tokens.clear();
+            tokenize(texts[i], tokens);
+            std::sort(tokens.begin(), tokens.end());
+            tokens.erase(std::unique(tokens.begin(), tokens.end()), tokens.end());
+            for (auto& token : tokens) {
+                run->emplace_back(std::move(token), firstDoc + (uint32_t)i);
+            }
+        }
+        std::sort(run->begin(), run->end());
+
+        // Merge like a binary counter: each posting is copied O(log n) times overall
+        while (!snapshot->runs.empty() && !run->empty() && snapshot->runs.back()->size() <= run->size()) {
+            const Postings& older = *snapshot->runs.back();
+            auto merged = std::make_shared<Postings>();
+            merged->reserve(older.size() + run->size());
+            std::merge(older.begin(), older.end(), run->begin(), run->end(), std::back_inserter(*merged));
+            snapshot->runs.pop_back();
+            run = std::move(merged);
+        }
+        if (!run->empty()) {
+            snapshot->runs.push_back(run);
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            // clear() may have published an empty index meanwhile
+            if (std::atomic_load(&m_snapshot)->generation < snapshot->generation) {
+                std::atomic_store(&m_snapshot, std::shared_ptr<const Snapshot>(snapshot));
+            }
+        }
+
+        auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now() - start).count();
+        brls::Logger::debug("SearchIndex: Added {} docs ({} total, {} runs) in {}ms",
+                           texts.size(), snapshot->items.size(), snapshot->runs.size(), ms);
+    }
+}
+
+std::vector<MediaItemSummary> SearchIndex::search(const std::string& query, size_t maxResults) {
+    std::vector<MediaItemSummary> results;
+
+    std::vector<std::string> queryTokens;
+    tokenize(query, queryTokens);
+    if (queryTokens.empty()) return results;
+
+    std::shared_ptr<const Snapshot> snapshot = std::atomic_load(&m_snapshot);
+
+    // Intersect the doc sets of every query token (each a prefix match)
+    std::vector<uint32_t> matches;
+    for (size_t t = 0; t < queryTokens.size(); t++) {
+        const std::string& prefix = queryTokens[t];
+        std::vector<uint32_t> docs;
+
+        for (const auto& run : snapshot->runs) {
+            auto it = std::lower_bound(run->begin(), run->end(), std::make_pair(prefix, (uint32_t)0));
+            for (; it != run->end() && it->first.compare(0, prefix.size(), prefix) == 0; ++it) {
+                if (snapshot->items[it->second]) docs.push_back(it->second);
+            }
+        }
+        std::sort(docs.begin(), docs.end());
+        docs.erase(std::unique(docs.begin(), docs.end()), docs.end());
+
+        if (t == 0) {
+            matches = std::move(docs);
+        } else {
+            std::vector<uint32_t> both;
+            std::set_intersection(matches.begin(), matches.end(), docs.begin(), docs.end(),
+                                  std::back_inserter(both));
+            matches = std::move(both);
+        }
+        if (matches.empty()) break;
+    }
+
+    for (uint32_t docIndex : matches) {
+        if (results.size() >= maxResults) break;
+        results.push_back(*snapshot->items[docIndex]);
+    }
+    return results;
+}
+
+void SearchIndex::clear() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_docs.clear();
+    m_docByKey.clear();
+    m_postedDocs = 0;
+    m_removedDocs = 0;
+
+    auto empty = std::make_shared<Snapshot>();
+    empty->generation = ++m_generation;
+    std::atomic_store(&m_snapshot, std::shared_ptr<const Snapshot>(empty));
+}
+
+} // namespace vitaabs
@@ -5,6 +5,7 @@
  */
 
 #include "player/mpv_player.hpp"
+#include "utils/network_scheduler.hpp"
 #include <borealis.hpp>
 
 #ifdef __vita__
@@ -169,6 +170,7 @@ bool MpvPlayer::init() {
     mpv_observe_property(m_mpv, 8, "seeking", MPV_FORMAT_FLAG);
     mpv_observe_property(m_mpv, 9, "speed", MPV_FORMAT_DOUBLE);
     mpv_observe_property(m_mpv, 10, "volume", MPV_FORMAT_INT64);
+    mpv_observe_property(m_mpv, 11, "demuxer-cache-duration", MPV_FORMAT_DOUBLE);
 
     brls::Logger::info("MpvPlayer: Initialized successfully");
     m_state = MpvPlayerState::IDLE;
@@ -198,6 +200,7 @@ void MpvPlayer::shutdown() {
         m_mpv = nullptr;
         m_stopping = false;
     }
+    NetworkScheduler::getInstance().streamEnded();
     m_state = MpvPlayerState::IDLE;
     m_commandPending = false;
 }
@@ -232,6 +235,7 @@ bool MpvPlayer::loadUrl(const std::string& url, const std::string& title, double
     m_currentUrl = normalizedUrl;
     m_playbackInfo = MpvPlaybackInfo();
     m_playbackInfo.mediaTitle = title;
+    NetworkScheduler::getInstance().streamEnded();  // The new source reports afresh
 
     // Mark command as pending
     m_commandPending = true;
@@ -297,6 +301,7 @@ void MpvPlayer::stop() {
 
     m_currentUrl.clear();
     m_playbackInfo = MpvPlaybackInfo();
+    NetworkScheduler::getInstance().streamEnded();
     setState(MpvPlayerState::IDLE);
 }
 
@@ -707,6 +712,7 @@ void MpvPlayer::handlePropertyChange(mpv_event_property* prop, uint64_t id) {
                 } else if (!buffering && m_state == MpvPlayerState::BUFFERING) {
                     setState(MpvPlayerState::PLAYING);
                 }
+                reportStreamCache();
             }
             break;
 
@@ -722,6 +728,7 @@ void MpvPlayer::handlePropertyChange(mpv_event_property* prop, uint64_t id) {
         case 8: // seeking
             if (prop->format == MPV_FORMAT_FLAG && prop->data) {
                 m_playbackInfo.seeking = *(int*)prop->data != 0;
+                reportStreamCache();
             }
             break;
 
@@ -736,7 +743,36 @@ void MpvPlayer::handlePropertyChange(mpv_event_property* prop, uint64_t id) {
                 m_playbackInfo.volume = (int)(*(int64_t*)prop->data);
             }
             break;
+
+        case 11: // demuxer-cache-duration
+            if (prop->format == MPV_FORMAT_DOUBLE && prop->data) {
+                m_playbackInfo.cacheDuration = *(double*)prop->data;
+                reportStreamCache();
+            }
+            break;
+    }
+}
+
+// Let background transfers back off while a network stream runs low.
+// The cache empties on every seek and shrinks towards the end of the file
+// without the network being slow, so neither is reported as starvation.
+void MpvPlayer::reportStreamCache() {
+    if (m_currentUrl.compare(0, 4, "http") != 0) return;
+
+    NetworkScheduler& scheduler = NetworkScheduler::getInstance();
+    const MpvPlaybackInfo& info = m_playbackInfo;
+
+    // Rest of the file buffered - the stream needs no more bandwidth
+    if (info.duration > 0 && info.cacheDuration >= 0 &&
+        info.position + info.cacheDuration >= info.duration - 1.0) {
+        scheduler.streamEnded();
+        return;
+    }
+    if (info.seeking) {
+        scheduler.reportStreamCache(false, -1.0);
+        return;
     }
+    scheduler.reportStreamCache(info.buffering, info.cacheDuration);
 }
 
 void MpvPlayer::updatePlaybackInfo() {
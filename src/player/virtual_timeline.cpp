@@ -0,0 +1,37 @@
+/**
+ * VitaABS - Virtual Timeline implementation
+ */
+
+#include "player/virtual_timeline.hpp"
+#include <algorithm>
+#include <cstdio>
+
+namespace vitaabs {
+
+void VirtualTimeline::addSegment(const std::string& path, double duration) {
+    TimelineSegment segment;
+    segment.path = path;
+    segment.duration = duration > 0 ? duration : 0.0;
+    m_segments.push_back(std::move(segment));
+}
+
+std::string VirtualTimeline::toEdlUrl() const {
+    bool knownLengths = std::all_of(m_segments.begin(), m_segments.end(),
+        [](const TimelineSegment& s) { return s.duration > 0; });
+
+    // "%<bytes>%" length-prefixes each path so ',' and ';' in names are safe
+    std::string url = "edl://";
+    for (size_t i = 0; i < m_segments.size(); i++) {
+        if (i > 0) url += ";";
+        url += "%" + std::to_string(m_segments[i].path.size()) + "%" + m_segments[i].path;
+        if (knownLengths) {
+            // path,start,length
+            char length[32];
+            snprintf(length, sizeof(length), ",0,%.3f", m_segments[i].duration);
+            url += length;
+        }
+    }
+    return url;
+}
+
+} // namespace vitaabs
@@ -0,0 +1,65 @@
+/**
+ * VitaABS - Allocation statistics implementation
+ */
+
+#include "utils/alloc_stats.hpp"
+
+#ifdef VITAABS_ALLOC_STATS
+#include <cstdlib>
+#include <new>
+#endif
+
+namespace vitaabs {
+
+static thread_local size_t s_allocCount = 0;
+
+AllocCounter::AllocCounter() : m_start(s_allocCount) {}
+
+size_t AllocCounter::count() const {
+    return s_allocCount - m_start;
+}
+
+bool AllocCounter::enabled() {
+#ifdef VITAABS_ALLOC_STATS
+    return true;
+#else
+    return false;
+#endif
+}
+
+} // namespace vitaabs
+
+#ifdef VITAABS_ALLOC_STATS
+
+static void* countedAlloc(std::size_t size) {
+    vitaabs::s_allocCount++;
+    void* ptr = std::malloc(size ? size : 1);
+    return ptr;
+}
+
+void* operator new(std::size_t size) {
+    void* ptr = countedAlloc(size);
+    if (!ptr) throw std::bad_alloc();
+    return ptr;
+}
+
+void* operator new[](std::size_t size) {
+    void* ptr = countedAlloc(size);
+    if (!ptr) throw std::bad_alloc();
+    return ptr;
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+    return countedAlloc(size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept {
+    return countedAlloc(size);
+}
+
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+void operator delete[](void* ptr) noexcept { std::free(ptr); }
+void operator delete(void* ptr, std::size_t) noexcept { std::free(ptr); }
+void operator delete[](void* ptr, std::size_t) noexcept { std::free(ptr); }
+
+#endif
@@ -4,7 +4,7 @@
 
 #include "utils/audio_utils.hpp"
 #include <borealis.hpp>
-#include <fstream>
+#include <cstdio>
 
 #ifdef __vita__
 #include <psp2/io/fcntl.h>
@@ -22,287 +22,128 @@ extern "C" {
 
 namespace vitaabs {
 
-bool concatenateAudioFiles(const std::vector<std::string>& inputFiles,
-                           const std::string& outputPath,
-                           std::function<void(int, int)> progressCallback) {
-    if (inputFiles.empty()) {
-        brls::Logger::error("concatenateAudioFiles: No input files provided");
-        return false;
-    }
-
-    // If only one file, just rename/copy it
-    if (inputFiles.size() == 1) {
-        brls::Logger::info("concatenateAudioFiles: Only one file, renaming to output");
+static void removeFile(const std::string& path) {
 #ifdef __vita__
-        // Copy file on Vita
-        SceUID srcFd = sceIoOpen(inputFiles[0].c_str(), SCE_O_RDONLY, 0);
-        if (srcFd < 0) return false;
-
-        SceUID dstFd = sceIoOpen(outputPath.c_str(), SCE_O_WRONLY | SCE_O_CREAT | SCE_O_TRUNC, 0777);
-        if (dstFd < 0) {
-            sceIoClose(srcFd);
-            return false;
-        }
-
-        char buffer[8192];
-        int bytesRead;
-        while ((bytesRead = sceIoRead(srcFd, buffer, sizeof(buffer))) > 0) {
-            sceIoWrite(dstFd, buffer, bytesRead);
-        }
-
-        sceIoClose(srcFd);
-        sceIoClose(dstFd);
+    sceIoRemove(path.c_str());
 #else
-        std::rename(inputFiles[0].c_str(), outputPath.c_str());
+    std::remove(path.c_str());
 #endif
-        return true;
-    }
-
-    brls::Logger::info("concatenateAudioFiles: Combining {} files into {}", inputFiles.size(), outputPath);
-
-    // Determine output format based on extension
-    std::string outputExt = ".m4b";
-    size_t dotPos = outputPath.rfind('.');
-    if (dotPos != std::string::npos) {
-        outputExt = outputPath.substr(dotPos);
-    }
+}
 
-    // For MP3 files, use simple binary concatenation (MP3 frames are self-contained)
-    if (outputExt == ".mp3") {
-        brls::Logger::info("concatenateAudioFiles: Using binary concatenation for MP3");
+#ifndef VitaABS_NO_FFMPEG
+// FFmpeg stream-copy muxer. The output stream is set up from the first
+// track; later tracks are appended with their timestamps shifted to follow.
+struct AudioConcatenator::Remuxer {
+    AVFormatContext* outputFmtCtx = nullptr;
+    AVStream* outStream = nullptr;
+    AVPacket* pkt = nullptr;
+    bool outputOpen = false;
+    int64_t currentPts = 0;
+    int64_t currentDts = 0;
+    int64_t packetsWritten = 0;
 
-        // Use heap allocation to avoid stack overflow on Vita
-        const size_t BUFFER_SIZE = 8192;
-        char* buffer = new char[BUFFER_SIZE];
-        if (!buffer) {
-            brls::Logger::error("concatenateAudioFiles: Failed to allocate buffer");
-            return false;
+    ~Remuxer() {
+        if (pkt) av_packet_free(&pkt);
+        if (outputFmtCtx) {
+            if (outputOpen && !(outputFmtCtx->oformat->flags & AVFMT_NOFILE)) {
+                avio_closep(&outputFmtCtx->pb);
+            }
+            avformat_free_context(outputFmtCtx);
         }
+    }
 
-#ifdef __vita__
-        SceUID outFd = sceIoOpen(outputPath.c_str(), SCE_O_WRONLY | SCE_O_CREAT | SCE_O_TRUNC, 0777);
-        if (outFd < 0) {
-            brls::Logger::error("concatenateAudioFiles: Could not create output file");
-            delete[] buffer;
-            return false;
+    bool create(const std::string& outputPath, const std::string& outputExt) {
+        // Try multiple formats in order of preference
+        // Note: "ipod" format may not be available on all platforms (like Vita)
+        const char* formatOptions[] = { nullptr, nullptr, nullptr };
+        int numFormats = 0;
+
+        if (outputExt == ".ogg") {
+            formatOptions[0] = "ogg";
+            numFormats = 1;
+        } else {
+            // For m4b/m4a, try mp4 first (more compatible), then ipod, then mov
+            formatOptions[0] = "mp4";
+            formatOptions[1] = "ipod";
+            formatOptions[2] = "mov";
+            numFormats = 3;
         }
 
-        int filesProcessed = 0;
-
-        for (size_t fileIdx = 0; fileIdx < inputFiles.size(); fileIdx++) {
-            const std::string& inputFile = inputFiles[fileIdx];
-            brls::Logger::info("concatenateAudioFiles: Appending file {}/{}: {}",
-                              fileIdx + 1, inputFiles.size(), inputFile);
-
-            SceUID inFd = sceIoOpen(inputFile.c_str(), SCE_O_RDONLY, 0);
-            if (inFd < 0) {
-                brls::Logger::warning("concatenateAudioFiles: Could not open {}", inputFile);
-                continue;
-            }
-
-            int bytesRead;
-            while ((bytesRead = sceIoRead(inFd, buffer, BUFFER_SIZE)) > 0) {
-                sceIoWrite(outFd, buffer, bytesRead);
+        int ret = -1;
+        for (int i = 0; i < numFormats; i++) {
+            ret = avformat_alloc_output_context2(&outputFmtCtx, nullptr, formatOptions[i], outputPath.c_str());
+            if (ret >= 0 && outputFmtCtx) {
+                brls::Logger::info("AudioConcatenator: Using output format '{}'", formatOptions[i]);
+                break;
             }
-
-            sceIoClose(inFd);
-            filesProcessed++;
-
-            if (progressCallback) {
-                progressCallback(filesProcessed, static_cast<int>(inputFiles.size()));
+            if (outputFmtCtx) {
+                avformat_free_context(outputFmtCtx);
+                outputFmtCtx = nullptr;
             }
         }
 
-        sceIoClose(outFd);
-        delete[] buffer;
-        brls::Logger::info("concatenateAudioFiles: Successfully concatenated {} MP3 files", filesProcessed);
-        return filesProcessed > 0;
-#else
-        std::ofstream outFile(outputPath, std::ios::binary);
-        if (!outFile) {
-            brls::Logger::error("concatenateAudioFiles: Could not create output file");
-            delete[] buffer;
+        if (ret < 0 || !outputFmtCtx) {
+            brls::Logger::error("AudioConcatenator: Could not create output context");
             return false;
         }
 
-        int filesProcessed = 0;
-
-        for (size_t fileIdx = 0; fileIdx < inputFiles.size(); fileIdx++) {
-            const std::string& inputFile = inputFiles[fileIdx];
-            brls::Logger::info("concatenateAudioFiles: Appending file {}/{}: {}",
-                              fileIdx + 1, inputFiles.size(), inputFile);
-
-            std::ifstream inFile(inputFile, std::ios::binary);
-            if (!inFile) {
-                brls::Logger::warning("concatenateAudioFiles: Could not open {}", inputFile);
-                continue;
-            }
-
-            while (inFile.read(buffer, BUFFER_SIZE) || inFile.gcount() > 0) {
-                outFile.write(buffer, inFile.gcount());
-            }
-
-            filesProcessed++;
-
-            if (progressCallback) {
-                progressCallback(filesProcessed, static_cast<int>(inputFiles.size()));
-            }
-        }
-
-        delete[] buffer;
-        brls::Logger::info("concatenateAudioFiles: Successfully concatenated {} MP3 files", filesProcessed);
-        return filesProcessed > 0;
-#endif
+        pkt = av_packet_alloc();
+        return pkt != nullptr;
     }
 
-#ifdef VitaABS_NO_FFMPEG
-    brls::Logger::error("concatenateAudioFiles: Non-MP3 concatenation requires FFmpeg (not available on this platform)");
-    return false;
-#else
-    AVFormatContext* outputFmtCtx = nullptr;
-
-    // Try multiple formats in order of preference
-    // Note: "ipod" format may not be available on all platforms (like Vita)
-    const char* formatOptions[] = { nullptr, nullptr, nullptr };
-    int numFormats = 0;
-
-    if (outputExt == ".ogg") {
-        formatOptions[0] = "ogg";
-        numFormats = 1;
-    } else {
-        // For m4b/m4a, try mp4 first (more compatible), then ipod, then mov
-        formatOptions[0] = "mp4";
-        formatOptions[1] = "ipod";
-        formatOptions[2] = "mov";
-        numFormats = 3;
-    }
-
-    int ret = -1;
-    const char* usedFormat = nullptr;
-    for (int i = 0; i < numFormats; i++) {
-        ret = avformat_alloc_output_context2(&outputFmtCtx, nullptr, formatOptions[i], outputPath.c_str());
-        if (ret >= 0 && outputFmtCtx) {
-            usedFormat = formatOptions[i];
-            brls::Logger::info("concatenateAudioFiles: Using output format '{}'", usedFormat);
-            break;
-        }
-        if (outputFmtCtx) {
-            avformat_free_context(outputFmtCtx);
-            outputFmtCtx = nullptr;
+    // Create the output stream from the first track and write the header
+    bool openOutput(const std::string& outputPath, AVStream* inStream) {
+        outStream = avformat_new_stream(outputFmtCtx, nullptr);
+        if (!outStream) {
+            brls::Logger::error("AudioConcatenator: Could not create output stream");
+            return false;
         }
-    }
-
-    if (ret < 0 || !outputFmtCtx) {
-        brls::Logger::error("concatenateAudioFiles: Could not create output context");
-        return false;
-    }
-
-    // Open first input file to get stream info
-    AVFormatContext* firstInputCtx = nullptr;
-    ret = avformat_open_input(&firstInputCtx, inputFiles[0].c_str(), nullptr, nullptr);
-    if (ret < 0) {
-        char errbuf[128];
-        av_strerror(ret, errbuf, sizeof(errbuf));
-        brls::Logger::error("concatenateAudioFiles: Could not open first input: {}", errbuf);
-        avformat_free_context(outputFmtCtx);
-        return false;
-    }
-
-    ret = avformat_find_stream_info(firstInputCtx, nullptr);
-    if (ret < 0) {
-        brls::Logger::error("concatenateAudioFiles: Could not find stream info");
-        avformat_close_input(&firstInputCtx);
-        avformat_free_context(outputFmtCtx);
-        return false;
-    }
-
-    // Find audio stream and create output stream
-    int audioStreamIndex = -1;
-    AVStream* outStream = nullptr;
-
-    for (unsigned int i = 0; i < firstInputCtx->nb_streams; i++) {
-        if (firstInputCtx->streams[i]->codecpar->codec_type == AVMEDIA_TYPE_AUDIO) {
-            audioStreamIndex = i;
 
-            outStream = avformat_new_stream(outputFmtCtx, nullptr);
-            if (!outStream) {
-                brls::Logger::error("concatenateAudioFiles: Could not create output stream");
-                avformat_close_input(&firstInputCtx);
-                avformat_free_context(outputFmtCtx);
-                return false;
-            }
+        int ret = avcodec_parameters_copy(outStream->codecpar, inStream->codecpar);
+        if (ret < 0) {
+            brls::Logger::error("AudioConcatenator: Could not copy codec parameters");
+            return false;
+        }
+        outStream->codecpar->codec_tag = 0;
+        outStream->time_base = inStream->time_base;
 
-            ret = avcodec_parameters_copy(outStream->codecpar, firstInputCtx->streams[i]->codecpar);
+        if (!(outputFmtCtx->oformat->flags & AVFMT_NOFILE)) {
+            ret = avio_open(&outputFmtCtx->pb, outputPath.c_str(), AVIO_FLAG_WRITE);
             if (ret < 0) {
-                brls::Logger::error("concatenateAudioFiles: Could not copy codec parameters");
-                avformat_close_input(&firstInputCtx);
-                avformat_free_context(outputFmtCtx);
+                char errbuf[128];
+                av_strerror(ret, errbuf, sizeof(errbuf));
+                brls::Logger::error("AudioConcatenator: Could not open output file: {}", errbuf);
                 return false;
             }
-
-            outStream->codecpar->codec_tag = 0;
-            outStream->time_base = firstInputCtx->streams[i]->time_base;
-            break;
         }
-    }
-
-    avformat_close_input(&firstInputCtx);
+        outputOpen = true;
 
-    if (audioStreamIndex < 0 || !outStream) {
-        brls::Logger::error("concatenateAudioFiles: No audio stream found");
-        avformat_free_context(outputFmtCtx);
-        return false;
-    }
-
-    // Open output file
-    if (!(outputFmtCtx->oformat->flags & AVFMT_NOFILE)) {
-        ret = avio_open(&outputFmtCtx->pb, outputPath.c_str(), AVIO_FLAG_WRITE);
+        ret = avformat_write_header(outputFmtCtx, nullptr);
         if (ret < 0) {
-            char errbuf[128];
-            av_strerror(ret, errbuf, sizeof(errbuf));
-            brls::Logger::error("concatenateAudioFiles: Could not open output file: {}", errbuf);
-            avformat_free_context(outputFmtCtx);
+            brls::Logger::error("AudioConcatenator: Could not write header");
             return false;
         }
+        return true;
     }
 
-    // Write header
-    ret = avformat_write_header(outputFmtCtx, nullptr);
-    if (ret < 0) {
-        brls::Logger::error("concatenateAudioFiles: Could not write header");
-        if (!(outputFmtCtx->oformat->flags & AVFMT_NOFILE))
-            avio_closep(&outputFmtCtx->pb);
-        avformat_free_context(outputFmtCtx);
-        return false;
-    }
-
-    // Process each input file
-    AVPacket* pkt = av_packet_alloc();
-    int64_t currentPts = 0;
-    int64_t currentDts = 0;
-    int64_t packetsWritten = 0;
-    int filesProcessed = 0;
-
-    for (size_t fileIdx = 0; fileIdx < inputFiles.size(); fileIdx++) {
-        const std::string& inputFile = inputFiles[fileIdx];
-
-        brls::Logger::info("concatenateAudioFiles: Processing file {}/{}: {}",
-                          fileIdx + 1, inputFiles.size(), inputFile);
+    // Returns false only if the output is unusable; a bad input track is skipped
+    bool addFile(const std::string& outputPath, const std::string& inputFile, bool& appended) {
+        appended = false;
 
         AVFormatContext* inputFmtCtx = nullptr;
-        ret = avformat_open_input(&inputFmtCtx, inputFile.c_str(), nullptr, nullptr);
+        int ret = avformat_open_input(&inputFmtCtx, inputFile.c_str(), nullptr, nullptr);
         if (ret < 0) {
             char errbuf[128];
             av_strerror(ret, errbuf, sizeof(errbuf));
-            brls::Logger::warning("concatenateAudioFiles: Could not open input {}: {}", inputFile, errbuf);
-            continue;
+            brls::Logger::warning("AudioConcatenator: Could not open input {}: {}", inputFile, errbuf);
+            return outStream != nullptr;
         }
 
         ret = avformat_find_stream_info(inputFmtCtx, nullptr);
         if (ret < 0) {
-            brls::Logger::warning("concatenateAudioFiles: Could not find stream info for {}", inputFile);
+            brls::Logger::warning("AudioConcatenator: Could not find stream info for {}", inputFile);
             avformat_close_input(&inputFmtCtx);
-            continue;
+            return outStream != nullptr;
         }
 
         // Find audio stream in this file
@@ -315,13 +156,18 @@ bool concatenateAudioFiles(const std::vector<std::string>& inputFiles,
         }
 
         if (inAudioIdx < 0) {
-            brls::Logger::warning("concatenateAudioFiles: No audio stream in {}", inputFile);
+            brls::Logger::warning("AudioConcatenator: No audio stream in {}", inputFile);
             avformat_close_input(&inputFmtCtx);
-            continue;
+            return outStream != nullptr;
         }
 
         AVStream* inStream = inputFmtCtx->streams[inAudioIdx];
-        int64_t fileDuration = 0;
+        if (!outStream && !openOutput(outputPath, inStream)) {
+            avformat_close_input(&inputFmtCtx);
+            return false;
+        }
+
+        int64_t fileDuration = currentPts;
         int64_t firstPts = AV_NOPTS_VALUE;
 
         // Read all packets from this file
@@ -350,11 +196,8 @@ bool concatenateAudioFiles(const std::vector<std::string>& inputFiles,
                     fileDuration = pkt->pts + pkt->duration;
                 }
 
-                ret = av_interleaved_write_frame(outputFmtCtx, pkt);
-                if (ret < 0) {
-                    // Don't fail on individual packet errors
-                }
-
+                // Don't fail on individual packet errors
+                av_interleaved_write_frame(outputFmtCtx, pkt);
                 packetsWritten++;
             }
             av_packet_unref(pkt);
@@ -365,28 +208,237 @@ bool concatenateAudioFiles(const std::vector<std::string>& inputFiles,
         currentDts = fileDuration;
 
         avformat_close_input(&inputFmtCtx);
-        filesProcessed++;
+        appended = true;
+        return true;
+    }
 
-        // Report progress
-        if (progressCallback) {
-            progressCallback(filesProcessed, static_cast<int>(inputFiles.size()));
+    bool finish() {
+        if (!outStream) return false;
+        av_write_trailer(outputFmtCtx);
+        brls::Logger::info("AudioConcatenator: Wrote {} packets", packetsWritten);
+        return true;
+    }
+};
+#else
+struct AudioConcatenator::Remuxer {};
+#endif // VitaABS_NO_FFMPEG
+
+AudioConcatenator::AudioConcatenator(const std::string& outputPath)
+    : m_outputPath(outputPath) {
+    // Determine output format based on extension
+    std::string outputExt = ".m4b";
+    size_t dotPos = outputPath.rfind('.');
+    if (dotPos != std::string::npos) {
+        outputExt = outputPath.substr(dotPos);
+    }
+
+    // For MP3 files, use simple binary concatenation (MP3 frames are self-contained)
+    m_binary = outputExt == ".mp3";
+    if (m_binary) {
+        m_failed = !openBinaryOutput();
+        return;
+    }
+
+#ifdef VitaABS_NO_FFMPEG
+    brls::Logger::error("AudioConcatenator: Non-MP3 concatenation requires FFmpeg (not available on this platform)");
+    m_failed = true;
+#else
+    m_remuxer.reset(new Remuxer());
+    m_failed = !m_remuxer->create(outputPath, outputExt);
+#endif
+}
+
+AudioConcatenator::~AudioConcatenator() {
+    if (m_binary) {
+        closeBinaryOutput();
+    }
+    m_remuxer.reset();
+    if (!m_finished) {
+        removeFile(m_outputPath);
+    }
+}
+
+bool AudioConcatenator::openBinaryOutput() {
+#ifdef __vita__
+    m_fd = sceIoOpen(m_outputPath.c_str(), SCE_O_WRONLY | SCE_O_CREAT | SCE_O_TRUNC, 0777);
+    if (m_fd < 0) {
+        brls::Logger::error("AudioConcatenator: Could not create output file {}", m_outputPath);
+        return false;
+    }
+#else
+    m_file.open(m_outputPath, std::ios::binary | std::ios::trunc);
+    if (!m_file.is_open()) {
+        brls::Logger::error("AudioConcatenator: Could not create output file {}", m_outputPath);
+        return false;
+    }
+#endif
+    return true;
+}
+
+void AudioConcatenator::closeBinaryOutput() {
+#ifdef __vita__
+    if (m_fd >= 0) {
+        sceIoClose(m_fd);
+        m_fd = -1;
+    }
+#else
+    if (m_file.is_open()) {
+        m_file.close();
+    }
+#endif
+}
+
+bool AudioConcatenator::appendData(const char* data, size_t size) {
+    if (m_failed || !m_binary) return false;
+
+#ifdef __vita__
+    int written = sceIoWrite(m_fd, data, size);
+    if (written < 0 || static_cast<size_t>(written) != size) {
+        brls::Logger::error("AudioConcatenator: Write to {} failed", m_outputPath);
+        m_failed = true;
+        return false;
+    }
+#else
+    if (!m_file.write(data, size)) {
+        brls::Logger::error("AudioConcatenator: Write to {} failed", m_outputPath);
+        m_failed = true;
+        return false;
+    }
+#endif
+    m_trackBytes += size;
+    return true;
+}
+
+void AudioConcatenator::endTrack() {
+    if (m_trackBytes > 0) {
+        m_tracksAppended++;
+    }
+    m_trackBytes = 0;
+}
+
+bool AudioConcatenator::appendFile(const std::string& inputPath, bool deleteInput) {
+    if (m_failed) return false;
+
+    brls::Logger::info("AudioConcatenator: Appending track {}: {}", m_tracksAppended + 1, inputPath);
+
+    bool ok = true;
+    if (m_binary) {
+        // Use heap allocation to avoid stack overflow on Vita
+        const size_t BUFFER_SIZE = 64 * 1024;
+        std::unique_ptr<char[]> buffer(new char[BUFFER_SIZE]);
+        bool opened = false;
+
+#ifdef __vita__
+        SceUID inFd = sceIoOpen(inputPath.c_str(), SCE_O_RDONLY, 0);
+        if (inFd >= 0) {
+            opened = true;
+            int bytesRead;
+            while (ok && (bytesRead = sceIoRead(inFd, buffer.get(), BUFFER_SIZE)) > 0) {
+                ok = appendData(buffer.get(), bytesRead);
+            }
+            sceIoClose(inFd);
+        }
+#else
+        std::ifstream inFile(inputPath, std::ios::binary);
+        if (inFile) {
+            opened = true;
+            while (ok && (inFile.read(buffer.get(), BUFFER_SIZE) || inFile.gcount() > 0)) {
+                ok = appendData(buffer.get(), static_cast<size_t>(inFile.gcount()));
+            }
         }
+#endif
+        if (!opened) {
+            brls::Logger::warning("AudioConcatenator: Could not open {}", inputPath);
+        }
+        endTrack();
+    } else {
+#ifndef VitaABS_NO_FFMPEG
+        bool appended = false;
+        ok = m_remuxer->addFile(m_outputPath, inputPath, appended);
+        if (appended) {
+            m_tracksAppended++;
+        }
+        m_failed = !ok;
+#endif
     }
 
-    av_packet_free(&pkt);
+    if (deleteInput) {
+        removeFile(inputPath);
+    }
+    return ok;
+}
 
-    // Write trailer
-    av_write_trailer(outputFmtCtx);
+bool AudioConcatenator::finish() {
+    if (m_finished) return true;
 
-    // Cleanup
-    if (!(outputFmtCtx->oformat->flags & AVFMT_NOFILE))
-        avio_closep(&outputFmtCtx->pb);
-    avformat_free_context(outputFmtCtx);
+    bool ok = !m_failed && m_tracksAppended > 0;
+    if (m_binary) {
+        closeBinaryOutput();
+    } else if (ok) {
+#ifndef VitaABS_NO_FFMPEG
+        ok = m_remuxer->finish();
+#endif
+    }
+    m_remuxer.reset();
 
-    brls::Logger::info("concatenateAudioFiles: Successfully combined {} files ({} packets)",
-                       filesProcessed, packetsWritten);
-    return filesProcessed > 0;
-#endif // VitaABS_NO_FFMPEG
+    if (!ok) {
+        brls::Logger::error("AudioConcatenator: Failed to build {}", m_outputPath);
+        return false;
+    }
+
+    m_finished = true;
+    brls::Logger::info("AudioConcatenator: Combined {} tracks into {}", m_tracksAppended, m_outputPath);
+    return true;
+}
+
+bool concatenateAudioFiles(const std::vector<std::string>& inputFiles,
+                           const std::string& outputPath,
+                           std::function<void(int, int)> progressCallback) {
+    if (inputFiles.empty()) {
+        brls::Logger::error("concatenateAudioFiles: No input files provided");
+        return false;
+    }
+
+    // If only one file, just rename/copy it
+    if (inputFiles.size() == 1) {
+        brls::Logger::info("concatenateAudioFiles: Only one file, renaming to output");
+#ifdef __vita__
+        // Copy file on Vita
+        SceUID srcFd = sceIoOpen(inputFiles[0].c_str(), SCE_O_RDONLY, 0);
+        if (srcFd < 0) return false;
+
+        SceUID dstFd = sceIoOpen(outputPath.c_str(), SCE_O_WRONLY | SCE_O_CREAT | SCE_O_TRUNC, 0777);
+        if (dstFd < 0) {
+            sceIoClose(srcFd);
+            return false;
+        }
+
+        char buffer[8192];
+        int bytesRead;
+        while ((bytesRead = sceIoRead(srcFd, buffer, sizeof(buffer))) > 0) {
+            sceIoWrite(dstFd, buffer, bytesRead);
+        }
+
+        sceIoClose(srcFd);
+        sceIoClose(dstFd);
+#else
+        std::rename(inputFiles[0].c_str(), outputPath.c_str());
+#endif
+        return true;
+    }
+
+    brls::Logger::info("concatenateAudioFiles: Combining {} files into {}", inputFiles.size(), outputPath);
+
+    AudioConcatenator concatenator(outputPath);
+    for (size_t fileIdx = 0; fileIdx < inputFiles.size(); fileIdx++) {
+        if (!concatenator.appendFile(inputFiles[fileIdx], false)) {
+            return false;
+        }
+        if (progressCallback) {
+            progressCallback(static_cast<int>(fileIdx + 1), static_cast<int>(inputFiles.size()));
+        }
+    }
+    return concatenator.finish();
 }
 
 } // namespace vitaabs
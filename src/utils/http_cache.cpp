@@ -0,0 +1,169 @@
+/**
+ * VitaABS - HTTP response cache implementation
+ */
+
+#include "utils/http_cache.hpp"
+#include "platform/platform.hpp"
+#include <borealis.hpp>
+#include <cctype>
+
+namespace vitaabs {
+
+// Entries kept before the least recently used is evicted (bodies can be large)
+static const size_t MAX_ENTRIES = 64;
+
+// How often a waiter checks its cancel token while sharing another fetch
+static const int CANCEL_POLL_MS = 20;
+
+static std::string findHeader(const std::map<std::string, std::string>& headers, const std::string& name) {
+    for (const auto& h : headers) {
+        if (h.first.size() != name.size()) continue;
+        bool match = true;
+        for (size_t i = 0; i < name.size() && match; i++) {
+            match = std::tolower((unsigned char)h.first[i]) == std::tolower((unsigned char)name[i]);
+        }
+        if (match) return h.second;
+    }
+    return "";
+}
+
+HttpCache& HttpCache::getInstance() {
+    static HttpCache instance;
+    return instance;
+}
+
+// Same URL fetched with different credentials must not share an entry
+std::string HttpCache::makeKey(const HttpRequest& req) {
+    auto auth = req.headers.find("Authorization");
+    return req.url + "\n" + (auth != req.headers.end() ? auth->second : "");
+}
+
+void HttpCache::touchUnlocked(Entry& entry) {
+    m_lru.splice(m_lru.begin(), m_lru, entry.lruPos);
+}
+
+void HttpCache::eraseUnlocked(std::unordered_map<std::string, Entry>::iterator it) {
+    m_lru.erase(it->second.lruPos);
+    m_entries.erase(it);
+}
+
+HttpResponse HttpCache::request(const HttpRequest& req, const Fetcher& fetch) {
+    std::string key = makeKey(req);
+    auto now = std::chrono::steady_clock::now();
+
+    std::shared_ptr<InFlight> flight;
+    HttpRequest networkReq = req;
+    uint64_t generation = 0;
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+
+        // Join a fetch of the same resource that is already running
+        for (;;) {
+            auto running = m_inFlight.find(key);
+            if (running == m_inFlight.end()) break;
+
+            std::shared_ptr<InFlight> other = running->second;
+            if (req.cancelToken) {
+                // Nothing signals the token, so poll it while waiting
+                const HttpCancelToken& token = req.cancelToken;
+                while (!other->done && !token->load()) {
+                    platform::condWaitFor(m_mutex, lock, CANCEL_POLL_MS,
+                                          [&other, &token] { return other->done || token->load(); });
+                }
+                if (!other->done) {
+                    HttpResponse cancelled;
+                    cancelled.error = "Cancelled";
+                    cancelled.cancelled = true;
+                    return cancelled;
+                }
+            } else {
+                m_fetchDone.wait(lock, [&other] { return other->done; });
+            }
+            if (!other->response.cancelled) {
+                brls::Logger::debug("HttpCache: Shared in-flight fetch of {}", req.url);
+                return other->response;
+            }
+            // Its caller gave up - fetch for ourselves
+        }
+
+        auto cached = m_entries.find(key);
+        if (cached != m_entries.end()) {
+            if (now - cached->second.fetchedAt < std::chrono::seconds(req.cacheTtl)) {
+                brls::Logger::debug("HttpCache: Hit {}", req.url);
+                touchUnlocked(cached->second);
+                return cached->second.response;
+            }
+            if (!cached->second.etag.empty()) {
+                networkReq.headers["If-None-Match"] = cached->second.etag;
+            }
+        }
+
+        flight = std::make_shared<InFlight>();
+        m_inFlight[key] = flight;
+        generation = m_generation;
+    }
+
+    HttpResponse resp = fetch(networkReq);
+    bool revalidated = false;
+
+    if (resp.statusCode == 304) {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        auto cached = m_entries.find(key);
+        if (cached != m_entries.end()) {
+            brls::Logger::debug("HttpCache: Revalidated {}", req.url);
+            cached->second.fetchedAt = std::chrono::steady_clock::now();
+            touchUnlocked(cached->second);
+            resp = cached->second.response;
+            revalidated = true;
+        } else {
+            // Invalidated while revalidating - the 304 has no body to use
+            lock.unlock();
+            resp = fetch(req);
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (!revalidated && resp.statusCode == 200 && generation == m_generation) {
+        auto existing = m_entries.find(key);
+        if (existing != m_entries.end()) {
+            eraseUnlocked(existing);
+        } else if (m_entries.size() >= MAX_ENTRIES) {
+            eraseUnlocked(m_entries.find(m_lru.back()));
+        }
+        m_lru.push_front(key);
+        Entry& entry = m_entries[key];
+        entry.lruPos = m_lru.begin();
+        entry.response = resp;
+        entry.etag = findHeader(resp.headers, "ETag");
+        entry.fetchedAt = std::chrono::steady_clock::now();
+    }
+
+    flight->response = resp;
+    flight->done = true;
+    m_inFlight.erase(key);
+    m_fetchDone.notify_all();
+    return resp;
+}
+
+void HttpCache::invalidate(const std::string& urlFragment) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_generation++;
+    for (auto it = m_entries.begin(); it != m_entries.end();) {
+        // Match against the URL part of the key only
+        if (it->first.find(urlFragment) < it->first.find('\n')) {
+            m_lru.erase(it->second.lruPos);
+            it = m_entries.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+void HttpCache::clear() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_generation++;
+    m_entries.clear();
+    m_lru.clear();
+}
+
+} // namespace vitaabs
@@ -3,12 +3,14 @@
  */
 
 #include "utils/http_client.hpp"
+#include "utils/http_cache.hpp"
 #include "app/application.hpp"
 
 #include <borealis.hpp>
 #include <curl/curl.h>
 #include <cstring>
 #include <cstdio>
+#include <cstdlib>
 #include <cctype>
 
 namespace vitaabs {
@@ -20,8 +22,26 @@ static const char* USER_AGENT = "VitaABS/" VITAABS_VERSION;
 struct WriteCallbackData {
     std::string* buffer;
     int64_t totalSize;
+    NetPriority priority;
+    const std::atomic<bool>* cancel;
 };
 
+// Curl header callback data
+struct HeaderCallbackData {
+    std::map<std::string, std::string>* headers;
+    std::string* body;
+};
+
+// Largest Content-Length the response body is reserved for up front
+static const int64_t MAX_BODY_RESERVE = 32 * 1024 * 1024;
+
+// Transfer progress callback - aborts the request once its cancel token is set
+static int cancelProgressCallback(void* userp, curl_off_t dltotal, curl_off_t dlnow,
+                                  curl_off_t ultotal, curl_off_t ulnow) {
+    std::atomic<bool>* cancel = static_cast<std::atomic<bool>*>(userp);
+    return (cancel && cancel->load()) ? 1 : 0;  // Non-zero aborts the transfer
+}
+
 bool HttpClient::globalInit() {
     CURLcode res = curl_global_init(CURL_GLOBAL_DEFAULT);
     if (res != CURLE_OK) {
@@ -58,6 +78,7 @@ size_t HttpClient::writeCallback(void* contents, size_t size, size_t nmemb, void
 
     if (data && data->buffer) {
         data->buffer->append((char*)contents, totalSize);
+        NetworkScheduler::getInstance().throttle(data->priority, totalSize, data->cancel);
     }
 
     return totalSize;
@@ -65,7 +86,8 @@ size_t HttpClient::writeCallback(void* contents, size_t size, size_t nmemb, void
 
 size_t HttpClient::headerCallback(void* contents, size_t size, size_t nmemb, void* userp) {
     size_t totalSize = size * nmemb;
-    std::map<std::string, std::string>* headers = (std::map<std::string, std::string>*)userp;
+    HeaderCallbackData* data = (HeaderCallbackData*)userp;
+    std::map<std::string, std::string>* headers = data ? data->headers : nullptr;
 
     if (headers) {
         std::string header((char*)contents, totalSize);
@@ -83,6 +105,16 @@ size_t HttpClient::headerCallback(void* contents, size_t size, size_t nmemb, voi
                 value.pop_back();
             }
 
+            // Size the body once instead of growing it chunk by chunk
+            std::string lowerKey = key;
+            for (char& c : lowerKey) c = std::tolower(c);
+            if (data->body && lowerKey == "content-length") {
+                int64_t contentLength = std::strtoll(value.c_str(), nullptr, 10);
+                if (contentLength > 0 && contentLength <= MAX_BODY_RESERVE) {
+                    data->body->reserve((size_t)contentLength);
+                }
+            }
+
             (*headers)[key] = value;
         }
     }
@@ -123,6 +155,14 @@ HttpResponse HttpClient::del(const std::string& url) {
 }
 
 HttpResponse HttpClient::request(const HttpRequest& req) {
+    if (req.cacheTtl > 0 && req.method == "GET") {
+        return HttpCache::getInstance().request(req, [this](const HttpRequest& networkReq) {
+            HttpRequest uncached = networkReq;
+            uncached.cacheTtl = 0;
+            return request(uncached);
+        });
+    }
+
     HttpResponse response;
 
     if (!m_curl) {
@@ -130,6 +170,12 @@ HttpResponse HttpClient::request(const HttpRequest& req) {
         return response;
     }
 
+    if (req.cancelToken && req.cancelToken->load()) {
+        response.error = "Cancelled";
+        response.cancelled = true;
+        return response;
+    }
+
     CURL* curl = (CURL*)m_curl;
 
     // Reset curl handle
@@ -162,13 +208,26 @@ HttpResponse HttpClient::request(const HttpRequest& req) {
     WriteCallbackData writeData;
     writeData.buffer = &response.body;
     writeData.totalSize = 0;
+    writeData.priority = req.priority;
+    writeData.cancel = req.cancelToken.get();
 
     curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, writeCallback);
     curl_easy_setopt(curl, CURLOPT_WRITEDATA, &writeData);
 
     // Headers callback
+    HeaderCallbackData headerData;
+    headerData.headers = &response.headers;
+    headerData.body = &response.body;
+
     curl_easy_setopt(curl, CURLOPT_HEADERFUNCTION, headerCallback);
-    curl_easy_setopt(curl, CURLOPT_HEADERDATA, &response.headers);
+    curl_easy_setopt(curl, CURLOPT_HEADERDATA, &headerData);
+
+    // Cancellation - polled by curl during the transfer
+    if (req.cancelToken) {
+        curl_easy_setopt(curl, CURLOPT_XFERINFOFUNCTION, cancelProgressCallback);
+        curl_easy_setopt(curl, CURLOPT_XFERINFODATA, req.cancelToken.get());
+        curl_easy_setopt(curl, CURLOPT_NOPROGRESS, 0L);
+    }
 
     // Build headers list
     struct curl_slist* headerList = nullptr;
@@ -229,6 +288,10 @@ HttpResponse HttpClient::request(const HttpRequest& req) {
         response.success = (httpCode >= 200 && httpCode < 300);
 
         brls::Logger::debug("HTTP response: {} ({} bytes)", response.statusCode, response.body.length());
+    } else if (res == CURLE_ABORTED_BY_CALLBACK && req.cancelToken && req.cancelToken->load()) {
+        response.error = "Cancelled";
+        response.cancelled = true;
+        brls::Logger::debug("HTTP request cancelled: {}", req.url);
     } else {
         response.error = curl_easy_strerror(res);
         brls::Logger::error("HTTP error: {}", response.error);
@@ -300,7 +363,7 @@ std::string HttpClient::urlDecode(const std::string& str) {
 bool HttpClient::get(const std::string& url, std::string& response) {
     HttpResponse res = get(url);
     if (res.success) {
-        response = res.body;
+        response = std::move(res.body);
         return true;
     }
     return false;
@@ -312,6 +375,7 @@ struct DownloadCallbackData {
     HttpClient::SizeCallback sizeCallback;
     bool sizeReported;
     bool cancelled;
+    NetPriority priority;
 };
 
 static size_t downloadWriteCallback(void* contents, size_t size, size_t nmemb, void* userp) {
@@ -324,6 +388,7 @@ static size_t downloadWriteCallback(void* contents, size_t size, size_t nmemb, v
             data->cancelled = true;
             return 0; // Return 0 to signal curl to abort
         }
+        NetworkScheduler::getInstance().throttle(data->priority, totalSize);
     }
 
     return totalSize;
@@ -403,6 +468,7 @@ bool HttpClient::downloadFile(const std::string& url, WriteCallback writeCallbac
     callbackData.sizeCallback = sizeCallback;
     callbackData.sizeReported = false;
     callbackData.cancelled = false;
+    callbackData.priority = m_downloadPriority;
 
     // Set callbacks
     curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, downloadWriteCallback);
@@ -3,11 +3,10 @@
  */
 
 #include "utils/image_loader.hpp"
-#include "utils/http_client.hpp"
 
 namespace vitaabs {
 
-std::map<std::string, std::vector<uint8_t>> ImageLoader::s_cache;
+std::map<std::string, SharedHttpBody> ImageLoader::s_cache;
 std::mutex ImageLoader::s_cacheMutex;
 bool ImageLoader::s_paused = false;
 
@@ -25,20 +24,28 @@ void ImageLoader::loadAsync(const std::string& url, LoadCallback callback, brls:
         std::lock_guard<std::mutex> lock(s_cacheMutex);
         auto it = s_cache.find(url);
         if (it != s_cache.end()) {
-            target->setImageFromMem(it->second.data(), it->second.size());
+            const std::string& imageData = *it->second;
+            target->setImageFromMem(reinterpret_cast<const unsigned char*>(imageData.data()),
+                                    (int)imageData.size());
             if (callback) callback(target);
             return;
         }
     }
 
+    // An expired guard means the view is gone; only an empty one means unguarded
+    bool guarded = alive.owner_before(std::weak_ptr<bool>()) || std::weak_ptr<bool>().owner_before(alive);
+
     // Load asynchronously
-    brls::async([url, callback, target, alive]() {
+    brls::async([url, callback, target, alive, guarded]() {
         HttpClient client;
-        HttpResponse resp = client.get(url);
+        HttpRequest req;
+        req.url = url;
+        req.priority = NetPriority::COVER;
+        HttpResponse resp = client.request(req);
 
         if (resp.success && !resp.body.empty()) {
             brls::Logger::debug("ImageLoader: Successfully loaded {} bytes from {}", resp.body.size(), url);
-            std::vector<uint8_t> imageData(resp.body.begin(), resp.body.end());
+            SharedHttpBody imageData = resp.takeBody();
 
             {
                 std::lock_guard<std::mutex> lock(s_cacheMutex);
@@ -48,10 +55,11 @@ void ImageLoader::loadAsync(const std::string& url, LoadCallback callback, brls:
                 s_cache[url] = imageData;
             }
 
-            brls::sync([imageData, callback, target, alive]() {
+            brls::sync([imageData, callback, target, alive, guarded]() {
                 auto alivePtr = alive.lock();
-                if (alivePtr && !*alivePtr) return;
-                target->setImageFromMem(imageData.data(), imageData.size());
+                if (guarded && (!alivePtr || !*alivePtr)) return;
+                target->setImageFromMem(reinterpret_cast<const unsigned char*>(imageData->data()),
+                                        (int)imageData->size());
                 if (callback) callback(target);
             });
         } else {
@@ -0,0 +1,45 @@
+/**
+ * VitaABS - Interned strings implementation
+ */
+
+#include "utils/interned_string.hpp"
+#include <unordered_set>
+#include <mutex>
+
+namespace vitaabs {
+
+namespace {
+
+// Node-based set: element addresses stay valid as the pool grows
+struct StringPool {
+    std::unordered_set<std::string> strings;
+    std::mutex mutex;
+};
+
+StringPool& pool() {
+    static StringPool instance;
+    return instance;
+}
+
+} // namespace
+
+const std::string& InternedString::emptyString() {
+    static const std::string empty;
+    return empty;
+}
+
+const std::string* InternedString::intern(const std::string& str) {
+    if (str.empty()) return &emptyString();
+
+    StringPool& p = pool();
+    std::lock_guard<std::mutex> lock(p.mutex);
+    return &*p.strings.insert(str).first;
+}
+
+size_t InternedString::poolSize() {
+    StringPool& p = pool();
+    std::lock_guard<std::mutex> lock(p.mutex);
+    return p.strings.size();
+}
+
+} // namespace vitaabs
@@ -0,0 +1,258 @@
+/**
+ * VitaABS - JSON structural scanning implementation
+ */
+
+#include "utils/json_scan.hpp"
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define VITAABS_JSON_NEON
+#elif defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define VITAABS_JSON_SSE2
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define VITAABS_JSON_AVX2
+#endif
+#endif
+
+namespace vitaabs {
+namespace {
+
+inline bool isStructural(char c) {
+    return c == '"' || c == '\\' || c == '{' || c == '}' || c == '[' || c == ']';
+}
+
+inline bool isStringSpecial(char c) {
+    return c == '"' || c == '\\';
+}
+
+inline unsigned countTrailingZeros(uint64_t mask) {
+#if defined(__GNUC__) || defined(__clang__)
+    return (unsigned)__builtin_ctzll(mask);
+#else
+    unsigned n = 0;
+    while (!(mask & 1)) {
+        mask >>= 1;
+        n++;
+    }
+    return n;
+#endif
+}
+
+#if defined(VITAABS_JSON_NEON)
+
+// NEON has no movemask: narrow each 0x00/0xFF lane to a nibble instead,
+// so the index of the first match is ctz / 4
+inline uint64_t neonMask(uint8x16_t matches) {
+    uint8x8_t nibbles = vshrn_n_u16(vreinterpretq_u16_u8(matches), 4);
+    return vget_lane_u64(vreinterpret_u64_u8(nibbles), 0);
+}
+
+template <bool Structural>
+size_t scan(const char* data, size_t len, size_t pos) {
+    const uint8x16_t quote = vdupq_n_u8('"');
+    const uint8x16_t backslash = vdupq_n_u8('\\');
+    // '{' | 0x20 == '{' and '[' | 0x20 == '{', likewise '}' / ']'
+    const uint8x16_t caseBit = vdupq_n_u8(0x20);
+    const uint8x16_t openBrace = vdupq_n_u8('{');
+    const uint8x16_t closeBrace = vdupq_n_u8('}');
+
+    for (; pos + 16 <= len; pos += 16) {
+        uint8x16_t block = vld1q_u8(reinterpret_cast<const uint8_t*>(data + pos));
+        uint8x16_t matches = vorrq_u8(vceqq_u8(block, quote), vceqq_u8(block, backslash));
+        if (Structural) {
+            uint8x16_t folded = vorrq_u8(block, caseBit);
+            matches = vorrq_u8(matches, vorrq_u8(vceqq_u8(folded, openBrace),
+                                                 vceqq_u8(folded, closeBrace)));
+        }
+        uint64_t mask = neonMask(matches);
+        if (mask) {
+            return pos + (countTrailingZeros(mask) >> 2);
+        }
+    }
+    return pos;
+}
+
+#elif defined(VITAABS_JSON_SSE2)
+
+template <bool Structural>
+size_t scan(const char* data, size_t len, size_t pos) {
+    // '{' | 0x20 == '{' and '[' | 0x20 == '{', likewise '}' / ']'
+#if defined(VITAABS_JSON_AVX2)
+    const __m256i quote32 = _mm256_set1_epi8('"');
+    const __m256i backslash32 = _mm256_set1_epi8('\\');
+    const __m256i caseBit32 = _mm256_set1_epi8(0x20);
+    const __m256i openBrace32 = _mm256_set1_epi8('{');
+    const __m256i closeBrace32 = _mm256_set1_epi8('}');
+
+    for (; pos + 32 <= len; pos += 32) {
+        __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + pos));
+        __m256i matches = _mm256_or_si256(_mm256_cmpeq_epi8(block, quote32),
+                                          _mm256_cmpeq_epi8(block, backslash32));
+        if (Structural) {
+            __m256i folded = _mm256_or_si256(block, caseBit32);
+            matches = _mm256_or_si256(matches, _mm256_or_si256(_mm256_cmpeq_epi8(folded, openBrace32),
+                                                               _mm256_cmpeq_epi8(folded, closeBrace32)));
+        }
+        uint32_t mask = (uint32_t)_mm256_movemask_epi8(matches);
+        if (mask) {
+            return pos + countTrailingZeros(mask);
+        }
+    }
+#endif
+
+    const __m128i quote = _mm_set1_epi8('"');
+    const __m128i backslash = _mm_set1_epi8('\\');
+    const __m128i caseBit = _mm_set1_epi8(0x20);
+    const __m128i openBrace = _mm_set1_epi8('{');
+    const __m128i closeBrace = _mm_set1_epi8('}');
+
+    for (; pos + 16 <= len; pos += 16) {
+        __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + pos));
+        __m128i matches = _mm_or_si128(_mm_cmpeq_epi8(block, quote), _mm_cmpeq_epi8(block, backslash));
+        if (Structural) {
+            __m128i folded = _mm_or_si128(block, caseBit);
+            matches = _mm_or_si128(matches, _mm_or_si128(_mm_cmpeq_epi8(folded, openBrace),
+                                                         _mm_cmpeq_epi8(folded, closeBrace)));
+        }
+        uint32_t mask = (uint32_t)_mm_movemask_epi8(matches);
+        if (mask) {
+            return pos + countTrailingZeros(mask);
+        }
+    }
+    return pos;
+}
+
+#else
+
+template <bool Structural>
+size_t scan(const char*, size_t, size_t pos) {
+    return pos;
+}
+
+#endif
+
+// Vector blocks first, then the tail (or everything, without SIMD) bytewise
+template <bool Structural>
+size_t findNext(std::string_view json, size_t from) {
+    const char* data = json.data();
+    size_t len = json.size();
+    if (from >= len) return std::string_view::npos;
+
+    for (size_t pos = scan<Structural>(data, len, from); pos < len; pos++) {
+        if (Structural ? isStructural(data[pos]) : isStringSpecial(data[pos])) {
+            return pos;
+        }
+    }
+    return std::string_view::npos;
+}
+
+} // namespace
+
+size_t findJsonStructural(std::string_view json, size_t from) {
+    return findNext<true>(json, from);
+}
+
+size_t findJsonStringEnd(std::string_view json, size_t quotePos) {
+    size_t pos = quotePos + 1;
+    while ((pos = findNext<false>(json, pos)) != std::string_view::npos) {
+        if (json[pos] == '"') return pos;
+        pos += 2;  // Skip the escaped character
+    }
+    return json.size();
+}
+
+size_t findJsonContainerEnd(std::string_view json, size_t openPos) {
+    int depth = 1;
+    size_t pos = openPos + 1;
+    while ((pos = findJsonStructural(json, pos)) != std::string_view::npos) {
+        switch (json[pos]) {
+            case '"':
+                pos = findJsonStringEnd(json, pos);
+                break;
+            case '\\':
+                pos++;
+                break;
+            case '{':
+            case '[':
+                depth++;
+                break;
+            default:
+                if (--depth == 0) return pos + 1;
+                break;
+        }
+        pos++;
+    }
+    return json.size();
+}
+
+bool nextJsonMember(std::string_view object, size_t& pos,
+                    std::string_view& key, std::string_view& value) {
+    if (pos == 0) {
+        pos = object.find('{');
+        if (pos == std::string_view::npos) return false;
+        pos++;
+    }
+
+    pos = object.find_first_not_of(" \t\n\r,", pos);
+    if (pos == std::string_view::npos || object[pos] != '"') return false;
+
+    size_t keyEnd = findJsonStringEnd(object, pos);
+    key = object.substr(pos + 1, keyEnd - pos - 1);
+
+    size_t colonPos = object.find(':', keyEnd);
+    if (colonPos == std::string_view::npos) return false;
+    size_t valueStart = object.find_first_not_of(" \t\n\r", colonPos + 1);
+    if (valueStart == std::string_view::npos) return false;
+
+    char c = object[valueStart];
+    if (c == '"') {
+        size_t valueEnd = findJsonStringEnd(object, valueStart);
+        value = object.substr(valueStart + 1, valueEnd - valueStart - 1);
+        pos = valueEnd + 1;
+    } else if (c == '{' || c == '[') {
+        pos = findJsonContainerEnd(object, valueStart);
+        value = object.substr(valueStart, pos - valueStart);
+    } else {
+        pos = object.find_first_of(",}] \t\n\r", valueStart);
+        if (pos == std::string_view::npos) pos = object.size();
+        value = object.substr(valueStart, pos - valueStart);
+        if (value == "null") value = {};
+    }
+    return true;
+}
+
+// strtod/strtoll need a terminated string; numbers are short, so copy to the stack
+static void copyNumber(std::string_view value, char (&buf)[32]) {
+    size_t len = value.size() < sizeof(buf) - 1 ? value.size() : sizeof(buf) - 1;
+    std::memcpy(buf, value.data(), len);
+    buf[len] = '\0';
+}
+
+int parseJsonInt(std::string_view value) {
+    return static_cast<int>(parseJsonInt64(value));
+}
+
+int64_t parseJsonInt64(std::string_view value) {
+    if (value.empty()) return 0;
+    char buf[32];
+    copyNumber(value, buf);
+    return std::strtoll(buf, nullptr, 10);
+}
+
+float parseJsonFloat(std::string_view value) {
+    if (value.empty()) return 0.0f;
+    char buf[32];
+    copyNumber(value, buf);
+    return static_cast<float>(std::strtod(buf, nullptr));
+}
+
+bool parseJsonBool(std::string_view value) {
+    return value == "true" || value == "1";
+}
+
+} // namespace vitaabs
@@ -0,0 +1,121 @@
+/**
+ * VitaABS - Network scheduler implementation
+ */
+
+#include "utils/network_scheduler.hpp"
+#include <borealis.hpp>
+#include <algorithm>
+
+namespace vitaabs {
+
+// Rates per class while the player is starved, indexed by NetPriority.
+// Downloads stay well above curl's low-speed abort (1 KB/s).
+static const int64_t CONSTRAINED_RATES[] = {
+    0,              // STREAMING
+    256 * 1024,     // API
+    32 * 1024,      // COVER
+    16 * 1024,      // DOWNLOAD
+};
+
+// Buffered audio below which a draining cache throttles lower classes, and
+// above which they are restored (the gap stops the limits from flapping).
+// Vita reads ahead 10 s (cache-secs), so the restore level stays below that.
+static const double LOW_CACHE_SECONDS = 3.0;
+static const double RESTORE_CACHE_SECONDS = 8.0;
+
+// Longest single sleep, so lifted limits and cancellation are noticed quickly
+static const std::chrono::milliseconds MAX_THROTTLE_SLEEP(100);
+
+NetworkScheduler& NetworkScheduler::getInstance() {
+    static NetworkScheduler instance;
+    return instance;
+}
+
+void NetworkScheduler::refill(TokenBucket& bucket, std::chrono::steady_clock::time_point now) {
+    double elapsed = std::chrono::duration<double>(now - bucket.refilled).count();
+    double burst = bucket.rate / 4.0;  // A quarter second's worth
+    bucket.tokens = std::min(burst, bucket.tokens + elapsed * bucket.rate);
+    bucket.refilled = now;
+}
+
+void NetworkScheduler::throttle(NetPriority priority, size_t bytes, const std::atomic<bool>* cancel) {
+    if (priority == NetPriority::STREAMING || priority == NetPriority::COUNT) return;
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    TokenBucket& bucket = m_buckets[static_cast<int>(priority)];
+    if (bucket.rate <= 0) return;
+
+    refill(bucket, std::chrono::steady_clock::now());
+    bucket.tokens -= static_cast<double>(bytes);
+
+    // Sleep off the debt; wakes early when the limits are lifted
+    while (bucket.rate > 0 && bucket.tokens < 0) {
+        if (cancel && cancel->load()) return;
+
+        std::chrono::duration<double> debt(-bucket.tokens / bucket.rate);
+        auto wait = std::min<std::chrono::steady_clock::duration>(
+            std::chrono::duration_cast<std::chrono::steady_clock::duration>(debt), MAX_THROTTLE_SLEEP);
+        m_limitsChanged.wait_for(lock, wait);
+
+        if (bucket.rate > 0) {
+            refill(bucket, std::chrono::steady_clock::now());
+        }
+    }
+}
+
+void NetworkScheduler::reportStreamCache(bool pausedForCache, double cacheSeconds) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    bool known = cacheSeconds >= 0.0;
+
+    // An empty cache after a load or seek is still filling; only a cache that
+    // was full and keeps shrinking means the network is falling behind
+    bool draining = known && m_cacheFilled && m_lastCacheSeconds >= 0.0 && cacheSeconds < m_lastCacheSeconds;
+    if (!known) {
+        m_cacheFilled = false;
+    } else if (cacheSeconds >= RESTORE_CACHE_SECONDS) {
+        m_cacheFilled = true;
+    }
+    m_lastCacheSeconds = cacheSeconds;
+
+    if (!m_constrained) {
+        if (pausedForCache || (draining && cacheSeconds < LOW_CACHE_SECONDS)) {
+            brls::Logger::info("NetworkScheduler: Stream starved (stalled={}, cache={:.1f}s), throttling background transfers",
+                               pausedForCache, cacheSeconds);
+            setConstrainedUnlocked(true);
+        }
+    } else if (!pausedForCache && known && cacheSeconds >= RESTORE_CACHE_SECONDS) {
+        brls::Logger::info("NetworkScheduler: Stream recovered (cache={:.1f}s), lifting limits", cacheSeconds);
+        setConstrainedUnlocked(false);
+    }
+}
+
+void NetworkScheduler::streamEnded() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_cacheFilled = false;
+    m_lastCacheSeconds = -1.0;
+    if (m_constrained) {
+        brls::Logger::info("NetworkScheduler: Playback ended, lifting limits");
+        setConstrainedUnlocked(false);
+    }
+}
+
+bool NetworkScheduler::isConstrained() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_constrained;
+}
+
+void NetworkScheduler::setConstrainedUnlocked(bool constrained) {
+    m_constrained = constrained;
+
+    auto now = std::chrono::steady_clock::now();
+    for (int i = 0; i < static_cast<int>(NetPriority::COUNT); i++) {
+        TokenBucket& bucket = m_buckets[i];
+        bucket.rate = constrained ? CONSTRAINED_RATES[i] : 0;
+        bucket.tokens = bucket.rate / 4.0;
+        bucket.refilled = now;
+    }
+
+    m_limitsChanged.notify_all();
+}
+
+} // namespace vitaabs
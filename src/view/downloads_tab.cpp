@@ -17,18 +17,20 @@
 #include <thread>
 #include <chrono>
 #include <cmath>
+#include <climits>
+#include <algorithm>
 
 #ifdef __vita__
 #include <psp2/io/fcntl.h>
 #endif
 
-// Auto-refresh interval in milliseconds
-static const int AUTO_REFRESH_INTERVAL_MS = 3000;
-static const int AUTO_REFRESH_INTERVAL_LARGE_MS = 5000;
-static const int LARGE_QUEUE_THRESHOLD = 50;
-
 namespace vitaabs {
 
+// Recycler row heights - fixed, so rows off screen never need views
+static const float HEADER_ROW_HEIGHT = 40.0f;
+static const float LOCAL_ROW_HEIGHT = 74.0f;
+static const float SERVER_ROW_HEIGHT = 62.0f;
+
 // Helper to format bytes as human-readable MB string
 static std::string formatMB(int64_t bytes) {
     double mb = static_cast<double>(bytes) / (1024.0 * 1024.0);
@@ -77,6 +79,309 @@ static void loadLocalCoverImage(brls::Image* image, const std::string& localPath
 #endif
 }
 
+// Section title ("Local Downloads", "Server Downloads")
+class DownloadsTab::HeaderCell : public brls::RecyclerCell {
+public:
+    HeaderCell() {
+        this->setFocusable(false);
+        this->setJustifyContent(brls::JustifyContent::FLEX_END);
+        this->setPaddingBottom(10);
+
+        m_label = new brls::Label();
+        m_label->setFontSize(18);
+        this->addView(m_label);
+    }
+
+    void setTitle(const std::string& title) { m_label->setText(title); }
+
+private:
+    brls::Label* m_label = nullptr;
+};
+
+// Download on this Vita: cover, title, progress and queue actions
+class DownloadsTab::LocalRowCell : public brls::RecyclerCell {
+public:
+    LocalRowCell() {
+        // The recycler stacks cells edge to edge - the padding spaces the rows
+        this->setPaddingBottom(8);
+
+        m_row = new brls::Box();
+        m_row->setAxis(brls::Axis::ROW);
+        m_row->setJustifyContent(brls::JustifyContent::SPACE_BETWEEN);
+        m_row->setAlignItems(brls::AlignItems::CENTER);
+        m_row->setPadding(8);
+        m_row->setCornerRadius(6);
+        m_row->setGrow(1.0f);
+        this->addView(m_row);
+
+        // Cover image
+        m_cover = new brls::Image();
+        m_cover->setWidth(50);
+        m_cover->setHeight(50);
+        m_cover->setCornerRadius(4);
+        m_cover->setMargins(0, 12, 0, 0);
+        m_row->addView(m_cover);
+
+        // Info column (left side, grows)
+        auto* infoBox = new brls::Box();
+        infoBox->setAxis(brls::Axis::COLUMN);
+        infoBox->setGrow(1.0f);
+
+        m_title = new brls::Label();
+        m_title->setFontSize(16);
+        m_title->setSingleLine(true);
+        infoBox->addView(m_title);
+
+        m_author = new brls::Label();
+        m_author->setFontSize(13);
+        m_author->setTextColor(nvgRGBA(180, 180, 180, 255));
+        m_author->setSingleLine(true);
+        infoBox->addView(m_author);
+
+        m_row->addView(infoBox);
+
+        // Status box (right side: progress label + square button icon)
+        auto* statusBox = new brls::Box();
+        statusBox->setAxis(brls::Axis::ROW);
+        statusBox->setAlignItems(brls::AlignItems::CENTER);
+
+        m_progress = new brls::Label();
+        m_progress->setFontSize(14);
+        m_progress->setMargins(0, 0, 0, 10);
+        statusBox->addView(m_progress);
+
+        // Square button icon - only visible when row is focused
+        m_xButtonIcon = new brls::Image();
+        m_xButtonIcon->setWidth(24);
+        m_xButtonIcon->setHeight(24);
+        m_xButtonIcon->setScalingType(brls::ImageScalingType::FIT);
+        m_xButtonIcon->setImageFromFile(RESOURCE_PREFIX "images/square_button.png");
+        m_xButtonIcon->setMarginLeft(8);
+        m_xButtonIcon->setVisibility(brls::Visibility::INVISIBLE);
+        statusBox->addView(m_xButtonIcon);
+
+        m_row->addView(statusBox);
+
+        // Square button action - cancel download
+        this->registerAction("Cancel", brls::ControllerButton::BUTTON_X, [this](brls::View*) {
+            DownloadsManager::getInstance().cancelDownload(m_itemId, m_episodeId);
+            brls::Application::notify("Download cancelled");
+            return true;
+        });
+    }
+
+    ~LocalRowCell() override {
+        if (m_coverToken) *m_coverToken = false;
+    }
+
+    void bind(const LocalRow& row) {
+        m_itemId = row.itemId;
+        m_episodeId = row.episodeId;
+
+        m_title->setText(row.title);
+        m_author->setText(row.authorName);
+        m_author->setVisibility(row.authorName.empty() ? brls::Visibility::GONE : brls::Visibility::VISIBLE);
+
+        setProgress(row.state, row.downloadedBytes, row.totalBytes);
+        setQueueActions(row.state == DownloadState::QUEUED);
+
+        std::string coverSource = !row.localCoverPath.empty() ? row.localCoverPath : row.coverUrl;
+        if (coverSource != m_coverSource) {
+            m_coverSource = coverSource;
+            loadCover(row);
+        }
+    }
+
+    void onFocusGained() override {
+        brls::RecyclerCell::onFocusGained();
+        m_xButtonIcon->setVisibility(brls::Visibility::VISIBLE);
+    }
+
+    void onFocusLost() override {
+        brls::RecyclerCell::onFocusLost();
+        m_xButtonIcon->setVisibility(brls::Visibility::INVISIBLE);
+    }
+
+private:
+    void setProgress(DownloadState state, int64_t downloadedBytes, int64_t totalBytes) {
+        std::string progressText;
+        if (state == DownloadState::DOWNLOADING) {
+            // Show progress in MB format
+            progressText = formatMB(downloadedBytes) + " / " + formatMB(totalBytes);
+            m_progress->setTextColor(nvgRGBA(100, 200, 100, 255));
+            m_row->setBackgroundColor(nvgRGBA(30, 60, 30, 200));
+        } else if (state == DownloadState::PAUSED) {
+            progressText = "Paused - " + formatMB(downloadedBytes) + " / " + formatMB(totalBytes);
+            m_progress->setTextColor(nvgRGBA(200, 180, 100, 255));
+            m_row->setBackgroundColor(nvgRGBA(50, 50, 30, 200));
+        } else if (state == DownloadState::FAILED) {
+            progressText = "Failed";
+            m_progress->setTextColor(nvgRGBA(200, 100, 100, 255));
+            m_row->setBackgroundColor(nvgRGBA(60, 30, 30, 200));
+        } else {
+            progressText = "Queued";
+            m_progress->setTextColor(nvgRGBA(255, 255, 255, 255));
+            m_row->setBackgroundColor(nvgRGBA(40, 40, 40, 200));
+        }
+        m_progress->setText(progressText);
+    }
+
+    // Queue order actions, only while the download waits in the queue
+    void setQueueActions(bool queued) {
+        if (queued == !m_queueActions.empty()) return;
+
+        if (!queued) {
+            for (brls::ActionIdentifier id : m_queueActions) {
+                this->unregisterAction(id);
+            }
+            m_queueActions.clear();
+            return;
+        }
+
+        m_queueActions.push_back(this->registerAction("Move Up", brls::ControllerButton::BUTTON_LB, [this](brls::View*) {
+            DownloadsManager::getInstance().moveDownload(m_itemId, m_episodeId, -1);
+            return true;
+        }));
+        m_queueActions.push_back(this->registerAction("Move Down", brls::ControllerButton::BUTTON_RB, [this](brls::View*) {
+            DownloadsManager::getInstance().moveDownload(m_itemId, m_episodeId, 1);
+            return true;
+        }));
+        m_queueActions.push_back(this->registerAction("Download Next", brls::ControllerButton::BUTTON_Y, [this](brls::View*) {
+            if (DownloadsManager::getInstance().prioritizeDownload(m_itemId, m_episodeId)) {
+                brls::Application::notify("Moved to the front of the queue");
+            }
+            return true;
+        }));
+    }
+
+    void loadCover(const LocalRow& row) {
+        // A load still in flight for the previous item must not land here
+        if (m_coverToken) *m_coverToken = false;
+        m_coverToken = std::make_shared<bool>(true);
+        m_cover->clear();
+
+        if (!row.localCoverPath.empty()) {
+            loadLocalCoverImage(m_cover, row.localCoverPath);
+        } else if (!row.coverUrl.empty()) {
+            ImageLoader::loadAsync(row.coverUrl, [](brls::Image*) {}, m_cover, m_coverToken);
+        }
+    }
+
+    std::string m_itemId;
+    std::string m_episodeId;
+    std::string m_coverSource;
+    std::shared_ptr<bool> m_coverToken;
+    std::vector<brls::ActionIdentifier> m_queueActions;
+
+    brls::Box* m_row = nullptr;
+    brls::Image* m_cover = nullptr;
+    brls::Label* m_title = nullptr;
+    brls::Label* m_author = nullptr;
+    brls::Label* m_progress = nullptr;
+    brls::Image* m_xButtonIcon = nullptr;
+};
+
+// Episode the ABS server is downloading into a podcast library
+class DownloadsTab::ServerRowCell : public brls::RecyclerCell {
+public:
+    ServerRowCell() {
+        this->setPaddingBottom(6);
+
+        auto* row = new brls::Box();
+        row->setAxis(brls::Axis::ROW);
+        row->setAlignItems(brls::AlignItems::CENTER);
+        row->setPadding(8);
+        row->setBackgroundColor(nvgRGBA(40, 40, 40, 200));
+        row->setCornerRadius(6);
+        row->setGrow(1.0f);
+        this->addView(row);
+
+        auto* infoBox = new brls::Box();
+        infoBox->setAxis(brls::Axis::COLUMN);
+        infoBox->setGrow(1.0f);
+
+        m_title = new brls::Label();
+        m_title->setFontSize(15);
+        m_title->setSingleLine(true);
+        infoBox->addView(m_title);
+
+        m_podcast = new brls::Label();
+        m_podcast->setFontSize(13);
+        m_podcast->setTextColor(nvgRGBA(180, 180, 180, 255));
+        m_podcast->setSingleLine(true);
+        infoBox->addView(m_podcast);
+
+        row->addView(infoBox);
+
+        m_status = new brls::Label();
+        m_status->setFontSize(13);
+        row->addView(m_status);
+    }
+
+    void bind(const ServerEpisodeDownload& dl, bool first) {
+        m_title->setText(dl.episodeTitle);
+        m_podcast->setText(dl.podcastTitle);
+        if (first && !dl.failed) {
+            m_status->setText("Downloading");
+            m_status->setTextColor(nvgRGBA(100, 200, 100, 255));
+        } else if (dl.failed) {
+            m_status->setText("Failed");
+            m_status->setTextColor(nvgRGBA(200, 100, 100, 255));
+        } else {
+            m_status->setText("Queued");
+            m_status->setTextColor(nvgRGBA(180, 180, 180, 255));
+        }
+    }
+
+private:
+    brls::Label* m_title = nullptr;
+    brls::Label* m_podcast = nullptr;
+    brls::Label* m_status = nullptr;
+};
+
+class DownloadsTab::ListSource : public brls::RecyclerDataSource {
+public:
+    explicit ListSource(DownloadsTab* tab) : m_tab(tab) {}
+
+    int numberOfRows(brls::RecyclerFrame*, int) override {
+        return static_cast<int>(m_tab->m_rows.size());
+    }
+
+    float heightForRow(brls::RecyclerFrame*, brls::IndexPath index) override {
+        switch (m_tab->m_rows[index.row].kind) {
+            case ListRow::Kind::HEADER: return HEADER_ROW_HEIGHT;
+            case ListRow::Kind::LOCAL: return LOCAL_ROW_HEIGHT;
+            case ListRow::Kind::SERVER: return SERVER_ROW_HEIGHT;
+        }
+        return LOCAL_ROW_HEIGHT;
+    }
+
+    brls::RecyclerCell* cellForRow(brls::RecyclerFrame* recycler, brls::IndexPath index) override {
+        const ListRow& row = m_tab->m_rows[index.row];
+        switch (row.kind) {
+            case ListRow::Kind::HEADER: {
+                auto* cell = static_cast<HeaderCell*>(recycler->dequeueReusableCell("Header"));
+                cell->setTitle(row.title);
+                return cell;
+            }
+            case ListRow::Kind::LOCAL: {
+                auto* cell = static_cast<LocalRowCell*>(recycler->dequeueReusableCell("Local"));
+                cell->bind(m_tab->m_localRows[row.index]);
+                return cell;
+            }
+            case ListRow::Kind::SERVER: {
+                auto* cell = static_cast<ServerRowCell*>(recycler->dequeueReusableCell("Server"));
+                cell->bind(m_tab->m_serverRows[row.index], row.index == 0);
+                return cell;
+            }
+        }
+        return nullptr;
+    }
+
+private:
+    DownloadsTab* m_tab;
+};
+
 DownloadsTab::DownloadsTab() {
     m_alive = std::make_shared<bool>(true);
 
@@ -227,10 +532,10 @@ DownloadsTab::DownloadsTab() {
             mgr.waitForDownloadThread();
 
             // Cancel all non-completed downloads
-            auto downloads = mgr.getDownloadStates();
-            for (const auto& item : downloads) {
-                if (item.state != DownloadState::COMPLETED) {
-                    mgr.cancelDownload(item.itemId);
+            DownloadsSnapshotRef snapshot = mgr.getSnapshot();
+            for (const auto& item : snapshot->items) {
+                if (item->state != DownloadState::COMPLETED) {
+                    mgr.cancelDownload(item->itemId);
                 }
             }
 
@@ -272,59 +577,16 @@ DownloadsTab::DownloadsTab() {
     });
     m_actionsRow->addView(m_syncBtn);
 
-    // === Local Downloads Section ===
-    m_serverSection = new brls::Box();
-    m_serverSection->setAxis(brls::Axis::COLUMN);
-    m_serverSection->setGrow(1.0f);
-    m_serverSection->setMargins(0, 0, 15, 0);
-    m_serverSection->setVisibility(brls::Visibility::GONE);
-    this->addView(m_serverSection);
-
-    m_serverHeader = new brls::Label();
-    m_serverHeader->setText("Local Downloads");
-    m_serverHeader->setFontSize(18);
-    m_serverHeader->setMargins(0, 0, 10, 0);
-    m_serverSection->addView(m_serverHeader);
-
-    m_serverEmptyLabel = new brls::Label();
-    m_serverEmptyLabel->setText("No active downloads");
-    m_serverEmptyLabel->setFontSize(14);
-    m_serverEmptyLabel->setTextColor(nvgRGBA(120, 120, 120, 255));
-    m_serverEmptyLabel->setMargins(10, 0, 10, 0);
-    m_serverSection->addView(m_serverEmptyLabel);
-
-    m_serverScroll = new brls::ScrollingFrame();
-    m_serverScroll->setGrow(1.0f);
-    m_serverScroll->setVisibility(brls::Visibility::GONE);
-    m_serverSection->addView(m_serverScroll);
-
-    m_serverContainer = new brls::Box();
-    m_serverContainer->setAxis(brls::Axis::COLUMN);
-    m_serverScroll->setContentView(m_serverContainer);
-
-    // === Server Downloads Section (ABS server downloading podcast episodes) ===
-    m_absSection = new brls::Box();
-    m_absSection->setAxis(brls::Axis::COLUMN);
-    m_absSection->setMargins(0, 0, 15, 0);
-    m_absSection->setVisibility(brls::Visibility::GONE);
-    this->addView(m_absSection);
-
-    m_absHeader = new brls::Label();
-    m_absHeader->setText("Server Downloads");
-    m_absHeader->setFontSize(18);
-    m_absHeader->setMargins(0, 0, 10, 0);
-    m_absSection->addView(m_absHeader);
-
-    m_absEmptyLabel = new brls::Label();
-    m_absEmptyLabel->setText("No server downloads");
-    m_absEmptyLabel->setFontSize(14);
-    m_absEmptyLabel->setTextColor(nvgRGBA(120, 120, 120, 255));
-    m_absEmptyLabel->setMargins(10, 0, 10, 0);
-    m_absSection->addView(m_absEmptyLabel);
-
-    m_absContainer = new brls::Box();
-    m_absContainer->setAxis(brls::Axis::COLUMN);
-    m_absSection->addView(m_absContainer);
+    // === Download list: local downloads, then ABS server downloads ===
+    m_list = new brls::RecyclerFrame();
+    m_list->setGrow(1.0f);
+    m_list->setVisibility(brls::Visibility::GONE);
+    m_list->estimatedRowHeight = LOCAL_ROW_HEIGHT;
+    m_list->registerCell("Header", []() -> brls::RecyclerCell* { return new HeaderCell(); });
+    m_list->registerCell("Local", []() -> brls::RecyclerCell* { return new LocalRowCell(); });
+    m_list->registerCell("Server", []() -> brls::RecyclerCell* { return new ServerRowCell(); });
+    m_list->setDataSource(new ListSource(this));  // Owned by the recycler
+    this->addView(m_list);
 
     // Empty state
     m_emptyStateBox = new brls::Box();
@@ -359,62 +621,30 @@ void DownloadsTab::willAppear(bool resetState) {
     // Initialize downloads manager once (not on every refresh)
     DownloadsManager::getInstance().init();
 
-    // Clear tracking vectors for fresh start
-    m_serverRowElements.clear();
-    m_lastServerItems.clear();
-    m_currentFocusedIcon = nullptr;
-
-    // Remove stale row views
-    if (m_serverContainer) {
-        while (m_serverContainer->getChildren().size() > 0)
-            m_serverContainer->removeView(m_serverContainer->getChildren()[0]);
-    }
+    // Re-read the downloads even if the snapshot is the one last shown
+    m_shownSnapshot.reset();
 
-    m_lastProgressRefresh = std::chrono::steady_clock::now();
-
-    // Register progress callback for live UI updates
-    DownloadsManager& mgr = DownloadsManager::getInstance();
+    // Rows change only when the downloads manager reports a change
     std::weak_ptr<bool> aliveWeak = m_alive;
-    mgr.setProgressCallback([this, aliveWeak](float downloadedBytes, float totalBytes) {
-        auto now = std::chrono::steady_clock::now();
-        auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(now - m_lastProgressRefresh).count();
-
-        // Update every 500ms to avoid flooding the UI thread
-        const int FAST_PROGRESS_INTERVAL_MS = 500;
-        if (elapsed >= FAST_PROGRESS_INTERVAL_MS || downloadedBytes >= totalBytes) {
-            m_lastProgressRefresh = now;
-            if (m_autoRefreshEnabled.load()) {
-                brls::sync([this, aliveWeak]() {
-                    auto alive = aliveWeak.lock();
-                    if (!alive || !*alive) return;
-                    if (m_autoRefreshEnabled.load()) {
-                        refreshServerQueue();
-                    }
-                });
-            }
-        }
-    });
-
-    // Register item completion callback
-    mgr.setItemCompletionCallback([this, aliveWeak](const std::string& itemId, const std::string& episodeId, bool success) {
-        if (!m_autoRefreshEnabled.load()) return;
-
-        brls::sync([this, aliveWeak]() {
+    if (m_eventSubscription) {
+        DownloadsManager::getInstance().unsubscribeEvents(m_eventSubscription);
+    }
+    m_eventSubscription = DownloadsManager::getInstance().subscribeEvents(
+        [this, aliveWeak](const std::vector<DownloadEvent>& events) {
             auto alive = aliveWeak.lock();
             if (!alive || !*alive) return;
-            if (!m_autoRefreshEnabled.load()) return;
-            // Full refresh to move item from server queue to local downloads
-            refresh();
+            onDownloadEvents(events);
         });
-    });
 
     refresh();
     refreshServerDownloads();  // Fetch ABS server download queue (network, only on tab appear)
-    startAutoRefresh();
 }
 
 DownloadsTab::~DownloadsTab() {
     if (m_alive) *m_alive = false;
+    if (m_eventSubscription) {
+        DownloadsManager::getInstance().unsubscribeEvents(m_eventSubscription);
+    }
 }
 
 void DownloadsTab::willDisappear(bool resetState) {
@@ -422,16 +652,12 @@ void DownloadsTab::willDisappear(bool resetState) {
 
     if (m_alive) *m_alive = false;
 
-    stopAutoRefresh();
-
-    DownloadsManager& mgr = DownloadsManager::getInstance();
-    mgr.setProgressCallback(nullptr);
-    mgr.setItemCompletionCallback(nullptr);
+    if (m_eventSubscription) {
+        DownloadsManager::getInstance().unsubscribeEvents(m_eventSubscription);
+        m_eventSubscription = 0;
+    }
 
     ImageLoader::cancelAll();
-
-    m_serverRowElements.clear();
-    m_currentFocusedIcon = nullptr;
 }
 
 void DownloadsTab::refresh() {
@@ -443,50 +669,62 @@ void DownloadsTab::refresh() {
 void DownloadsTab::refreshServerQueue() {
     DownloadsManager& mgr = DownloadsManager::getInstance();
 
-    // Use lightweight state snapshot (no deep copy of chapters/files)
-    auto downloads = mgr.getDownloadStates();
-
-    // Build list of active (non-completed) items for server queue
-    struct ServerInfo {
-        std::string itemId, episodeId, title, authorName, coverUrl, localCoverPath;
-        int64_t downloadedBytes, totalBytes;
-        int state;
-    };
-    std::vector<ServerInfo> serverItems;
+    // Published snapshot - nothing to do if it hasn't changed since the last refresh
+    DownloadsSnapshotRef snapshot = mgr.getSnapshot();
+    bool downloading = mgr.isDownloading();
+    if (m_shownSnapshot && m_shownSnapshot->version == snapshot->version &&
+        m_shownDownloading == downloading) {
+        return;
+    }
+    m_shownSnapshot = snapshot;
+    m_shownDownloading = downloading;
 
+    // Active (non-completed) items for the local downloads section
+    std::vector<LocalRow> rows;
     bool isAnyDownloading = false;
-    for (const auto& item : downloads) {
-        if (item.state != DownloadState::COMPLETED) {
-            ServerInfo si;
-            si.itemId = item.itemId;
-            si.episodeId = item.episodeId;
-            si.title = item.title;
-            si.authorName = item.authorName;
-            si.coverUrl = item.coverUrl;
-            si.localCoverPath = item.localCoverPath;
-            si.downloadedBytes = item.downloadedBytes;
-            si.totalBytes = item.totalBytes;
-            si.state = static_cast<int>(item.state);
-            serverItems.push_back(si);
-            if (item.state == DownloadState::DOWNLOADING) isAnyDownloading = true;
-        }
+    for (size_t i = 0; i < snapshot->items.size(); i++) {
+        const DownloadItem& item = *snapshot->items[i];
+        if (item.state == DownloadState::COMPLETED) continue;
+
+        LocalRow row;
+        row.itemId = item.itemId;
+        row.episodeId = item.episodeId;
+        row.title = item.title;
+        row.authorName = item.authorName;
+        row.coverUrl = item.coverUrl;
+        row.localCoverPath = item.localCoverPath;
+        row.downloadedBytes = item.downloadedBytes;
+        row.totalBytes = item.totalBytes;
+        row.state = item.state;
+        row.queueRank = snapshot->queueRanks[i];
+        rows.push_back(std::move(row));
+        if (item.state == DownloadState::DOWNLOADING) isAnyDownloading = true;
     }
 
+    // Active download first, then the queue in download order, then paused/failed
+    auto displayOrder = [](const LocalRow& row) {
+        if (row.state == DownloadState::DOWNLOADING) return -1;
+        return row.queueRank >= 0 ? row.queueRank : INT_MAX;
+    };
+    std::stable_sort(rows.begin(), rows.end(), [&displayOrder](const LocalRow& a, const LocalRow& b) {
+        return displayOrder(a) < displayOrder(b);
+    });
+
     // Update status
-    m_downloaderRunning = isAnyDownloading || mgr.isDownloading();
+    m_downloaderRunning = isAnyDownloading || downloading;
     if (m_startStopLabel) {
         m_startStopLabel->setText(m_downloaderRunning ? "Pause" : "Start");
     }
     if (m_downloadStatusLabel) {
-        if (serverItems.empty()) {
+        if (rows.empty()) {
             m_downloadStatusLabel->setText("");
         } else if (m_downloaderRunning) {
             m_downloadStatusLabel->setText("- Downloading");
             m_downloadStatusLabel->setTextColor(nvgRGBA(100, 200, 100, 255));
         } else {
             bool hasFailed = false;
-            for (const auto& si : serverItems) {
-                if (si.state == static_cast<int>(DownloadState::FAILED)) { hasFailed = true; break; }
+            for (const auto& row : rows) {
+                if (row.state == DownloadState::FAILED) { hasFailed = true; break; }
             }
             if (hasFailed) {
                 m_downloadStatusLabel->setText("- Error");
@@ -498,251 +736,57 @@ void DownloadsTab::refreshServerQueue() {
         }
     }
 
-    if (serverItems.empty()) {
-        m_serverSection->setVisibility(brls::Visibility::GONE);
-        m_lastServerItems.clear();
-        m_serverRowElements.clear();
-        while (m_serverContainer->getChildren().size() > 0) {
-            m_serverContainer->removeView(m_serverContainer->getChildren()[0]);
-        }
-
-        if (m_emptyStateBox) {
-            m_emptyStateBox->setVisibility(brls::Visibility::VISIBLE);
-        }
-        return;
+    // Same items in the same order: just re-bind the rows on screen
+    bool structureChanged = rows.size() != m_localRows.size();
+    for (size_t i = 0; !structureChanged && i < rows.size(); i++) {
+        structureChanged = rows[i].itemId != m_localRows[i].itemId ||
+                           rows[i].episodeId != m_localRows[i].episodeId;
     }
 
-    // Hide empty state
-    if (m_emptyStateBox) m_emptyStateBox->setVisibility(brls::Visibility::GONE);
-    m_serverSection->setVisibility(brls::Visibility::VISIBLE);
-    m_serverEmptyLabel->setVisibility(brls::Visibility::GONE);
-    m_serverScroll->setVisibility(brls::Visibility::VISIBLE);
-
-    // Build new cache
-    std::vector<CachedServerItem> newCache;
-    for (const auto& si : serverItems) {
-        CachedServerItem cached;
-        cached.itemId = si.itemId;
-        cached.episodeId = si.episodeId;
-        cached.downloadedBytes = si.downloadedBytes;
-        cached.totalBytes = si.totalBytes;
-        cached.state = si.state;
-        newCache.push_back(cached);
-    }
-
-    // Check for in-place progress updates (same items, just progress changed)
-    bool structureChanged = (newCache.size() != m_lastServerItems.size());
-    if (!structureChanged) {
-        for (size_t i = 0; i < newCache.size(); i++) {
-            if (newCache[i].itemId != m_lastServerItems[i].itemId ||
-                newCache[i].episodeId != m_lastServerItems[i].episodeId) {
-                structureChanged = true;
-                break;
-            }
-        }
+    m_localRows = std::move(rows);
+    if (structureChanged) {
+        reloadList();
+    } else {
+        rebindVisibleRows();
     }
+}
 
-    // Update in-place if possible (no structural changes)
-    if (!structureChanged) {
-        for (size_t i = 0; i < newCache.size() && i < m_serverRowElements.size(); i++) {
-            const auto& newItem = newCache[i];
-            const auto& oldItem = m_lastServerItems[i];
-            if (newItem.downloadedBytes != oldItem.downloadedBytes ||
-                newItem.state != oldItem.state) {
-                if (m_serverRowElements[i].progressLabel) {
-                    std::string progressText;
-                    if (newItem.state == static_cast<int>(DownloadState::DOWNLOADING)) {
-                        // Show progress in MB format
-                        progressText = formatMB(newItem.downloadedBytes) + " / " + formatMB(newItem.totalBytes);
-                        m_serverRowElements[i].progressLabel->setTextColor(nvgRGBA(100, 200, 100, 255));
-                    } else if (newItem.state == static_cast<int>(DownloadState::QUEUED)) {
-                        progressText = "Queued";
-                        m_serverRowElements[i].progressLabel->setTextColor(nvgRGBA(255, 255, 255, 255));
-                    } else if (newItem.state == static_cast<int>(DownloadState::PAUSED)) {
-                        progressText = "Paused - " + formatMB(newItem.downloadedBytes) + " / " + formatMB(newItem.totalBytes);
-                        m_serverRowElements[i].progressLabel->setTextColor(nvgRGBA(200, 180, 100, 255));
-                    } else if (newItem.state == static_cast<int>(DownloadState::FAILED)) {
-                        progressText = "Failed";
-                        m_serverRowElements[i].progressLabel->setTextColor(nvgRGBA(200, 100, 100, 255));
-                    }
-                    m_serverRowElements[i].progressLabel->setText(progressText);
-
-                    // Update background color
-                    if (m_serverRowElements[i].row) {
-                        if (newItem.state == static_cast<int>(DownloadState::DOWNLOADING)) {
-                            m_serverRowElements[i].row->setBackgroundColor(nvgRGBA(30, 60, 30, 200));
-                        } else if (newItem.state == static_cast<int>(DownloadState::FAILED)) {
-                            m_serverRowElements[i].row->setBackgroundColor(nvgRGBA(60, 30, 30, 200));
-                        } else if (newItem.state == static_cast<int>(DownloadState::PAUSED)) {
-                            m_serverRowElements[i].row->setBackgroundColor(nvgRGBA(50, 50, 30, 200));
-                        } else {
-                            m_serverRowElements[i].row->setBackgroundColor(nvgRGBA(40, 40, 40, 200));
-                        }
-                    }
-                }
-            }
+void DownloadsTab::reloadList() {
+    m_rows.clear();
+    if (!m_localRows.empty()) {
+        m_rows.push_back(ListRow{ListRow::Kind::HEADER, 0, "Local Downloads"});
+        for (size_t i = 0; i < m_localRows.size(); i++) {
+            m_rows.push_back(ListRow{ListRow::Kind::LOCAL, i, ""});
         }
-        m_lastServerItems = newCache;
-        return;
     }
-
-    // Full rebuild needed
-    m_lastServerItems = newCache;
-    m_serverRowElements.clear();
-    while (m_serverContainer->getChildren().size() > 0) {
-        m_serverContainer->removeView(m_serverContainer->getChildren()[0]);
+    if (!m_serverRows.empty()) {
+        m_rows.push_back(ListRow{ListRow::Kind::HEADER, 0, "Server Downloads"});
+        for (size_t i = 0; i < m_serverRows.size(); i++) {
+            m_rows.push_back(ListRow{ListRow::Kind::SERVER, i, ""});
+        }
     }
 
-    for (const auto& si : serverItems) {
-        brls::Label* progressLabel = nullptr;
-        brls::Image* xButtonIcon = nullptr;
-        auto* row = createServerRow(si.itemId, si.episodeId, si.title, si.authorName,
-                                     si.downloadedBytes, si.totalBytes, si.state,
-                                     si.coverUrl, si.localCoverPath,
-                                     progressLabel, xButtonIcon);
-        m_serverContainer->addView(row);
-
-        ServerRowElements elem;
-        elem.row = row;
-        elem.progressLabel = progressLabel;
-        elem.xButtonIcon = xButtonIcon;
-        elem.itemId = si.itemId;
-        elem.episodeId = si.episodeId;
-        m_serverRowElements.push_back(elem);
+    bool empty = m_rows.empty();
+    m_list->setVisibility(empty ? brls::Visibility::GONE : brls::Visibility::VISIBLE);
+    if (m_emptyStateBox) {
+        m_emptyStateBox->setVisibility(empty ? brls::Visibility::VISIBLE : brls::Visibility::GONE);
     }
-
-    updateNavigationRoutes();
+    m_list->reloadData();
 }
 
-brls::Box* DownloadsTab::createServerRow(const std::string& itemId, const std::string& episodeId,
-                                          const std::string& title, const std::string& authorName,
-                                          int64_t downloadedBytes, int64_t totalBytes, int state,
-                                          const std::string& coverUrl, const std::string& localCoverPath,
-                                          brls::Label*& outProgressLabel, brls::Image*& outXButtonIcon) {
-    auto row = new brls::Box();
-    row->setAxis(brls::Axis::ROW);
-    row->setJustifyContent(brls::JustifyContent::SPACE_BETWEEN);
-    row->setAlignItems(brls::AlignItems::CENTER);
-    row->setPadding(8);
-    row->setMargins(0, 0, 8, 0);
-    row->setCornerRadius(6);
-    row->setFocusable(true);
-
-    // Background color based on state
-    if (state == static_cast<int>(DownloadState::DOWNLOADING)) {
-        row->setBackgroundColor(nvgRGBA(30, 60, 30, 200));
-    } else if (state == static_cast<int>(DownloadState::FAILED)) {
-        row->setBackgroundColor(nvgRGBA(60, 30, 30, 200));
-    } else if (state == static_cast<int>(DownloadState::PAUSED)) {
-        row->setBackgroundColor(nvgRGBA(50, 50, 30, 200));
-    } else {
-        row->setBackgroundColor(nvgRGBA(40, 40, 40, 200));
-    }
+void DownloadsTab::rebindVisibleRows(int localIndex) {
+    auto* content = dynamic_cast<brls::Box*>(m_list->getContentView());
+    if (!content) return;
 
-    // Cover image
-    auto coverImage = new brls::Image();
-    coverImage->setWidth(50);
-    coverImage->setHeight(50);
-    coverImage->setCornerRadius(4);
-    coverImage->setMargins(0, 12, 0, 0);
-    row->addView(coverImage);
-
-    if (!localCoverPath.empty()) {
-        loadLocalCoverImage(coverImage, localCoverPath);
-    } else if (!coverUrl.empty()) {
-        ImageLoader::loadAsync(coverUrl, [](brls::Image*) {}, coverImage, m_alive);
-    }
-
-    // Info column (left side, grows)
-    auto infoBox = new brls::Box();
-    infoBox->setAxis(brls::Axis::COLUMN);
-    infoBox->setGrow(1.0f);
-
-    auto titleLabel = new brls::Label();
-    titleLabel->setText(title);
-    titleLabel->setFontSize(16);
-    titleLabel->setSingleLine(true);
-    infoBox->addView(titleLabel);
-
-    if (!authorName.empty()) {
-        auto authorLabel = new brls::Label();
-        authorLabel->setText(authorName);
-        authorLabel->setFontSize(13);
-        authorLabel->setTextColor(nvgRGBA(180, 180, 180, 255));
-        authorLabel->setSingleLine(true);
-        infoBox->addView(authorLabel);
-    }
-
-    row->addView(infoBox);
-
-    // Status box (right side: progress label + square button icon)
-    auto statusBox = new brls::Box();
-    statusBox->setAxis(brls::Axis::ROW);
-    statusBox->setAlignItems(brls::AlignItems::CENTER);
-
-    // Progress label with MB format
-    auto progressLabel = new brls::Label();
-    progressLabel->setFontSize(14);
-    progressLabel->setMargins(0, 0, 0, 10);
-
-    std::string progressText;
-    if (state == static_cast<int>(DownloadState::DOWNLOADING)) {
-        progressText = formatMB(downloadedBytes) + " / " + formatMB(totalBytes);
-        progressLabel->setTextColor(nvgRGBA(100, 200, 100, 255));
-    } else if (state == static_cast<int>(DownloadState::QUEUED)) {
-        progressText = "Queued";
-    } else if (state == static_cast<int>(DownloadState::PAUSED)) {
-        progressText = "Paused - " + formatMB(downloadedBytes) + " / " + formatMB(totalBytes);
-        progressLabel->setTextColor(nvgRGBA(200, 180, 100, 255));
-    } else if (state == static_cast<int>(DownloadState::FAILED)) {
-        progressText = "Failed";
-        progressLabel->setTextColor(nvgRGBA(200, 100, 100, 255));
-    }
-    progressLabel->setText(progressText);
-    outProgressLabel = progressLabel;
-    statusBox->addView(progressLabel);
-
-    // Square button icon - only visible when row is focused
-    auto* xButtonIcon = new brls::Image();
-    xButtonIcon->setWidth(24);
-    xButtonIcon->setHeight(24);
-    xButtonIcon->setScalingType(brls::ImageScalingType::FIT);
-    xButtonIcon->setImageFromFile(RESOURCE_PREFIX "images/square_button.png");
-    xButtonIcon->setMarginLeft(8);
-    xButtonIcon->setVisibility(brls::Visibility::INVISIBLE);
-    outXButtonIcon = xButtonIcon;
-    statusBox->addView(xButtonIcon);
-
-    row->addView(statusBox);
-
-    // Show square button icon when this row gets focus
-    row->getFocusEvent()->subscribe([this, xButtonIcon](brls::View* view) {
-        // Hide previous focused icon (validate it's still a live element)
-        if (m_currentFocusedIcon && m_currentFocusedIcon != xButtonIcon) {
-            bool isValid = false;
-            for (const auto& elem : m_serverRowElements) {
-                if (elem.xButtonIcon == m_currentFocusedIcon) { isValid = true; break; }
-            }
-            if (isValid) {
-                m_currentFocusedIcon->setVisibility(brls::Visibility::INVISIBLE);
-            } else {
-                m_currentFocusedIcon = nullptr;
-            }
-        }
-        xButtonIcon->setVisibility(brls::Visibility::VISIBLE);
-        m_currentFocusedIcon = xButtonIcon;
-    });
-
-    // Square button action - cancel download
-    std::string capturedItemId = itemId;
-    row->registerAction("Cancel", brls::ControllerButton::BUTTON_X, [this, capturedItemId](brls::View*) {
-        DownloadsManager::getInstance().cancelDownload(capturedItemId);
-        brls::Application::notify("Download cancelled");
-        refresh();
-        return true;
-    });
+    for (brls::View* child : content->getChildren()) {
+        auto* cell = dynamic_cast<LocalRowCell*>(child);
+        if (!cell) continue;
 
-    return row;
+        size_t row = cell->getIndexPath().row;
+        if (row >= m_rows.size() || m_rows[row].kind != ListRow::Kind::LOCAL) continue;
+        if (localIndex >= 0 && m_rows[row].index != static_cast<size_t>(localIndex)) continue;
+        cell->bind(m_localRows[m_rows[row].index]);
+    }
 }
 
 void DownloadsTab::refreshServerDownloads() {
@@ -782,109 +826,38 @@ void DownloadsTab::refreshServerDownloads() {
             auto alive = aliveWeak.lock();
             if (!alive || !*alive) return;
 
-            // Clear existing rows
-            while (m_absContainer->getChildren().size() > 0) {
-                m_absContainer->removeView(m_absContainer->getChildren()[0]);
-            }
-
-            if (allDownloads.empty()) {
-                m_absSection->setVisibility(brls::Visibility::GONE);
-                return;
-            }
-
-            m_absSection->setVisibility(brls::Visibility::VISIBLE);
-            m_absEmptyLabel->setVisibility(brls::Visibility::GONE);
-
-            for (size_t i = 0; i < allDownloads.size(); i++) {
-                const auto& dl = allDownloads[i];
-
-                auto* row = new brls::Box();
-                row->setAxis(brls::Axis::ROW);
-                row->setAlignItems(brls::AlignItems::CENTER);
-                row->setPadding(8);
-                row->setMargins(0, 0, 6, 0);
-                row->setBackgroundColor(nvgRGBA(40, 40, 40, 200));
-                row->setCornerRadius(6);
-
-                auto* infoBox = new brls::Box();
-                infoBox->setAxis(brls::Axis::COLUMN);
-                infoBox->setGrow(1.0f);
-
-                auto* titleLabel = new brls::Label();
-                titleLabel->setText(dl.episodeTitle);
-                titleLabel->setFontSize(15);
-                titleLabel->setSingleLine(true);
-                infoBox->addView(titleLabel);
-
-                auto* podcastLabel = new brls::Label();
-                podcastLabel->setText(dl.podcastTitle);
-                podcastLabel->setFontSize(13);
-                podcastLabel->setTextColor(nvgRGBA(180, 180, 180, 255));
-                podcastLabel->setSingleLine(true);
-                infoBox->addView(podcastLabel);
-
-                row->addView(infoBox);
-
-                auto* statusLabel = new brls::Label();
-                statusLabel->setFontSize(13);
-                if (i == 0 && !dl.failed) {
-                    statusLabel->setText("Downloading");
-                    statusLabel->setTextColor(nvgRGBA(100, 200, 100, 255));
-                } else if (dl.failed) {
-                    statusLabel->setText("Failed");
-                    statusLabel->setTextColor(nvgRGBA(200, 100, 100, 255));
-                } else {
-                    statusLabel->setText("Queued");
-                    statusLabel->setTextColor(nvgRGBA(180, 180, 180, 255));
-                }
-                row->addView(statusLabel);
-
-                m_absContainer->addView(row);
-            }
+            m_serverRows = allDownloads;
+            reloadList();
         });
     });
 }
 
-void DownloadsTab::startAutoRefresh() {
-    if (m_autoRefreshTimerActive.load()) return;
-    m_autoRefreshEnabled.store(true);
-    m_autoRefreshTimerActive.store(true);
-
-    std::weak_ptr<bool> aliveWeak = m_alive;
-
-    asyncRun([this, aliveWeak]() {
-        while (m_autoRefreshEnabled.load()) {
-            auto alive = aliveWeak.lock();
-            if (!alive || !*alive) break;
-
-            int totalItems = static_cast<int>(m_lastServerItems.size());
-            int interval = (totalItems > LARGE_QUEUE_THRESHOLD) ?
-                           AUTO_REFRESH_INTERVAL_LARGE_MS : AUTO_REFRESH_INTERVAL_MS;
-
-            std::this_thread::sleep_for(std::chrono::milliseconds(interval));
-
-            alive = aliveWeak.lock();
-            if (!alive || !*alive) break;
-            if (!m_autoRefreshEnabled.load()) break;
-
-            brls::sync([this, aliveWeak]() {
-                auto alive = aliveWeak.lock();
-                if (!alive || !*alive) return;
-                if (m_autoRefreshEnabled.load()) {
-                    refresh();
-                }
-            });
+void DownloadsTab::onDownloadEvents(const std::vector<DownloadEvent>& events) {
+    bool needsRefresh = false;
+    for (const auto& event : events) {
+        if (event.type != DownloadEventType::PROGRESS) {
+            needsRefresh = true;
+            continue;
         }
-        m_autoRefreshTimerActive.store(false);
-    });
-}
 
-void DownloadsTab::stopAutoRefresh() {
-    m_autoRefreshEnabled.store(false);
-}
+        // Progress only re-binds the row showing that download, if it's on screen
+        bool found = false;
+        for (size_t i = 0; i < m_localRows.size(); i++) {
+            LocalRow& row = m_localRows[i];
+            if (row.itemId != event.itemId || row.episodeId != event.episodeId) continue;
+            row.downloadedBytes = event.downloadedBytes;
+            row.totalBytes = event.totalBytes;
+            row.state = event.state;
+            rebindVisibleRows(static_cast<int>(i));
+            found = true;
+            break;
+        }
+        if (!found) needsRefresh = true;
+    }
 
-void DownloadsTab::updateNavigationRoutes() {
-    // Let borealis handle default navigation between focusable items
+    if (needsRefresh) {
+        refresh();
+    }
 }
 
 } // namespace vitaabs
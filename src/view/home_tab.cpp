@@ -6,6 +6,8 @@
 #include "view/media_detail_view.hpp"
 #include "view/media_item_cell.hpp"
 #include "app/application.hpp"
+#include "app/content_snapshot.hpp"
+#include "app/search_index.hpp"
 #include "utils/async.hpp"
 
 namespace vitaabs {
@@ -124,6 +126,20 @@ void HomeTab::loadContent() {
 
     brls::Logger::debug("HomeTab: Loading content");
 
+    // Show the last successful shelves right away, then revalidate in the background
+    if (!m_snapshotShown) {
+        m_snapshotShown = true;
+        std::vector<MediaItemSummary> cachedContinue;
+        std::vector<MediaItemSummary> cachedRecent;
+        if (ContentSnapshot::getInstance().loadHome(cachedContinue, cachedRecent)) {
+            brls::Logger::info("HomeTab: Showing snapshot ({} continue, {} recent)",
+                              cachedContinue.size(), cachedRecent.size());
+            // Cached shelves never replace entities other tabs already hold
+            ItemStore& store = ItemStore::getInstance();
+            displayContent(store.internAll(cachedContinue), store.internAll(cachedRecent));
+        }
+    }
+
     std::weak_ptr<bool> aliveWeak = m_alive;
 
     asyncRun([this, aliveWeak]() {
@@ -134,16 +150,19 @@ void HomeTab::loadContent() {
 
         // Get Continue Listening items using the direct API endpoint
         brls::Logger::info("HomeTab: Fetching items in progress...");
+        bool fetched = true;
         if (client.fetchItemsInProgress(continueItems)) {
             brls::Logger::info("HomeTab: Got {} items in progress", continueItems.size());
         } else {
             brls::Logger::error("HomeTab: Failed to fetch items in progress");
+            fetched = false;
         }
 
         // Get all libraries to fetch recent episodes from podcast libraries
         std::vector<Library> libraries;
         if (!client.fetchLibraries(libraries)) {
             brls::Logger::error("HomeTab: Failed to fetch libraries");
+            fetched = false;
         } else {
             // Fetch recently added from podcast libraries for Recent Episodes
             for (const auto& lib : libraries) {
@@ -174,6 +193,8 @@ void HomeTab::loadContent() {
                         }
                     } else {
                         brls::Logger::error("HomeTab: Failed to fetch personalized content for library '{}'", lib.name);
+                        // Saving now would drop this library's episodes from the snapshot
+                        fetched = false;
                     }
                 }
             }
@@ -182,49 +203,99 @@ void HomeTab::loadContent() {
         brls::Logger::info("HomeTab: Found {} continue items, {} recent episodes",
                           continueItems.size(), recentEpisodes.size());
 
+        SearchIndex::getInstance().indexItems(continueItems);
+        SearchIndex::getInstance().indexItems(recentEpisodes);
+
+        // The shelves only need what a cell shows; drop the full items here
+        std::vector<MediaItemSummary> continueSummaries = MediaItemSummary::fromItems(continueItems);
+        std::vector<MediaItemSummary> recentSummaries = MediaItemSummary::fromItems(recentEpisodes);
+
+        // Only a complete answer replaces the snapshot; offline keeps the stale shelves
+        if (fetched) {
+            ContentSnapshot::getInstance().saveHome(continueSummaries, recentSummaries);
+        }
+
         // Update UI on main thread
-        brls::sync([this, continueItems, recentEpisodes, aliveWeak]() {
+        brls::sync([this, continueSummaries, recentSummaries, fetched, aliveWeak]() {
             auto alive = aliveWeak.lock();
             if (!alive || !*alive) return;
 
-            m_continueItems = continueItems;
-            m_recentEpisodes = recentEpisodes;
             m_loaded = true;
-
-            // Show Continue Listening section if we have items
-            if (!m_continueItems.empty()) {
-                m_continueLabel->setVisibility(brls::Visibility::VISIBLE);
-                m_continueScroll->setVisibility(brls::Visibility::VISIBLE);
-                populateHorizontalRow(m_continueBox, m_continueItems);
-            }
-
-            // Show Recently Added Episodes section if we have items
-            if (!m_recentEpisodes.empty()) {
-                m_recentEpisodesLabel->setVisibility(brls::Visibility::VISIBLE);
-                m_recentEpisodesScroll->setVisibility(brls::Visibility::VISIBLE);
-
-                // Apply max episodes limit from settings
-                int maxEpisodes = Application::getInstance().getSettings().maxRecentEpisodes;
-                std::vector<MediaItem> limitedEpisodes = m_recentEpisodes;
-                if (maxEpisodes > 0 && limitedEpisodes.size() > static_cast<size_t>(maxEpisodes)) {
-                    limitedEpisodes.resize(maxEpisodes);
-                }
-                populateHorizontalRow(m_recentEpisodesBox, limitedEpisodes);
-            }
-
-            // Show message if nothing to display
-            if (m_continueItems.empty() && m_recentEpisodes.empty()) {
-                m_titleLabel->setText("Home - No items in progress");
+            if (!fetched && (!m_continueItems.empty() || !m_recentEpisodes.empty())) {
+                brls::Logger::info("HomeTab: Revalidation failed, keeping snapshot content");
+                return;
             }
 
+            ItemStore& store = ItemStore::getInstance();
+            displayContent(store.putAll(continueSummaries), store.putAll(recentSummaries));
             brls::Logger::debug("HomeTab: Content loaded and displayed");
         });
     });
 }
 
-void HomeTab::populateHorizontalRow(brls::Box* container, const std::vector<MediaItem>& items) {
+void HomeTab::displayContent(const std::vector<ItemRef>& continueItems,
+                             const std::vector<ItemRef>& recentEpisodes) {
+    m_continueItems = continueItems;
+    m_recentEpisodes = recentEpisodes;
+
+    // Show Continue Listening section if we have items
+    bool hasContinue = !m_continueItems.empty();
+    m_continueLabel->setVisibility(hasContinue ? brls::Visibility::VISIBLE : brls::Visibility::GONE);
+    m_continueScroll->setVisibility(hasContinue ? brls::Visibility::VISIBLE : brls::Visibility::GONE);
+    populateHorizontalRow(m_continueBox, m_continueItems);
+
+    // Show Recently Added Episodes section if we have items
+    bool hasRecent = !m_recentEpisodes.empty();
+    m_recentEpisodesLabel->setVisibility(hasRecent ? brls::Visibility::VISIBLE : brls::Visibility::GONE);
+    m_recentEpisodesScroll->setVisibility(hasRecent ? brls::Visibility::VISIBLE : brls::Visibility::GONE);
+
+    // Apply max episodes limit from settings
+    int maxEpisodes = Application::getInstance().getSettings().maxRecentEpisodes;
+    std::vector<ItemRef> limitedEpisodes = m_recentEpisodes;
+    if (maxEpisodes > 0 && limitedEpisodes.size() > static_cast<size_t>(maxEpisodes)) {
+        limitedEpisodes.resize(maxEpisodes);
+    }
+    populateHorizontalRow(m_recentEpisodesBox, limitedEpisodes);
+
+    // Show message if nothing to display
+    if (m_continueItems.empty() && m_recentEpisodes.empty()) {
+        m_titleLabel->setText("Home - No items in progress");
+    } else {
+        m_titleLabel->setText("Home");
+    }
+}
+
+void HomeTab::populateHorizontalRow(brls::Box* container, const std::vector<ItemRef>& items) {
     if (!container) return;
 
+    // Same items in the same order: re-bind only the cells whose content changed
+    // (keeps focus and loaded covers when a snapshot is revalidated)
+    auto& children = container->getChildren();
+    if (!items.empty() && children.size() == items.size()) {
+        bool sameOrder = true;
+        for (size_t i = 0; i < items.size(); i++) {
+            auto* cell = dynamic_cast<MediaItemCell*>(children[i]);
+            if (!cell || cell->getItem().id != items[i]->id ||
+                cell->getItem().episodeId != items[i]->episodeId) {
+                sameOrder = false;
+                break;
+            }
+        }
+
+        if (sameOrder) {
+            int patched = 0;
+            for (size_t i = 0; i < items.size(); i++) {
+                auto* cell = static_cast<MediaItemCell*>(children[i]);
+                if (cell->getItemRef() != items[i]) {
+                    cell->setItem(items[i]);
+                    patched++;
+                }
+            }
+            brls::Logger::debug("HomeTab: Patched {} of {} cells", patched, items.size());
+            return;
+        }
+    }
+
     // Clear existing items
     container->clearViews();
 
@@ -240,10 +311,9 @@ void HomeTab::populateHorizontalRow(brls::Box* container, const std::vector<Medi
         cell->setHeight(195);  // Square cover (140) + labels (~55)
         cell->setMarginRight(20);  // More space between items
 
-        // Store the item for click handler
-        MediaItem itemCopy = items[i];
-        cell->registerClickAction([this, itemCopy](brls::View* view) {
-            onItemSelected(itemCopy);
+        // Read the item from the cell so patched cells open their current data
+        cell->registerClickAction([this, cell](brls::View* view) {
+            onItemSelected(cell->getItem());
             return true;
         });
         cell->addGestureRecognizer(new brls::TapGestureRecognizer(cell));
@@ -254,7 +324,7 @@ void HomeTab::populateHorizontalRow(brls::Box* container, const std::vector<Medi
     brls::Logger::debug("HomeTab: Populated horizontal row with {} items, width={}", items.size(), totalWidth);
 }
 
-void HomeTab::onItemSelected(const MediaItem& item) {
+void HomeTab::onItemSelected(const MediaItemSummary& item) {
     brls::Logger::debug("HomeTab: Selected item: {} (type={})", item.title, item.type);
 
     // For podcast episodes, start playback directly
@@ -263,8 +333,8 @@ void HomeTab::onItemSelected(const MediaItem& item) {
         return;
     }
 
-    // For books and other items, show detail view
-    auto* detailView = new MediaDetailView(item);
+    // For books and other items, show detail view (it fetches full details)
+    auto* detailView = new MediaDetailView(item.toItem());
     brls::Application::pushActivity(new brls::Activity(detailView));
 }
 
@@ -8,10 +8,20 @@
 #include "view/media_item_cell.hpp"
 #include "view/media_detail_view.hpp"
 #include "app/application.hpp"
+#include "app/content_snapshot.hpp"
+#include "app/search_index.hpp"
+#include "app/metadata_store.hpp"
 #include "utils/async.hpp"
+#include <algorithm>
 
 namespace vitaabs {
 
+// The grid shows one page in the server's title order. Only the server can
+// sort (it ignores title prefixes and collates), so the order is never
+// rebuilt locally; the snapshot is the same page from the last visit.
+static const char* LIBRARY_SORT = "media.metadata.title";
+static const int LIBRARY_PAGE_SIZE = 50;
+
 LibrarySectionTab::LibrarySectionTab(const std::string& sectionKey, const std::string& title, const std::string& sectionType)
     : m_sectionKey(sectionKey), m_title(title), m_sectionType(sectionType) {
 
@@ -162,7 +172,7 @@ LibrarySectionTab::LibrarySectionTab(const std::string& sectionKey, const std::s
     // Content grid
     m_contentGrid = new RecyclingGrid();
     m_contentGrid->setGrow(1.0f);
-    m_contentGrid->setOnItemSelected([this](const MediaItem& item) {
+    m_contentGrid->setOnItemSelected([this](const MediaItemSummary& item) {
         onItemSelected(item);
     });
     this->addView(m_contentGrid);
@@ -195,14 +205,40 @@ void LibrarySectionTab::loadContent() {
     std::string key = m_sectionKey;
     std::weak_ptr<bool> aliveWeak = m_alive;  // Capture weak_ptr for async safety
 
+    // Render the last successful page immediately; the fetch below revalidates it
+    if (!m_snapshotShown) {
+        m_snapshotShown = true;
+        std::vector<MediaItemSummary> cached;
+        if (ContentSnapshot::getInstance().loadLibrary(key, cached)) {
+            brls::Logger::info("LibraryTab: Showing snapshot with {} items for section {}", cached.size(), key);
+            m_items = ItemStore::getInstance().internAll(cached);
+            asyncRun([cached]() { SearchIndex::getInstance().indexItems(cached); });
+            if (m_viewMode == LibraryViewMode::ALL_ITEMS) {
+                m_contentGrid->setDataSource(m_items);
+            }
+        }
+    }
+
     asyncRun([this, key, aliveWeak]() {
         AudiobookshelfClient& client = AudiobookshelfClient::getInstance();
-        std::vector<MediaItem> items;
+        MetadataStore& store = MetadataStore::getInstance();
+
+        // The stored library makes every item searchable before the page arrives
+        std::vector<MediaItem> storedItems;
+        bool haveStore = store.loadLibrary(key, storedItems);
+        if (haveStore) {
+            brls::Logger::info("LibraryTab: Loaded {} stored items for section {}", storedItems.size(), key);
+            SearchIndex::getInstance().indexItems(storedItems);
+        }
 
-        if (client.fetchLibraryItems(key, items)) {
-            brls::Logger::info("LibraryTab: Got {} items for section {}", items.size(), key);
+        // The grid only needs summaries; full items are fetched when a detail view opens
+        std::vector<MediaItemSummary> summaries;
+        if (client.fetchLibraryItems(key, summaries, 0, LIBRARY_PAGE_SIZE, LIBRARY_SORT)) {
+            brls::Logger::info("LibraryTab: Got {} items for section {}", summaries.size(), key);
+            SearchIndex::getInstance().indexItems(summaries);
+            ContentSnapshot::getInstance().saveLibrary(key, summaries);
 
-            brls::sync([this, items, aliveWeak]() {
+            brls::sync([this, summaries, aliveWeak]() {
                 // Check if object is still alive before updating UI
                 auto alive = aliveWeak.lock();
                 if (!alive || !*alive) {
@@ -210,20 +246,46 @@ void LibrarySectionTab::loadContent() {
                     return;
                 }
 
-                m_items = items;
-                // Only update grid if we're in ALL_ITEMS mode
+                m_items = ItemStore::getInstance().putAll(summaries);
+                // Only update grid if we're in ALL_ITEMS mode (patches cells shown from the snapshot)
                 if (m_viewMode == LibraryViewMode::ALL_ITEMS) {
-                    m_contentGrid->setDataSource(m_items);
+                    m_contentGrid->updateDataSource(m_items);
                 }
                 m_loaded = true;
             });
+
+            // Then bring the full local copy of the library up to date (only changed
+            // items are fetched) so the whole library is searchable offline
+            int changed = 0;
+            if (store.syncLibrary(key, &changed) && (changed > 0 || !haveStore)) {
+                storedItems.clear();
+                if (store.loadLibrary(key, storedItems)) {
+                    SearchIndex::getInstance().indexItems(storedItems);
+                }
+            }
         } else {
             brls::Logger::error("LibraryTab: Failed to load content for section {}", key);
-            brls::sync([this, aliveWeak]() {
+
+            // Without a snapshot, show a page of the stored library instead. The
+            // server's order is unknown offline, so this page is in id order.
+            std::vector<MediaItemSummary> stored;
+            size_t count = std::min(storedItems.size(), (size_t)LIBRARY_PAGE_SIZE);
+            for (size_t i = 0; i < count; i++) {
+                stored.push_back(MediaItemSummary::fromItem(storedItems[i]));
+            }
+
+            brls::sync([this, stored, aliveWeak]() {
                 auto alive = aliveWeak.lock();
                 if (!alive || !*alive) return;
 
-                // Offline - show empty state with offline label
+                if (m_items.empty() && !stored.empty()) {
+                    m_items = ItemStore::getInstance().internAll(stored);
+                    if (m_viewMode == LibraryViewMode::ALL_ITEMS) {
+                        m_contentGrid->setDataSource(m_items);
+                    }
+                }
+
+                // Offline - keep any snapshot items and mark the title
                 if (m_title.find("(Offline)") == std::string::npos) {
                     m_titleLabel->setText(m_title + " (Offline)");
                 }
@@ -251,13 +313,13 @@ void LibrarySectionTab::loadCollections() {
         if (client.fetchLibraryCollections(key, collections)) {
             brls::Logger::info("LibrarySectionTab: Got {} collections for section {}", collections.size(), key);
 
-            // Convert Collection to MediaItem for display
-            std::vector<MediaItem> collectionItems;
+            // Convert Collection to MediaItemSummary for display
+            std::vector<MediaItemSummary> collectionItems;
             for (const auto& col : collections) {
-                MediaItem item;
+                MediaItemSummary item;
                 item.id = col.id;
                 item.title = col.name;
-                item.description = col.description;
+                item.blurb = col.description;
                 item.coverPath = col.coverPath;
                 item.type = "collection";
                 item.mediaType = MediaType::UNKNOWN;
@@ -345,10 +407,10 @@ void LibrarySectionTab::showCategories() {
     m_viewMode = LibraryViewMode::CATEGORIES;
     m_titleLabel->setText(m_title + " - Categories");
 
-    // Convert genres to MediaItem format for the grid
-    std::vector<MediaItem> genreItems;
+    // Convert genres to grid entries
+    std::vector<MediaItemSummary> genreItems;
     for (const auto& genre : m_genres) {
-        MediaItem item;
+        MediaItemSummary item;
         item.title = genre.title;
         item.id = genre.id;  // Use genre key for filtering
         item.type = "genre";
@@ -400,7 +462,7 @@ void LibrarySectionTab::hideNavigationButtons() {
     }
 }
 
-void LibrarySectionTab::onItemSelected(const MediaItem& item) {
+void LibrarySectionTab::onItemSelected(const MediaItemSummary& item) {
     brls::Logger::debug("LibrarySectionTab::onItemSelected - title='{}' id='{}' type='{}' viewMode={}",
                        item.title, item.id, item.type, static_cast<int>(m_viewMode));
 
@@ -432,13 +494,13 @@ void LibrarySectionTab::onItemSelected(const MediaItem& item) {
 
     // Show media detail view for books and other types
     brls::Logger::info("LibrarySectionTab: Opening detail view for '{}'", item.title);
-    auto* detailView = new MediaDetailView(item);
+    auto* detailView = new MediaDetailView(item.toItem());
     brls::Logger::debug("LibrarySectionTab: MediaDetailView created, pushing activity");
     brls::Application::pushActivity(new brls::Activity(detailView));
     brls::Logger::debug("LibrarySectionTab: Activity pushed successfully");
 }
 
-void LibrarySectionTab::onCollectionSelected(const MediaItem& collection) {
+void LibrarySectionTab::onCollectionSelected(const MediaItemSummary& collection) {
     brls::Logger::debug("LibrarySectionTab: Selected collection: {}", collection.title);
 
     m_filterTitle = collection.title;
@@ -448,7 +510,7 @@ void LibrarySectionTab::onCollectionSelected(const MediaItem& collection) {
 
     asyncRun([this, collectionId, filterTitle, aliveWeak]() {
         AudiobookshelfClient& client = AudiobookshelfClient::getInstance();
-        std::vector<MediaItem> items;
+        std::vector<MediaItemSummary> items;
 
         if (client.fetchCollectionBooks(collectionId, items)) {
             brls::Logger::info("LibrarySectionTab: Got {} items in collection", items.size());
@@ -540,19 +602,20 @@ void LibrarySectionTab::checkAllNewEpisodes() {
 
     std::weak_ptr<bool> aliveWeak = m_alive;
     std::string libraryKey = m_sectionKey;
+    std::vector<ItemRef> items = m_items;  // Handles are cheap; the worker mustn't read m_items
 
-    asyncRun([this, libraryKey, aliveWeak]() {
+    asyncRun([this, libraryKey, items, aliveWeak]() {
         AudiobookshelfClient& client = AudiobookshelfClient::getInstance();
 
         int totalNew = 0;
-        for (const auto& item : m_items) {
-            if (item.type == "podcast" || item.mediaType == MediaType::PODCAST) {
+        for (const auto& item : items) {
+            if (item->type == "podcast" || item->mediaType == MediaType::PODCAST) {
                 std::vector<MediaItem> newEps;
-                if (client.checkNewEpisodes(item.id, newEps)) {
+                if (client.checkNewEpisodes(item->id, newEps)) {
                     if (!newEps.empty()) {
                         totalNew += newEps.size();
                         // Auto-download new episodes
-                        client.downloadAllNewEpisodes(item.id);
+                        client.downloadAllNewEpisodes(item->id);
                     }
                 }
             }
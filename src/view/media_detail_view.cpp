@@ -8,6 +8,9 @@
 #include "view/progress_dialog.hpp"
 #include "app/application.hpp"
 #include "app/downloads_manager.hpp"
+#include "app/search_index.hpp"
+#include "app/metadata_store.hpp"
+#include "app/item_store.hpp"
 #include "utils/image_loader.hpp"
 #include "utils/http_client.hpp"
 #include "utils/audio_utils.hpp"
@@ -25,28 +28,308 @@
 
 namespace {
 
-// Box subclass that shows/hides a square button hint on focus
-class FocusHintBox : public brls::Box {
+// Recycler row height of episodes and chapters (56 + 4 spacing)
+const float LIST_ROW_HEIGHT = 60.0f;
+
+// Episodes parsed per page while a podcast loads (about two screens)
+const size_t EPISODE_PAGE_SIZE = 20;
+
+std::string formatChapterTime(float seconds) {
+    int totalSec = static_cast<int>(seconds);
+    int hours = totalSec / 3600;
+    int mins = (totalSec % 3600) / 60;
+    int secs = totalSec % 60;
+
+    char buf[32];
+    if (hours > 0) {
+        snprintf(buf, sizeof(buf), "%d:%02d:%02d", hours, mins, secs);
+    } else {
+        snprintf(buf, sizeof(buf), "%d:%02d", mins, secs);
+    }
+    return std::string(buf);
+}
+
+std::string formatEpisodeDuration(float seconds) {
+    int totalSec = static_cast<int>(seconds);
+    int hours = totalSec / 3600;
+    int mins = (totalSec % 3600) / 60;
+    if (hours > 0) {
+        return std::to_string(hours) + "h " + std::to_string(mins) + "m";
+    }
+    return std::to_string(mins) + " min";
+}
+
+std::string truncateTitle(std::string title) {
+    if (title.length() > 45) {
+        title = title.substr(0, 42) + "...";
+    }
+    return title;
+}
+
+// Square button hint shown at the left of a row while it has focus
+brls::Image* createSquareHint() {
+    auto* squareHint = new brls::Image();
+    squareHint->setSize(brls::Size(16, 16));
+    squareHint->setScalingType(brls::ImageScalingType::FIT);
+    squareHint->setImageFromFile(RESOURCE_PREFIX "images/square_button.png");
+    squareHint->setMarginRight(8);
+    squareHint->setVisibility(brls::Visibility::GONE);
+    return squareHint;
+}
+
+} // anonymous namespace
+
+namespace vitaabs {
+
+// Podcast episode: title, duration and a download toggle button
+class MediaDetailView::EpisodeCell : public brls::RecyclerCell {
 public:
-    void setHintImage(brls::Image* hint) { m_hint = hint; }
+    explicit EpisodeCell(MediaDetailView* view) : m_view(view) {
+        // The recycler stacks cells edge to edge - the padding spaces the rows
+        this->setPaddingBottom(4);
+
+        m_row = new brls::Box();
+        m_row->setAxis(brls::Axis::ROW);
+        m_row->setAlignItems(brls::AlignItems::CENTER);
+        m_row->setGrow(1.0f);
+        m_row->setPadding(10, 14, 10, 14);
+        m_row->setCornerRadius(8);
+        m_row->setBackgroundColor(nvgRGBA(40, 40, 40, 255));
+        this->addView(m_row);
+
+        m_squareHint = createSquareHint();
+        m_row->addView(m_squareHint);
+
+        // Left side: title + duration
+        auto* textBox = new brls::Box();
+        textBox->setAxis(brls::Axis::COLUMN);
+        textBox->setGrow(1.0f);
+
+        m_title = new brls::Label();
+        m_title->setFontSize(14);
+        textBox->addView(m_title);
+
+        m_duration = new brls::Label();
+        m_duration->setFontSize(11);
+        m_duration->setTextColor(nvgRGB(150, 150, 150));
+        textBox->addView(m_duration);
+
+        m_row->addView(textBox);
+
+        // Right side: download status button
+        m_dlBtn = new brls::Button();
+        m_dlBtn->setWidth(55);
+        m_dlBtn->setHeight(36);
+        m_dlBtn->setCornerRadius(18);
+        m_dlBtn->setJustifyContent(brls::JustifyContent::CENTER);
+        m_dlBtn->setAlignItems(brls::AlignItems::CENTER);
+
+        m_dlIcon = new brls::Image();
+        m_dlIcon->setWidth(20);
+        m_dlIcon->setHeight(20);
+        m_dlIcon->setScalingType(brls::ImageScalingType::FIT);
+        m_dlBtn->addView(m_dlIcon);
+        m_row->addView(m_dlBtn);
+
+        // Click and X button: toggle download queue state (like Suwayomi)
+        m_dlBtn->registerClickAction([this](brls::View*) {
+            m_view->toggleEpisodeDownload(m_index);
+            return true;
+        });
+        this->registerAction("Download", brls::ControllerButton::BUTTON_X, [this](brls::View*) {
+            m_view->toggleEpisodeDownload(m_index);
+            return true;
+        }, false, false, brls::Sound::SOUND_CLICK);
+
+        this->registerClickAction([this](brls::View*) {
+            m_view->playEpisode(m_index);
+            return true;
+        });
+    }
+
+    void bind(size_t index) {
+        m_index = index;
+        const MediaItem& child = m_view->m_children[index];
+
+        m_title->setText(truncateTitle(child.title));
+        if (child.duration > 0) {
+            m_duration->setText(formatEpisodeDuration(child.duration));
+            m_duration->setVisibility(brls::Visibility::VISIBLE);
+        } else {
+            m_duration->setVisibility(brls::Visibility::GONE);
+        }
+
+        // Completed, queued/downloading, or not queued
+        const DownloadState* state = m_view->episodeDownload(child);
+        bool downloaded = state && *state == DownloadState::COMPLETED;
+        bool pending = state && (*state == DownloadState::QUEUED || *state == DownloadState::DOWNLOADING);
+        if (downloaded) {
+            m_dlBtn->setBackgroundColor(nvgRGBA(46, 204, 113, 200));
+        } else if (pending) {
+            m_dlBtn->setBackgroundColor(nvgRGBA(200, 180, 60, 200));  // Yellow for queued/downloading
+        } else {
+            m_dlBtn->setBackgroundColor(nvgRGBA(60, 60, 60, 200));
+        }
+
+        // Icons are decoded from file - only swap them when they change
+        int icon = downloaded ? 1 : 0;
+        if (icon != m_icon) {
+            m_icon = icon;
+            m_dlIcon->setImageFromFile(downloaded ? RESOURCE_PREFIX "icons/checkbox_checked.png"
+                                                  : RESOURCE_PREFIX "icons/download.png");
+        }
+    }
 
     void onFocusGained() override {
-        brls::Box::onFocusGained();
-        if (m_hint) m_hint->setVisibility(brls::Visibility::VISIBLE);
+        brls::RecyclerCell::onFocusGained();
+        m_squareHint->setVisibility(brls::Visibility::VISIBLE);
     }
 
     void onFocusLost() override {
-        brls::Box::onFocusLost();
-        if (m_hint) m_hint->setVisibility(brls::Visibility::GONE);
+        brls::RecyclerCell::onFocusLost();
+        m_squareHint->setVisibility(brls::Visibility::GONE);
     }
 
 private:
-    brls::Image* m_hint = nullptr;
+    MediaDetailView* m_view;
+    size_t m_index = 0;
+    int m_icon = -1;
+
+    brls::Box* m_row = nullptr;
+    brls::Image* m_squareHint = nullptr;
+    brls::Label* m_title = nullptr;
+    brls::Label* m_duration = nullptr;
+    brls::Button* m_dlBtn = nullptr;
+    brls::Image* m_dlIcon = nullptr;
 };
 
-} // anonymous namespace
+// Audiobook chapter: title and time; the current chapter is highlighted
+class MediaDetailView::ChapterCell : public brls::RecyclerCell {
+public:
+    explicit ChapterCell(MediaDetailView* view) : m_view(view) {
+        this->setPaddingBottom(4);
 
-namespace vitaabs {
+        m_row = new brls::Box();
+        m_row->setAxis(brls::Axis::ROW);
+        m_row->setAlignItems(brls::AlignItems::CENTER);
+        m_row->setGrow(1.0f);
+        m_row->setPadding(10, 14, 10, 14);
+        m_row->setCornerRadius(8);
+        this->addView(m_row);
+
+        m_squareHint = createSquareHint();
+        m_row->addView(m_squareHint);
+
+        // Left side: title + time (grows)
+        auto* textBox = new brls::Box();
+        textBox->setAxis(brls::Axis::COLUMN);
+        textBox->setGrow(1.0f);
+
+        m_title = new brls::Label();
+        m_title->setFontSize(14);
+        textBox->addView(m_title);
+
+        m_time = new brls::Label();
+        m_time->setFontSize(11);
+        m_time->setTextColor(nvgRGB(150, 150, 150));
+        textBox->addView(m_time);
+
+        m_row->addView(textBox);
+
+        // Click to play from chapter
+        this->registerClickAction([this](brls::View*) {
+            const Chapter& chapter = m_view->m_item.chapters[m_index];
+            m_view->startDownloadAndPlay(m_view->m_item.id, "", chapter.start);
+            return true;
+        });
+    }
+
+    void bind(size_t index) {
+        m_index = index;
+        const Chapter& chapter = m_view->m_item.chapters[index];
+
+        std::string title = chapter.title;
+        if (title.empty()) {
+            title = "Chapter " + std::to_string(index + 1);
+        }
+        m_title->setText(truncateTitle(title));
+        m_time->setText(formatChapterTime(chapter.start) + " - " + formatChapterTime(chapter.end - chapter.start));
+
+        // Highlight current chapter
+        float currentTime = m_view->m_item.currentTime;
+        bool isCurrentChapter = (currentTime >= chapter.start && currentTime < chapter.end);
+        if (isCurrentChapter) {
+            m_row->setBackgroundColor(nvgRGBA(0, 128, 128, 200));
+            m_title->setTextColor(nvgRGB(255, 255, 255));
+        } else {
+            m_row->setBackgroundColor(nvgRGBA(40, 40, 40, 255));
+            m_title->setTextColor(nvgRGB(220, 220, 220));
+        }
+    }
+
+    void onFocusGained() override {
+        brls::RecyclerCell::onFocusGained();
+        m_squareHint->setVisibility(brls::Visibility::VISIBLE);
+    }
+
+    void onFocusLost() override {
+        brls::RecyclerCell::onFocusLost();
+        m_squareHint->setVisibility(brls::Visibility::GONE);
+    }
+
+private:
+    MediaDetailView* m_view;
+    size_t m_index = 0;
+
+    brls::Box* m_row = nullptr;
+    brls::Image* m_squareHint = nullptr;
+    brls::Label* m_title = nullptr;
+    brls::Label* m_time = nullptr;
+};
+
+class MediaDetailView::EpisodeSource : public brls::RecyclerDataSource {
+public:
+    explicit EpisodeSource(MediaDetailView* view) : m_view(view) {}
+
+    int numberOfRows(brls::RecyclerFrame*, int) override {
+        return static_cast<int>(m_view->m_episodeOrder.size());
+    }
+
+    float heightForRow(brls::RecyclerFrame*, brls::IndexPath) override {
+        return LIST_ROW_HEIGHT;
+    }
+
+    brls::RecyclerCell* cellForRow(brls::RecyclerFrame* recycler, brls::IndexPath index) override {
+        auto* cell = static_cast<EpisodeCell*>(recycler->dequeueReusableCell("Episode"));
+        cell->bind(m_view->m_episodeOrder[index.row]);
+        return cell;
+    }
+
+private:
+    MediaDetailView* m_view;
+};
+
+class MediaDetailView::ChapterSource : public brls::RecyclerDataSource {
+public:
+    explicit ChapterSource(MediaDetailView* view) : m_view(view) {}
+
+    int numberOfRows(brls::RecyclerFrame*, int) override {
+        return static_cast<int>(m_view->m_item.chapters.size());
+    }
+
+    float heightForRow(brls::RecyclerFrame*, brls::IndexPath) override {
+        return LIST_ROW_HEIGHT;
+    }
+
+    brls::RecyclerCell* cellForRow(brls::RecyclerFrame* recycler, brls::IndexPath index) override {
+        auto* cell = static_cast<ChapterCell*>(recycler->dequeueReusableCell("Chapter"));
+        cell->bind(index.row);
+        return cell;
+    }
+
+private:
+    MediaDetailView* m_view;
+};
 
 MediaDetailView::MediaDetailView(const MediaItem& item)
     : m_item(item), m_alive(std::make_shared<bool>(true)) {
@@ -417,15 +700,13 @@ MediaDetailView::MediaDetailView(const MediaItem& item)
 
         rightPanel->addView(episodesHeader);
 
-        // Scrollable vertical episodes list
-        m_scrollView = new brls::ScrollingFrame();
-        m_scrollView->setGrow(1.0f);
-
-        m_childrenBox = new brls::Box();
-        m_childrenBox->setAxis(brls::Axis::COLUMN);
-
-        m_scrollView->setContentView(m_childrenBox);
-        rightPanel->addView(m_scrollView);
+        // Recycled vertical episodes list
+        m_episodeList = new brls::RecyclerFrame();
+        m_episodeList->setGrow(1.0f);
+        m_episodeList->estimatedRowHeight = LIST_ROW_HEIGHT;
+        m_episodeList->registerCell("Episode", [this]() { return new EpisodeCell(this); });
+        m_episodeList->setDataSource(new EpisodeSource(this));
+        rightPanel->addView(m_episodeList);
     }
 
     // Chapters list header + container for books
@@ -443,22 +724,22 @@ MediaDetailView::MediaDetailView(const MediaItem& item)
 
         rightPanel->addView(chaptersHeader);
 
-        // Scrollable vertical chapters list
-        m_scrollView = new brls::ScrollingFrame();
-        m_scrollView->setGrow(1.0f);
-
-        m_chaptersBox = new brls::Box();
-        m_chaptersBox->setAxis(brls::Axis::COLUMN);
-
-        m_scrollView->setContentView(m_chaptersBox);
-        rightPanel->addView(m_scrollView);
-    }
-
-    // For other types that have no list, add a scroll view for the info
-    if (m_item.mediaType != MediaType::PODCAST && m_item.mediaType != MediaType::BOOK) {
-        m_scrollView = new brls::ScrollingFrame();
-        m_scrollView->setGrow(1.0f);
-        // Wrap rightPanel content would need restructuring; for now just ensure scrollView exists
+        // Shown instead of the list when the book has no chapters
+        m_noChaptersLabel = new brls::Label();
+        m_noChaptersLabel->setText("No chapter information available");
+        m_noChaptersLabel->setFontSize(14);
+        m_noChaptersLabel->setTextColor(nvgRGB(150, 150, 150));
+        m_noChaptersLabel->setMarginTop(10);
+        m_noChaptersLabel->setVisibility(brls::Visibility::GONE);
+        rightPanel->addView(m_noChaptersLabel);
+
+        // Recycled vertical chapters list
+        m_chapterList = new brls::RecyclerFrame();
+        m_chapterList->setGrow(1.0f);
+        m_chapterList->estimatedRowHeight = LIST_ROW_HEIGHT;
+        m_chapterList->registerCell("Chapter", [this]() { return new ChapterCell(this); });
+        m_chapterList->setDataSource(new ChapterSource(this));
+        rightPanel->addView(m_chapterList);
     }
 
     this->addView(rightPanel);
@@ -509,10 +790,27 @@ MediaDetailView::MediaDetailView(const MediaItem& item)
         });
     }
 
+    // Follow progress changes made elsewhere (e.g. by the player) while open
+    if (m_item.mediaType == MediaType::BOOK) {
+        m_itemSubscription = ItemStore::getInstance().subscribe(
+            ItemStore::makeKey(m_item.id, ""), [this](const ItemRef& updated) {
+                m_item.currentTime = updated->currentTime;
+                m_item.progress = updated->progress;
+                m_item.isFinished = updated->isFinished;
+                updatePlayButton();
+            });
+    }
+
     // Load full details
     loadDetails();
 }
 
+MediaDetailView::~MediaDetailView() {
+    if (m_itemSubscription != 0) {
+        ItemStore::getInstance().unsubscribe(m_itemSubscription);
+    }
+}
+
 brls::HScrollingFrame* MediaDetailView::createMediaRow(const std::string& title, brls::Box** contentOut) {
     // Unused - kept for interface compatibility
     (void)title;
@@ -574,8 +872,8 @@ void MediaDetailView::willAppear(bool resetState) {
                 }
 
                 // Refresh episode list so download icons update (green checkmark)
-                if (m_item.mediaType == MediaType::PODCAST && m_childrenBox) {
-                    applyFilters();
+                if (m_item.mediaType == MediaType::PODCAST && m_episodeList) {
+                    refreshEpisodes();
                 }
 
                 // Update podcast download/delete button visibility
@@ -609,6 +907,27 @@ void MediaDetailView::willDisappear(bool resetState) {
     mgr.setItemCompletionCallback(nullptr);
 }
 
+void MediaDetailView::updatePlayButton() {
+    if (!m_playButton || m_item.mediaType != MediaType::BOOK) return;
+
+    if (m_item.isFinished) {
+        m_playButton->setText("Play Again");
+    } else if (m_item.currentTime > 0 && !m_item.chapters.empty()) {
+        // Find current chapter
+        int chapterNum = 1;
+        for (size_t i = 0; i < m_item.chapters.size(); i++) {
+            if (m_item.currentTime >= m_item.chapters[i].start &&
+                m_item.currentTime < m_item.chapters[i].end) {
+                chapterNum = static_cast<int>(i + 1);
+                break;
+            }
+        }
+        m_playButton->setText("Play Ch. " + std::to_string(chapterNum));
+    } else if (m_item.currentTime > 0) {
+        m_playButton->setText("Resume");
+    }
+}
+
 void MediaDetailView::loadDetails() {
     AudiobookshelfClient& client = AudiobookshelfClient::getInstance();
 
@@ -616,9 +935,18 @@ void MediaDetailView::loadDetails() {
     MediaItem fullItem;
     bool loadedFromServer = client.fetchItem(m_item.id, fullItem);
 
-    if (loadedFromServer) {
+    // Views open with a summary only - offline, fill in the rest from the local store
+    bool loadedFromStore = !loadedFromServer && !m_item.libraryId.empty() &&
+        MetadataStore::getInstance().getItem(m_item.libraryId, m_item.id, fullItem);
+
+    if (loadedFromServer || loadedFromStore) {
         m_item = fullItem;
 
+        // Share the fresh copy with every cell showing this item
+        if (loadedFromServer) {
+            ItemStore::getInstance().put(MediaItemSummary::fromItem(m_item));
+        }
+
         // Update UI with full details
         if (m_titleLabel && !m_item.title.empty()) {
             m_titleLabel->setText(m_item.title);
@@ -649,26 +977,7 @@ void MediaDetailView::loadDetails() {
         }
 
         // Update play button text dynamically
-        if (m_playButton) {
-            if (m_item.mediaType == MediaType::BOOK) {
-                if (m_item.isFinished) {
-                    m_playButton->setText("Play Again");
-                } else if (m_item.currentTime > 0 && !m_item.chapters.empty()) {
-                    // Find current chapter
-                    int chapterNum = 1;
-                    for (size_t i = 0; i < m_item.chapters.size(); i++) {
-                        if (m_item.currentTime >= m_item.chapters[i].start &&
-                            m_item.currentTime < m_item.chapters[i].end) {
-                            chapterNum = static_cast<int>(i + 1);
-                            break;
-                        }
-                    }
-                    m_playButton->setText("Play Ch. " + std::to_string(chapterNum));
-                } else if (m_item.currentTime > 0) {
-                    m_playButton->setText("Resume");
-                }
-            }
-        }
+        updatePlayButton();
 
         // Update download button state
         if (m_downloadButton && !m_item.audioTracks.empty()) {
@@ -686,10 +995,11 @@ void MediaDetailView::loadDetails() {
         // Server fetch failed - try to load metadata from DownloadsManager (offline mode)
         brls::Logger::info("MediaDetailView: Server fetch failed, loading metadata from downloads");
         DownloadsManager& downloadsMgr = DownloadsManager::getInstance();
-        auto allDownloads = downloadsMgr.getDownloads();
+        DownloadsSnapshotRef snapshot = downloadsMgr.getSnapshot();
 
         // Find matching download (for audiobooks, match itemId; for podcast episodes, we check later)
-        for (const auto& dl : allDownloads) {
+        for (const auto& entry : snapshot->items) {
+            const DownloadItem& dl = *entry;
             if (dl.itemId == m_item.id && dl.state == DownloadState::COMPLETED) {
                 // For podcasts, we want the first episode's parent info or any episode
                 // For audiobooks, this matches directly
@@ -771,20 +1081,66 @@ void MediaDetailView::loadDetails() {
 }
 
 void MediaDetailView::loadChildren() {
-    if (!m_childrenBox) return;
+    if (!m_episodeList || m_episodesLoading) return;
 
-    AudiobookshelfClient& client = AudiobookshelfClient::getInstance();
+    m_children.clear();
+    m_episodesLoading = true;
+    applyFilters();
+
+    // Parse in the background; each page is shown as soon as it is ready
+    std::string podcastId = m_item.id;
+    std::string podcastTitle = m_item.title;
+    std::weak_ptr<bool> aliveWeak = m_alive;
+
+    asyncRun([this, podcastId, podcastTitle, aliveWeak]() {
+        AudiobookshelfClient& client = AudiobookshelfClient::getInstance();
+
+        bool loadedFromServer = client.fetchPodcastEpisodes(podcastId, EPISODE_PAGE_SIZE,
+            [this, &podcastTitle, &aliveWeak](std::vector<MediaItem>& page) {
+            auto alive = aliveWeak.lock();
+            if (!alive || !*alive) return false;  // View closed - stop parsing
+
+            // Index episodes under the podcast name so "<podcast> <episode>" queries match
+            std::vector<MediaItem> indexed = page;
+            for (auto& ep : indexed) {
+                if (ep.seriesName.empty()) ep.seriesName = podcastTitle;
+            }
+            SearchIndex::getInstance().indexItems(indexed);
+
+            brls::sync([this, aliveWeak, episodes = std::move(page)]() mutable {
+                auto alive = aliveWeak.lock();
+                if (!alive || !*alive) return;
+                appendEpisodes(episodes);
+            });
+            return true;
+        });
+
+        brls::sync([this, aliveWeak, loadedFromServer]() {
+            auto alive = aliveWeak.lock();
+            if (!alive || !*alive) return;
+            onEpisodesLoaded(loadedFromServer);
+        });
+    });
+}
+
+void MediaDetailView::appendEpisodes(std::vector<MediaItem>& page) {
+    m_children.insert(m_children.end(), std::make_move_iterator(page.begin()),
+                      std::make_move_iterator(page.end()));
+    refreshEpisodes();
+}
 
-    bool loadedFromServer = client.fetchPodcastEpisodes(m_item.id, m_children);
+void MediaDetailView::onEpisodesLoaded(bool loadedFromServer) {
+    m_episodesLoading = false;
 
     // If server fetch failed, try to load downloaded episodes from DownloadsManager
     if (!loadedFromServer) {
         brls::Logger::info("MediaDetailView: Server fetch failed, loading downloaded episodes");
         DownloadsManager& downloadsMgr = DownloadsManager::getInstance();
-        auto allDownloads = downloadsMgr.getDownloads();
+        DownloadsSnapshotRef snapshot = downloadsMgr.getSnapshot();
 
         m_children.clear();
-        for (const auto& dl : allDownloads) {
+        for (const auto& entry : snapshot->items) {
+            const DownloadItem& dl = *entry;
             if (dl.itemId == m_item.id && dl.state == DownloadState::COMPLETED && !dl.episodeId.empty()) {
                 // Create a MediaItem from the download info
                 MediaItem episode;
@@ -810,12 +1166,10 @@ void MediaDetailView::loadChildren() {
         if (!m_children.empty()) {
             brls::Logger::info("MediaDetailView: Found {} downloaded episodes for podcast", m_children.size());
         }
+        applyFilters();
     }
 
     if (!m_children.empty()) {
-        // Build episode rows via applyFilters (handles sort + filter + row creation)
-        applyFilters();
-
         // Update play button text to show next unheard episode
         if (m_playButton && m_item.mediaType == MediaType::PODCAST) {
             for (size_t i = 0; i < m_children.size(); i++) {
@@ -885,112 +1239,13 @@ void MediaDetailView::loadLocalCover(const std::string& localPath) {
 }
 
 void MediaDetailView::populateChapters() {
-    if (!m_chaptersBox) return;
-
-    m_chaptersBox->clearViews();
-
-    // Check if we have chapters
-    if (m_item.chapters.empty()) {
-        // Show message if no chapters
-        auto* noChaptersLabel = new brls::Label();
-        noChaptersLabel->setText("No chapter information available");
-        noChaptersLabel->setFontSize(14);
-        noChaptersLabel->setTextColor(nvgRGB(150, 150, 150));
-        noChaptersLabel->setMarginTop(10);
-        m_chaptersBox->addView(noChaptersLabel);
-        return;
-    }
-
-    // Helper to format time
-    auto formatTime = [](float seconds) -> std::string {
-        int totalSec = static_cast<int>(seconds);
-        int hours = totalSec / 3600;
-        int mins = (totalSec % 3600) / 60;
-        int secs = totalSec % 60;
-
-        char buf[32];
-        if (hours > 0) {
-            snprintf(buf, sizeof(buf), "%d:%02d:%02d", hours, mins, secs);
-        } else {
-            snprintf(buf, sizeof(buf), "%d:%02d", mins, secs);
-        }
-        return std::string(buf);
-    };
-
-    // Current playback position for highlighting
-    float currentTime = m_item.currentTime;
-
-    for (size_t i = 0; i < m_item.chapters.size(); ++i) {
-        const auto& chapter = m_item.chapters[i];
-
-        auto* chapterRow = new FocusHintBox();
-        chapterRow->setAxis(brls::Axis::ROW);
-        chapterRow->setAlignItems(brls::AlignItems::CENTER);
-        chapterRow->setHeight(56);
-        chapterRow->setMarginBottom(4);
-        chapterRow->setPadding(10, 14, 10, 14);
-        chapterRow->setCornerRadius(8);
-        chapterRow->setFocusable(true);
-
-        // Square button hint (visible on focus only)
-        auto* squareHint = new brls::Image();
-        squareHint->setSize(brls::Size(16, 16));
-        squareHint->setScalingType(brls::ImageScalingType::FIT);
-        squareHint->setImageFromFile(RESOURCE_PREFIX "images/square_button.png");
-        squareHint->setMarginRight(8);
-        squareHint->setVisibility(brls::Visibility::GONE);
-        chapterRow->addView(squareHint);
-        chapterRow->setHintImage(squareHint);
-
-        // Highlight current chapter
-        bool isCurrentChapter = (currentTime >= chapter.start && currentTime < chapter.end);
-        if (isCurrentChapter) {
-            chapterRow->setBackgroundColor(nvgRGBA(0, 128, 128, 200));
-        } else {
-            chapterRow->setBackgroundColor(nvgRGBA(40, 40, 40, 255));
-        }
-
-        // Left side: number + title + time (grows)
-        auto* textBox = new brls::Box();
-        textBox->setAxis(brls::Axis::COLUMN);
-        textBox->setGrow(1.0f);
-
-        // Chapter title
-        auto* titleLabel = new brls::Label();
-        std::string title = chapter.title;
-        if (title.empty()) {
-            title = "Chapter " + std::to_string(i + 1);
-        }
-        if (title.length() > 45) {
-            title = title.substr(0, 42) + "...";
-        }
-        titleLabel->setText(title);
-        titleLabel->setFontSize(14);
-        if (isCurrentChapter) {
-            titleLabel->setTextColor(nvgRGB(255, 255, 255));
-        }
-        textBox->addView(titleLabel);
-
-        // Time info
-        auto* timeLabel = new brls::Label();
-        float duration = chapter.end - chapter.start;
-        timeLabel->setText(formatTime(chapter.start) + " - " + formatTime(duration));
-        timeLabel->setFontSize(11);
-        timeLabel->setTextColor(nvgRGB(150, 150, 150));
-        textBox->addView(timeLabel);
-
-        chapterRow->addView(textBox);
+    if (!m_chapterList) return;
 
-        // Click to play from chapter
-        std::string itemId = m_item.id;
-        float chapterStart = chapter.start;
-        chapterRow->registerClickAction([this, itemId, chapterStart](brls::View*) {
-            startDownloadAndPlay(itemId, "", chapterStart);
-            return true;
-        });
-
-        m_chaptersBox->addView(chapterRow);
-    }
+    // Show message if no chapters
+    bool hasChapters = !m_item.chapters.empty();
+    m_noChaptersLabel->setVisibility(hasChapters ? brls::Visibility::GONE : brls::Visibility::VISIBLE);
+    m_chapterList->setVisibility(hasChapters ? brls::Visibility::VISIBLE : brls::Visibility::GONE);
+    m_chapterList->reloadData();
 }
 
 void MediaDetailView::showFilterMenu() {
@@ -1066,226 +1321,119 @@ void MediaDetailView::showFilterMenu() {
 }
 
 void MediaDetailView::applyFilters() {
-    if (!m_childrenBox) return;
+    if (!m_episodeList) return;
 
-    m_childrenBox->clearViews();
+    rebuildEpisodeOrder();
+    m_episodeList->reloadData();
+}
+
+void MediaDetailView::refreshEpisodes() {
+    if (!m_episodeList) return;
 
-    // Build filtered + sorted list
-    std::vector<MediaItem> filtered;
-    DownloadsManager& dlMgr = DownloadsManager::getInstance();
+    rebuildEpisodeOrder();
+    m_episodeList->notifyDataChanged();
+}
+
+void MediaDetailView::rebuildEpisodeOrder() {
+    // Download state of this podcast's episodes, read once from one snapshot
+    m_episodeDownloads.clear();
+    DownloadsSnapshotRef snapshot = DownloadsManager::getInstance().getSnapshot();
+    for (const auto& entry : snapshot->items) {
+        if (entry->itemId == m_item.id && !entry->episodeId.empty()) {
+            m_episodeDownloads[entry->episodeId] = entry->state;
+        }
+    }
 
-    for (const auto& child : m_children) {
-        std::string epItemId = child.podcastId.empty() ? m_item.id : child.podcastId;
-        bool isEpDownloaded = dlMgr.isDownloaded(epItemId, child.episodeId);
+    // Build filtered + sorted index list
+    m_episodeOrder.clear();
+    m_episodeOrder.reserve(m_children.size());
+    for (size_t i = 0; i < m_children.size(); ++i) {
+        const MediaItem& child = m_children[i];
+        const DownloadState* state = episodeDownload(child);
+        bool isEpDownloaded = state && *state == DownloadState::COMPLETED;
 
         if (m_filterDownloaded && !isEpDownloaded) continue;
         if (m_filterUnheard && child.progress >= 1.0f) continue;
 
-        filtered.push_back(child);
+        m_episodeOrder.push_back(i);
     }
 
     // Sort
     if (!m_sortDescending) {
-        std::reverse(filtered.begin(), filtered.end());
+        std::reverse(m_episodeOrder.begin(), m_episodeOrder.end());
     }
 
     // Update count label
     if (m_episodeCountLabel) {
-        m_episodeCountLabel->setText("(" + std::to_string(filtered.size()) + "/" +
+        m_episodeCountLabel->setText("(" + std::to_string(m_episodeOrder.size()) + "/" +
                                      std::to_string(m_children.size()) + ")");
     }
+}
 
-    // Helper to format duration
-    auto formatDuration = [](float seconds) -> std::string {
-        int totalSec = static_cast<int>(seconds);
-        int hours = totalSec / 3600;
-        int mins = (totalSec % 3600) / 60;
-        if (hours > 0) {
-            return std::to_string(hours) + "h " + std::to_string(mins) + "m";
-        }
-        return std::to_string(mins) + " min";
-    };
-
-    for (size_t i = 0; i < filtered.size(); ++i) {
-        const auto& child = filtered[i];
+const DownloadState* MediaDetailView::episodeDownload(const MediaItem& episode) const {
+    std::string epItemId = episode.podcastId.empty() ? m_item.id : episode.podcastId;
+    if (epItemId != m_item.id) return nullptr;
 
-        auto* episodeRow = new FocusHintBox();
-        episodeRow->setAxis(brls::Axis::ROW);
-        episodeRow->setAlignItems(brls::AlignItems::CENTER);
-        episodeRow->setHeight(56);
-        episodeRow->setMarginBottom(4);
-        episodeRow->setPadding(10, 14, 10, 14);
-        episodeRow->setCornerRadius(8);
-        episodeRow->setBackgroundColor(nvgRGBA(40, 40, 40, 255));
-        episodeRow->setFocusable(true);
-
-        // Square button hint (visible on focus only)
-        auto* squareHint = new brls::Image();
-        squareHint->setSize(brls::Size(16, 16));
-        squareHint->setScalingType(brls::ImageScalingType::FIT);
-        squareHint->setImageFromFile(RESOURCE_PREFIX "images/square_button.png");
-        squareHint->setMarginRight(8);
-        squareHint->setVisibility(brls::Visibility::GONE);
-        episodeRow->addView(squareHint);
-        episodeRow->setHintImage(squareHint);
+    auto it = m_episodeDownloads.find(episode.episodeId);
+    return it != m_episodeDownloads.end() ? &it->second : nullptr;
+}
 
-        // Left side: title + duration
-        auto* textBox = new brls::Box();
-        textBox->setAxis(brls::Axis::COLUMN);
-        textBox->setGrow(1.0f);
+void MediaDetailView::playEpisode(size_t index) {
+    if (index >= m_children.size()) return;
 
-        auto* titleLabel = new brls::Label();
-        std::string title = child.title;
-        if (title.length() > 45) {
-            title = title.substr(0, 42) + "...";
-        }
-        titleLabel->setText(title);
-        titleLabel->setFontSize(14);
-        textBox->addView(titleLabel);
+    MediaItem child = m_children[index];
+    if (child.mediaType == MediaType::PODCAST_EPISODE) {
+        startDownloadAndPlay(child.podcastId, child.episodeId);
+    } else {
+        auto* detailView = new MediaDetailView(child);
+        brls::Application::pushActivity(new brls::Activity(detailView));
+    }
+}
 
-        if (child.duration > 0) {
-            auto* durationLabel = new brls::Label();
-            durationLabel->setText(formatDuration(child.duration));
-            durationLabel->setFontSize(11);
-            durationLabel->setTextColor(nvgRGB(150, 150, 150));
-            textBox->addView(durationLabel);
-        }
+// Toggle download queue state (like Suwayomi):
+// Queued/Downloading -> cancel, Downloaded -> delete, Not queued -> queue download
+void MediaDetailView::toggleEpisodeDownload(size_t index) {
+    if (index >= m_children.size()) return;
 
-        episodeRow->addView(textBox);
+    const MediaItem& child = m_children[index];
+    std::string epItemId = child.podcastId.empty() ? m_item.id : child.podcastId;
+    std::string epId = child.episodeId;
+    std::string epTitle = child.title;
+    std::string epMediaType = (child.mediaType == MediaType::PODCAST_EPISODE) ? "episode" : "book";
 
-        // Right side: download status button
-        auto* dlBtn = new brls::Button();
-        dlBtn->setWidth(55);
-        dlBtn->setHeight(36);
-        dlBtn->setCornerRadius(18);
-        dlBtn->setJustifyContent(brls::JustifyContent::CENTER);
-        dlBtn->setAlignItems(brls::AlignItems::CENTER);
-
-        auto* dlIcon = new brls::Image();
-        dlIcon->setWidth(20);
-        dlIcon->setHeight(20);
-        dlIcon->setScalingType(brls::ImageScalingType::FIT);
-
-        std::string epItemId = child.podcastId.empty() ? m_item.id : child.podcastId;
-        std::string epId = child.episodeId;
-
-        // Check download state: completed, queued/downloading, or not queued
-        bool isEpDownloaded = dlMgr.isDownloaded(epItemId, epId);
-        bool isEpQueued = false;
-        bool isEpDownloading = false;
-        {
-            DownloadItem* dlItem = dlMgr.getDownload(epItemId, epId);
-            if (dlItem) {
-                isEpQueued = (dlItem->state == DownloadState::QUEUED);
-                isEpDownloading = (dlItem->state == DownloadState::DOWNLOADING);
-            }
-        }
+    DownloadsManager& dm = DownloadsManager::getInstance();
+    dm.init();
 
-        if (isEpDownloaded) {
-            dlIcon->setImageFromFile(RESOURCE_PREFIX "icons/checkbox_checked.png");
-            dlBtn->setBackgroundColor(nvgRGBA(46, 204, 113, 200));
-        } else if (isEpQueued || isEpDownloading) {
-            dlIcon->setImageFromFile(RESOURCE_PREFIX "icons/download.png");
-            dlBtn->setBackgroundColor(nvgRGBA(200, 180, 60, 200));  // Yellow for queued/downloading
+    // Query live state at action time (not the state the row was bound with)
+    DownloadsSnapshotRef snapshot = dm.getSnapshot();
+    const DownloadItem* dlItem = snapshot->find(epItemId, epId);
+    bool downloaded = dlItem && (dlItem->state == DownloadState::COMPLETED);
+    bool isQueued = dlItem && (dlItem->state == DownloadState::QUEUED);
+    bool isDownloading = dlItem && (dlItem->state == DownloadState::DOWNLOADING);
+
+    if (isQueued || isDownloading) {
+        dm.cancelDownload(epItemId, epId);
+        brls::Application::notify("Download cancelled");
+    } else if (downloaded) {
+        dm.deleteDownloadByEpisodeId(epItemId, epId);
+        brls::Application::notify("Deleted download");
+    } else {
+        bool q = dm.queueDownload(epItemId, epTitle, m_item.authorName, child.duration, epMediaType, "", epId);
+        if (q) {
+            dm.startDownloads();
+            brls::Application::notify("Queued: " + epTitle);
         } else {
-            dlIcon->setImageFromFile(RESOURCE_PREFIX "icons/download.png");
-            dlBtn->setBackgroundColor(nvgRGBA(60, 60, 60, 200));
+            brls::Application::notify("Already in queue");
         }
-
-        dlBtn->addView(dlIcon);
-
-        // Click and X button: toggle download queue state (like Suwayomi)
-        // Queued/Downloading → cancel, Downloaded → delete, Not queued → queue download
-        std::string epTitle = child.title;
-        std::string epAuthor = m_item.authorName;
-        float epDuration = child.duration;
-        std::string epMediaType = (child.mediaType == MediaType::PODCAST_EPISODE) ? "episode" : "book";
-
-        dlBtn->registerClickAction([this, epItemId, epId, epTitle, epAuthor, epDuration, epMediaType, dlBtn](brls::View*) {
-            DownloadsManager& dm = DownloadsManager::getInstance();
-            dm.init();
-
-            // Query live state at action time (not stale bind-time values)
-            DownloadItem* dlItem = dm.getDownload(epItemId, epId);
-            bool downloaded = dm.isDownloaded(epItemId, epId);
-            bool queued = dlItem && (dlItem->state == DownloadState::QUEUED);
-            bool downloading = dlItem && (dlItem->state == DownloadState::DOWNLOADING);
-
-            if (queued || downloading) {
-                // Cancel the download
-                dm.cancelDownload(epItemId, epId);
-                brls::Application::notify("Download cancelled");
-                applyFilters();
-            } else if (downloaded) {
-                // Delete the download
-                dm.deleteDownloadByEpisodeId(epItemId, epId);
-                brls::Application::notify("Deleted download");
-                applyFilters();
-            } else {
-                // Queue the download (like Suwayomi - no blocking dialog)
-                bool queued = dm.queueDownload(epItemId, epTitle, epAuthor, epDuration, epMediaType, "", epId);
-                if (queued) {
-                    dm.startDownloads();
-                    brls::Application::notify("Queued: " + epTitle);
-                } else {
-                    brls::Application::notify("Already in queue");
-                }
-                applyFilters();  // Refresh to show queued state
-            }
-            return true;
-        });
-
-        episodeRow->addView(dlBtn);
-
-        // Square button action: toggle download queue state (like Suwayomi X button)
-        episodeRow->registerAction("Download", brls::ControllerButton::BUTTON_X,
-            [this, epItemId, epId, epTitle, epAuthor, epDuration, epMediaType](brls::View*) {
-            DownloadsManager& dm = DownloadsManager::getInstance();
-            dm.init();
-
-            // Query live state
-            DownloadItem* dlItem = dm.getDownload(epItemId, epId);
-            bool downloaded = dm.isDownloaded(epItemId, epId);
-            bool isQueued = dlItem && (dlItem->state == DownloadState::QUEUED);
-            bool isDownloading = dlItem && (dlItem->state == DownloadState::DOWNLOADING);
-
-            if (isQueued || isDownloading) {
-                dm.cancelDownload(epItemId, epId);
-                brls::Application::notify("Download cancelled");
-            } else if (downloaded) {
-                dm.deleteDownloadByEpisodeId(epItemId, epId);
-                brls::Application::notify("Deleted download");
-            } else {
-                bool q = dm.queueDownload(epItemId, epTitle, epAuthor, epDuration, epMediaType, "", epId);
-                if (q) {
-                    dm.startDownloads();
-                    brls::Application::notify("Queued: " + epTitle);
-                } else {
-                    brls::Application::notify("Already in queue");
-                }
-            }
-            // Defer UI refresh to next frame
-            std::weak_ptr<bool> aliveWeak = m_alive;
-            brls::sync([this, aliveWeak]() {
-                auto alive = aliveWeak.lock();
-                if (!alive || !*alive) return;
-                applyFilters();
-            });
-            return true;
-        }, false, false, brls::Sound::SOUND_CLICK);
-
-        episodeRow->registerClickAction([this, child](brls::View*) {
-            if (child.mediaType == MediaType::PODCAST_EPISODE) {
-                startDownloadAndPlay(child.podcastId, child.episodeId);
-            } else {
-                auto* detailView = new MediaDetailView(child);
-                brls::Application::pushActivity(new brls::Activity(detailView));
-            }
-            return true;
-        });
-
-        m_childrenBox->addView(episodeRow);
     }
+
+    // Defer UI refresh to next frame (the row is still handling its action)
+    std::weak_ptr<bool> aliveWeak = m_alive;
+    brls::sync([this, aliveWeak]() {
+        auto alive = aliveWeak.lock();
+        if (!alive || !*alive) return;
+        refreshEpisodes();
+    });
 }
 
 void MediaDetailView::onPlay(bool resume) {
@@ -1347,7 +1495,8 @@ void MediaDetailView::startDownloadAndPlay(const std::string& itemId, const std:
 
             // Also check local progress
             if (startTime <= 0) {
-                DownloadItem* download = downloadsMgr.getDownload(itemId);
+                DownloadsSnapshotRef snapshot = downloadsMgr.getSnapshot();
+                const DownloadItem* download = snapshot->find(itemId);
                 if (download && download->currentTime > 0) {
                     startTime = download->currentTime;
                     brls::Logger::info("Using local download progress: {}s", startTime);
@@ -1362,6 +1511,11 @@ void MediaDetailView::startDownloadAndPlay(const std::string& itemId, const std:
     // If not download-only, stream directly from server URL
     // mpv handles HTTP streaming natively (matching Vita_plex approach)
     if (!downloadOnly) {
+        // Playing an item that is waiting in the download queue makes it the next download
+        if (downloadsMgr.prioritizeDownload(itemId, episodeId)) {
+            downloadsMgr.startDownloads();
+        }
+
         // If downloadOnPlay setting is enabled, also queue for background download
         if (Application::getInstance().getSettings().downloadOnPlay) {
             DownloadsManager& dm = DownloadsManager::getInstance();
@@ -1408,25 +1562,34 @@ void MediaDetailView::startDownloadAndPlay(const std::string& itemId, const std:
     asyncRun([this, progressDialog, itemId, episodeId, title, authorName, itemType, duration, coverUrl, description, downloadChapters]() {
         AudiobookshelfClient& client = AudiobookshelfClient::getInstance();
 
-        // Start playback session
-        PlaybackSession session;
-        if (!client.startPlaybackSession(itemId, session, episodeId)) {
-            brls::Logger::error("Failed to start playback session");
+        // One item request lists the files; no playback session is needed to download
+        DownloadPlan plan;
+        if (!client.fetchDownloadPlan(itemId, episodeId, plan)) {
+            brls::Logger::error("Failed to get download plan");
             brls::sync([progressDialog]() {
-                progressDialog->setStatus("Failed to start session");
+                progressDialog->setStatus("Failed to get file list");
                 brls::delay(2000, [progressDialog]() { progressDialog->dismiss(); });
             });
             return;
         }
 
-        brls::Logger::info("Session started: {} tracks, currentTime={}s, duration={}s",
-                          session.audioTracks.size(), session.currentTime, session.duration);
+        // Chapters may not have been loaded into the view yet
+        std::vector<DownloadChapter> chapters = downloadChapters;
+        if (chapters.empty()) {
+            for (const auto& ch : plan.item.chapters) {
+                DownloadChapter dch;
+                dch.title = ch.title;
+                dch.start = ch.start;
+                dch.end = ch.end;
+                chapters.push_back(dch);
+            }
+        }
 
         // Determine file extension and multi-file status
-        bool isMultiFile = session.audioTracks.size() > 1;
+        bool isMultiFile = plan.files.size() > 1;
         std::string mimeType = "audio/mpeg";
-        if (!session.audioTracks.empty() && !session.audioTracks[0].mimeType.empty()) {
-            mimeType = session.audioTracks[0].mimeType;
+        if (!plan.files[0].mimeType.empty()) {
+            mimeType = plan.files[0].mimeType;
         }
 
         std::string ext = ".mp3";
@@ -1463,8 +1626,7 @@ void MediaDetailView::startDownloadAndPlay(const std::string& itemId, const std:
 
         if (isMultiFile) {
             // Multi-file audiobook handling
-            int numTracks = static_cast<int>(session.audioTracks.size());
-            std::vector<std::string> trackFiles;
+            int numTracks = static_cast<int>(plan.files.size());
 
             // Check if combined file already exists on disk
             std::string combinedPath = downloadsMgr.getDownloadsPath() + "/" + itemId + finalExt;
@@ -1474,7 +1636,7 @@ void MediaDetailView::startDownloadAndPlay(const std::string& itemId, const std:
                 brls::Logger::info("Found existing combined file: {} ({} bytes)", combinedPath, existingStat.st_size);
 
                 downloadsMgr.registerCompletedDownload(itemId, episodeId, title, authorName,
-                    combinedPath, existingStat.st_size, duration, itemType, coverUrl, description, downloadChapters);
+                    combinedPath, existingStat.st_size, duration, itemType, coverUrl, description, chapters);
 
                 brls::sync([progressDialog, this]() {
                     progressDialog->setStatus("Download complete!");
@@ -1484,12 +1646,14 @@ void MediaDetailView::startDownloadAndPlay(const std::string& itemId, const std:
                 return;
             }
 
-            // Download all tracks sequentially
+            // Download all tracks sequentially, appending each to the combined
+            // file as soon as it finishes so no separate combine pass is needed
             brls::Logger::info("Download-only mode: Downloading all {} tracks for multi-file audiobook", numTracks);
+            AudioConcatenator combiner(destPath);
 
             for (int trackIdx = 0; trackIdx < numTracks && downloadSuccess; trackIdx++) {
-                const AudioTrack& track = session.audioTracks[trackIdx];
-                std::string trackUrl = client.getStreamUrl(track.contentUrl, "");
+                const AudioFileInfo& track = plan.files[trackIdx];
+                std::string trackUrl = client.getFileDownloadUrl(plan, trackIdx);
 
                 if (trackUrl.empty()) {
                     brls::Logger::error("Failed to get URL for track {}", trackIdx);
@@ -1503,9 +1667,13 @@ void MediaDetailView::startDownloadAndPlay(const std::string& itemId, const std:
                     trackExt = ".m4a";
                 }
 
-                // Use downloads temp path for track files
-                std::string trackPath = downloadsMgr.getDownloadsPath() + "/" + itemId + "_track" + std::to_string(trackIdx) + trackExt;
-                trackFiles.push_back(trackPath);
+                // MP3 tracks stream straight into the combined file; other
+                // formats go through a temp track file that is remuxed in
+                bool streamed = combiner.acceptsRawData();
+                std::string trackPath;
+                if (!streamed) {
+                    trackPath = downloadsMgr.getDownloadsPath() + "/" + itemId + "_track" + std::to_string(trackIdx) + trackExt;
+                }
 
                 int currentTrack = trackIdx;
                 brls::sync([progressDialog, currentTrack, numTracks]() {
@@ -1514,11 +1682,14 @@ void MediaDetailView::startDownloadAndPlay(const std::string& itemId, const std:
                     progressDialog->setStatus(buf);
                 });
 
-                SceUID fd = sceIoOpen(trackPath.c_str(), SCE_O_WRONLY | SCE_O_CREAT | SCE_O_TRUNC, 0777);
-                if (fd < 0) {
-                    brls::Logger::error("Failed to create track file: {}", trackPath);
-                    downloadSuccess = false;
-                    break;
+                SceUID fd = -1;
+                if (!streamed) {
+                    fd = sceIoOpen(trackPath.c_str(), SCE_O_WRONLY | SCE_O_CREAT | SCE_O_TRUNC, 0777);
+                    if (fd < 0) {
+                        brls::Logger::error("Failed to create track file: {}", trackPath);
+                        downloadSuccess = false;
+                        break;
+                    }
                 }
 
                 int64_t trackDownloaded = 0;
@@ -1526,8 +1697,12 @@ void MediaDetailView::startDownloadAndPlay(const std::string& itemId, const std:
 
                 bool trackOk = httpClient.downloadFile(trackUrl,
                     [&](const char* data, size_t size) -> bool {
-                        int written = sceIoWrite(fd, data, size);
-                        if (written < 0) return false;
+                        if (streamed) {
+                            if (!combiner.appendData(data, size)) return false;
+                        } else {
+                            int written = sceIoWrite(fd, data, size);
+                            if (written < 0) return false;
+                        }
                         trackDownloaded += size;
 
                         if (trackSize > 0) {
@@ -1549,67 +1724,42 @@ void MediaDetailView::startDownloadAndPlay(const std::string& itemId, const std:
                     }
                 );
 
-                sceIoClose(fd);
+                if (streamed) {
+                    combiner.endTrack();
+                } else {
+                    sceIoClose(fd);
+                }
 
                 if (!trackOk) {
                     brls::Logger::error("Failed to download track {}", trackIdx);
-                    sceIoRemove(trackPath.c_str());
+                    if (!streamed) sceIoRemove(trackPath.c_str());
+                    downloadSuccess = false;
+                } else if (!streamed && !combiner.appendFile(trackPath)) {
+                    brls::Logger::error("Failed to append track {} to {}", trackIdx, destPath);
                     downloadSuccess = false;
                 } else {
-                    totalDownloaded += trackDownloaded;
                     brls::Logger::info("Track {}/{} complete ({} bytes)", trackIdx + 1, numTracks, trackDownloaded);
                 }
             }
 
-            // Combine all tracks if all downloaded successfully
+            // Close out the combined file; on failure the combiner removes it
             if (downloadSuccess) {
-                brls::sync([progressDialog]() {
-                    progressDialog->setStatus("Combining audio files...");
-                });
-
-                brls::Logger::info("Combining {} tracks into {}", numTracks, destPath);
-
-                int totalTracks = numTracks;
-                if (concatenateAudioFiles(trackFiles, destPath, [progressDialog, totalTracks](int current, int total) {
-                    brls::sync([progressDialog, current, totalTracks]() {
-                        char buf[64];
-                        snprintf(buf, sizeof(buf), "Combining file %d/%d...", current, totalTracks);
-                        progressDialog->setStatus(buf);
-                    });
-                })) {
+                if (combiner.finish()) {
                     brls::Logger::info("Successfully combined {} tracks", numTracks);
 
                     SceIoStat stat;
                     if (sceIoGetstat(destPath.c_str(), &stat) >= 0) {
                         totalDownloaded = stat.st_size;
                     }
-
-                    for (const auto& trackFile : trackFiles) {
-                        sceIoRemove(trackFile.c_str());
-                    }
                 } else {
                     brls::Logger::error("Failed to combine tracks");
                     downloadSuccess = false;
-                    for (const auto& trackFile : trackFiles) {
-                        sceIoRemove(trackFile.c_str());
-                    }
-                }
-            } else {
-                for (const auto& trackFile : trackFiles) {
-                    if (!trackFile.empty()) {
-                        sceIoRemove(trackFile.c_str());
-                    }
                 }
             }
 
         } else {
             // Single file download
-            std::string streamUrl;
-            if (!session.audioTracks.empty() && !session.audioTracks[0].contentUrl.empty()) {
-                streamUrl = client.getStreamUrl(session.audioTracks[0].contentUrl, "");
-            } else {
-                streamUrl = client.getDirectStreamUrl(itemId, 0);
-            }
+            std::string streamUrl = client.getFileDownloadUrl(plan);
 
             if (streamUrl.empty()) {
                 brls::Logger::error("Failed to get stream URL");
@@ -1654,7 +1804,7 @@ void MediaDetailView::startDownloadAndPlay(const std::string& itemId, const std:
         if (downloadSuccess) {
             downloadsMgr.registerCompletedDownload(itemId, episodeId, title,
                 authorName, destPath, totalDownloaded, duration, itemType,
-                coverUrl, description, downloadChapters);
+                coverUrl, description, chapters);
 
             brls::Logger::info("Download complete: {}", destPath);
 
@@ -1727,7 +1877,7 @@ void MediaDetailView::onDeleteDownload() {
 
 bool MediaDetailView::areAllEpisodesDownloaded() {
     if (m_item.mediaType != MediaType::PODCAST) return false;
-    if (m_children.empty()) return false;
+    if (m_children.empty() || m_episodesLoading) return false;
 
     DownloadsManager& mgr = DownloadsManager::getInstance();
     for (const auto& ep : m_children) {
@@ -1753,8 +1903,9 @@ bool MediaDetailView::hasAnyDownloadedEpisodes() {
     }
 
     // Also check downloads directly for this podcast
-    auto downloads = mgr.getDownloads();
-    for (const auto& dl : downloads) {
+    DownloadsSnapshotRef snapshot = mgr.getSnapshot();
+    for (const auto& entry : snapshot->items) {
+        const DownloadItem& dl = *entry;
         if (dl.itemId == m_item.id && dl.state == DownloadState::COMPLETED) {
             return true;
         }
@@ -2009,7 +2160,8 @@ void MediaDetailView::startDownloadOnly(const std::string& itemId, const std::st
     }
 
     // Check if already in queue
-    DownloadItem* existing = dm.getDownload(itemId, episodeId);
+    DownloadsSnapshotRef snapshot = dm.getSnapshot();
+    const DownloadItem* existing = snapshot->find(itemId, episodeId);
     if (existing && (existing->state == DownloadState::QUEUED || existing->state == DownloadState::DOWNLOADING)) {
         brls::Application::notify("Already in download queue");
         return;
@@ -2048,29 +2200,28 @@ void MediaDetailView::batchDownloadEpisodes(const std::vector<MediaItem>& episod
     dm.init();
 
     std::string podcastId = m_item.id;
-    std::string podcastAuthor = m_item.authorName.empty() ? m_item.title : m_item.authorName;
-    int queued = 0;
-    int skipped = 0;
+    std::string podcastAuthor = m_item.authorName.empty() ? m_item.title : m_item.authorName.str();
 
+    // Episodes already stored (downloaded, queued or downloading) are left out
+    DownloadsSnapshotRef snapshot = dm.getSnapshot();
+    std::vector<DownloadRequest> requests;
+    requests.reserve(episodes.size());
     for (const auto& ep : episodes) {
-        std::string episodeId = ep.episodeId;
-
-        // Skip if already downloaded or already in queue
-        if (dm.isDownloaded(podcastId, episodeId)) {
-            skipped++;
-            continue;
-        }
-        DownloadItem* existing = dm.getDownload(podcastId, episodeId);
-        if (existing && (existing->state == DownloadState::QUEUED || existing->state == DownloadState::DOWNLOADING)) {
-            skipped++;
-            continue;
-        }
-
-        if (dm.queueDownload(podcastId, ep.title, podcastAuthor, ep.duration, "episode", "", episodeId)) {
-            queued++;
-        }
+        if (snapshot->find(podcastId, ep.episodeId)) continue;
+
+        DownloadRequest request;
+        request.itemId = podcastId;
+        request.title = ep.title;
+        request.authorName = podcastAuthor;
+        request.duration = ep.duration;
+        request.mediaType = "episode";
+        request.episodeId = ep.episodeId;
+        requests.push_back(std::move(request));
     }
 
+    // One lock and one save for the whole batch
+    int queued = dm.queueDownloads(requests);
+
     if (queued > 0) {
         dm.startDownloads();
         brls::Application::notify("Queued " + std::to_string(queued) + " episodes");
@@ -2079,7 +2230,7 @@ void MediaDetailView::batchDownloadEpisodes(const std::vector<MediaItem>& episod
     }
 
     // Refresh UI to show queued states
-    applyFilters();
+    refreshEpisodes();
 }
 
 void MediaDetailView::showDownloadOptions() {
@@ -2087,6 +2238,12 @@ void MediaDetailView::showDownloadOptions() {
         return;
     }
 
+    // The counts below need the whole episode list
+    if (m_episodesLoading) {
+        brls::Application::notify("Episodes are still loading");
+        return;
+    }
+
     // Count episodes and find undownloaded ones
     DownloadsManager& downloadsMgr = DownloadsManager::getInstance();
     std::vector<MediaItem> undownloadedEpisodes;
@@ -50,6 +50,9 @@ static void loadLocalCoverToImage(brls::Image* image, const std::string& localPa
 
 MediaItemCell::~MediaItemCell() {
     *m_alive = false;
+    if (m_subscription != 0) {
+        ItemStore::getInstance().unsubscribe(m_subscription);
+    }
 }
 
 MediaItemCell::MediaItemCell() {
@@ -99,8 +102,39 @@ MediaItemCell::MediaItemCell() {
     this->addView(m_progressBar);
 }
 
-void MediaItemCell::setItem(const MediaItem& item) {
-    m_item = item;
+void MediaItemCell::setItem(const MediaItemSummary& item) {
+    setItem(ItemStore::getInstance().put(item));
+}
+
+void MediaItemCell::setItem(const ItemRef& item) {
+    if (!item) return;
+
+    // Follow the entity so progress/metadata changes elsewhere reach this cell
+    std::string key = ItemStore::makeKey(*item);
+    if (m_subscription == 0 || ItemStore::makeKey(*m_item) != key) {
+        ItemStore& store = ItemStore::getInstance();
+        if (m_subscription != 0) {
+            store.unsubscribe(m_subscription);
+            m_subscription = 0;
+        }
+        if (!item->id.empty() && item->mediaType != MediaType::UNKNOWN) {
+            std::weak_ptr<bool> aliveWeak = m_alive;
+            m_subscription = store.subscribe(key, [this, aliveWeak](const ItemRef& updated) {
+                auto alive = aliveWeak.lock();
+                if (!alive || !*alive) return;
+                bind(updated);
+            });
+        }
+    }
+
+    bind(item);
+}
+
+void MediaItemCell::bind(const ItemRef& itemRef) {
+    const MediaItemSummary& item = *itemRef;
+    // Only refetch the cover when it actually changed (cells get re-bound on revalidation)
+    bool coverChanged = m_item->id != item.id || m_item->coverPath != item.coverPath;
+    m_item = itemRef;
 
     // Audiobookshelf uses square covers
     m_thumbnailImage->setWidth(140);
@@ -133,24 +167,28 @@ void MediaItemCell::setItem(const MediaItem& item) {
         float progress = item.currentTime / item.duration;
         m_progressBar->setWidth(140 * progress);
         m_progressBar->setVisibility(brls::Visibility::VISIBLE);
+    } else if (m_progressBar) {
+        m_progressBar->setVisibility(brls::Visibility::GONE);
     }
 
     // Load thumbnail
-    loadThumbnail();
+    if (coverChanged) {
+        loadThumbnail();
+    }
 }
 
 void MediaItemCell::loadThumbnail() {
     if (!m_thumbnailImage) return;
 
     brls::Logger::debug("MediaItemCell::loadThumbnail for '{}' id='{}' coverPath='{}'",
-                       m_item.title, m_item.id, m_item.coverPath);
+                       m_item->title, m_item->id, m_item->coverPath);
 
     // Check if we have a Vita local cover path (for downloaded items)
     // Vita local paths start with "ux0:"
-    if (!m_item.coverPath.empty() && m_item.coverPath.find("ux0:") == 0) {
+    if (!m_item->coverPath.empty() && m_item->coverPath.find("ux0:") == 0) {
         // Local Vita path - load directly from file
-        brls::Logger::debug("MediaItemCell: Loading local cover from {}", m_item.coverPath);
-        loadLocalCoverToImage(m_thumbnailImage, m_item.coverPath);
+        brls::Logger::debug("MediaItemCell: Loading local cover from {}", m_item->coverPath);
+        loadLocalCoverToImage(m_thumbnailImage, m_item->coverPath);
         return;
     }
 
@@ -161,19 +199,19 @@ void MediaItemCell::loadThumbnail() {
     int size = 280;
 
     // Use item ID for cover URL
-    if (m_item.id.empty()) {
-        brls::Logger::warning("MediaItemCell: No item ID for cover of '{}'", m_item.title);
+    if (m_item->id.empty()) {
+        brls::Logger::warning("MediaItemCell: No item ID for cover of '{}'", m_item->title);
         return;
     }
 
-    std::string url = client.getCoverUrl(m_item.id, size, size);
+    std::string url = client.getCoverUrl(m_item->id, size, size);
     brls::Logger::debug("MediaItemCell: Loading cover from URL: {}", url);
 
     std::weak_ptr<bool> aliveWeak = m_alive;
     ImageLoader::loadAsync(url, [this, aliveWeak](brls::Image* image) {
         auto alive = aliveWeak.lock();
         if (!alive || !*alive) return;
-        brls::Logger::debug("MediaItemCell: Cover loaded for '{}'", m_item.title);
+        brls::Logger::debug("MediaItemCell: Cover loaded for '{}'", m_item->title);
     }, m_thumbnailImage, aliveWeak);
 }
 
@@ -195,24 +233,24 @@ void MediaItemCell::updateFocusInfo(bool focused) {
     if (!m_titleLabel || !m_descriptionLabel) return;
 
     // For podcast episodes, show extended info on focus
-    if (m_item.mediaType == MediaType::PODCAST_EPISODE) {
+    if (m_item->mediaType == MediaType::PODCAST_EPISODE) {
         if (focused) {
             // Show full title with episode number
-            std::string fullTitle = m_item.title;
-            if (m_item.episodeNumber > 0) {
-                fullTitle = "Ep " + std::to_string(m_item.episodeNumber) + ": " + m_item.title;
+            std::string fullTitle = m_item->title;
+            if (m_item->episodeNumber > 0) {
+                fullTitle = "Ep " + std::to_string(m_item->episodeNumber) + ": " + m_item->title;
             }
             m_titleLabel->setText(fullTitle);
 
             // Show duration and other info
             std::string info;
-            if (m_item.duration > 0) {
-                int minutes = (int)(m_item.duration / 60.0f);
+            if (m_item->duration > 0) {
+                int minutes = (int)(m_item->duration / 60.0f);
                 info = std::to_string(minutes) + " min";
             }
-            if (!m_item.description.empty()) {
+            if (!m_item->blurb.empty()) {
                 // Show first 50 chars of description
-                std::string desc = m_item.description;
+                std::string desc = m_item->blurb;
                 if (desc.length() > 50) {
                     desc = desc.substr(0, 47) + "...";
                 }
@@ -228,16 +266,16 @@ void MediaItemCell::updateFocusInfo(bool focused) {
             m_titleLabel->setText(m_originalTitle);
             m_descriptionLabel->setVisibility(brls::Visibility::GONE);
         }
-    } else if (m_item.mediaType == MediaType::BOOK) {
+    } else if (m_item->mediaType == MediaType::BOOK) {
         // Show author and duration for books on focus
         if (focused) {
             std::string info;
-            if (!m_item.authorName.empty()) {
-                info = m_item.authorName;
+            if (!m_item->authorName.empty()) {
+                info = m_item->authorName;
             }
-            if (m_item.duration > 0) {
-                int hours = (int)(m_item.duration / 3600.0f);
-                int mins = (int)((m_item.duration - hours * 3600) / 60.0f);
+            if (m_item->duration > 0) {
+                int hours = (int)(m_item->duration / 3600.0f);
+                int mins = (int)((m_item->duration - hours * 3600) / 60.0f);
                 if (!info.empty()) info += " - ";
                 info += std::to_string(hours) + "h " + std::to_string(mins) + "m";
             }
@@ -246,23 +284,23 @@ void MediaItemCell::updateFocusInfo(bool focused) {
                 m_descriptionLabel->setVisibility(brls::Visibility::VISIBLE);
             }
             // Show full title
-            m_titleLabel->setText(m_item.title);
+            m_titleLabel->setText(m_item->title);
         } else {
             m_titleLabel->setText(m_originalTitle);
             m_descriptionLabel->setVisibility(brls::Visibility::GONE);
         }
-    } else if (m_item.mediaType == MediaType::PODCAST) {
+    } else if (m_item->mediaType == MediaType::PODCAST) {
         // Show podcast info on focus
         if (focused) {
             std::string info;
-            if (!m_item.authorName.empty()) {
-                info = m_item.authorName;
+            if (!m_item->authorName.empty()) {
+                info = m_item->authorName;
             }
             if (!info.empty()) {
                 m_descriptionLabel->setText(info);
                 m_descriptionLabel->setVisibility(brls::Visibility::VISIBLE);
             }
-            m_titleLabel->setText(m_item.title);
+            m_titleLabel->setText(m_item->title);
         } else {
             m_titleLabel->setText(m_originalTitle);
             m_descriptionLabel->setVisibility(brls::Visibility::GONE);
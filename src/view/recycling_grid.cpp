@@ -21,21 +21,54 @@ RecyclingGrid::RecyclingGrid() {
     m_visibleRows = 3;
 }
 
-void RecyclingGrid::setDataSource(const std::vector<MediaItem>& items) {
+void RecyclingGrid::setDataSource(const std::vector<ItemRef>& items) {
     brls::Logger::debug("RecyclingGrid: setDataSource with {} items", items.size());
     m_items = items;
     rebuildGrid();
     brls::Logger::debug("RecyclingGrid: rebuildGrid completed");
 }
 
-void RecyclingGrid::setOnItemSelected(std::function<void(const MediaItem&)> callback) {
+void RecyclingGrid::setDataSource(const std::vector<MediaItemSummary>& items) {
+    setDataSource(ItemStore::getInstance().putAll(items));
+}
+
+void RecyclingGrid::setDataSource(const std::vector<MediaItem>& items) {
+    setDataSource(MediaItemSummary::fromItems(items));
+}
+
+void RecyclingGrid::updateDataSource(const std::vector<ItemRef>& items) {
+    bool sameIds = !items.empty() && items.size() == m_items.size() && m_cells.size() == m_items.size();
+    for (size_t i = 0; sameIds && i < items.size(); i++) {
+        sameIds = items[i]->id == m_items[i]->id;
+    }
+
+    if (!sameIds) {
+        setDataSource(items);
+        return;
+    }
+
+    // Store-backed cells have usually been re-bound by the store already
+    int patched = 0;
+    for (size_t i = 0; i < items.size(); i++) {
+        if (m_cells[i]->getItemRef() != items[i]) {
+            m_cells[i]->setItem(items[i]);
+            patched++;
+        }
+    }
+    m_items = items;
+    brls::Logger::debug("RecyclingGrid: Patched {} of {} cells", patched, items.size());
+}
+
+void RecyclingGrid::setOnItemSelected(std::function<void(const MediaItemSummary&)> callback) {
     m_onItemSelected = callback;
 }
 
 void RecyclingGrid::rebuildGrid() {
     m_contentBox->clearViews();
+    m_cells.clear();
 
     if (m_items.empty()) return;
+    m_cells.reserve(m_items.size());
 
     // Create rows
     brls::Box* currentRow = nullptr;
@@ -64,6 +97,7 @@ void RecyclingGrid::rebuildGrid() {
         cell->addGestureRecognizer(new brls::TapGestureRecognizer(cell));
 
         currentRow->addView(cell);
+        m_cells.push_back(cell);
 
         itemsInRow++;
         if (itemsInRow >= m_columns) {
@@ -74,10 +108,12 @@ void RecyclingGrid::rebuildGrid() {
 
 void RecyclingGrid::onItemClicked(int index) {
     brls::Logger::debug("RecyclingGrid::onItemClicked index={} items={}", index, m_items.size());
-    if (index >= 0 && index < (int)m_items.size()) {
+    if (index >= 0 && index < (int)m_cells.size()) {
         if (m_onItemSelected) {
-            brls::Logger::debug("RecyclingGrid: Calling onItemSelected for '{}'", m_items[index].title);
-            m_onItemSelected(m_items[index]);
+            // The cell holds the latest entity (the store may have replaced m_items[index])
+            const MediaItemSummary& item = m_cells[index]->getItem();
+            brls::Logger::debug("RecyclingGrid: Calling onItemSelected for '{}'", item.title);
+            m_onItemSelected(item);
             brls::Logger::debug("RecyclingGrid: onItemSelected completed");
         } else {
             brls::Logger::warning("RecyclingGrid: No onItemSelected callback set");
@@ -7,10 +7,15 @@
 #include "view/media_detail_view.hpp"
 #include "view/media_item_cell.hpp"
 #include "app/application.hpp"
+#include "app/search_index.hpp"
+#include "utils/async.hpp"
 
 namespace vitaabs {
 
 SearchTab::SearchTab() {
+    // Create alive flag for async callback safety
+    m_alive = std::make_shared<bool>(true);
+
     this->setAxis(brls::Axis::COLUMN);
     this->setJustifyContent(brls::JustifyContent::FLEX_START);
     this->setAlignItems(brls::AlignItems::STRETCH);
@@ -124,16 +129,26 @@ SearchTab::SearchTab() {
     this->addView(m_scrollView);
 }
 
+SearchTab::~SearchTab() {
+    cancelPendingSearch();
+    if (m_alive) {
+        *m_alive = false;
+    }
+}
+
 void SearchTab::onFocusGained() {
     brls::Box::onFocusGained();
 
+    // Pick up downloads added/removed since the last visit
+    asyncRun([]() { SearchIndex::getInstance().syncDownloads(); });
+
     // Focus search label
     if (m_searchLabel) {
         brls::Application::giveFocus(m_searchLabel);
     }
 }
 
-void SearchTab::populateRow(brls::Box* rowContent, const std::vector<MediaItem>& items) {
+void SearchTab::populateRow(brls::Box* rowContent, const std::vector<ItemRef>& items) {
     if (!rowContent) return;
 
     rowContent->clearViews();
@@ -145,9 +160,8 @@ void SearchTab::populateRow(brls::Box* rowContent, const std::vector<MediaItem>&
         cell->setHeight(170);
         cell->setMarginRight(10);
 
-        MediaItem capturedItem = item;
-        cell->registerClickAction([this, capturedItem](brls::View* view) {
-            onItemSelected(capturedItem);
+        cell->registerClickAction([this, cell](brls::View* view) {
+            onItemSelected(cell->getItem());
             return true;
         });
 
@@ -155,107 +169,205 @@ void SearchTab::populateRow(brls::Box* rowContent, const std::vector<MediaItem>&
     }
 }
 
+void SearchTab::cancelPendingSearch() {
+    if (m_searchCancel) {
+        m_searchCancel->store(true);
+        m_searchCancel.reset();
+    }
+    m_pendingLibraries = 0;
+}
+
+void SearchTab::clearResults() {
+    m_results.clear();
+    m_resultKeys.clear();
+    m_movies.clear();  // books
+    m_shows.clear();   // podcasts
+    m_episodes.clear();
+    m_music.clear();
+
+    // Hide all rows and labels
+    auto& views = m_scrollContent->getChildren();
+    for (size_t i = 0; i < views.size(); i++) {
+        views[i]->setVisibility(brls::Visibility::GONE);
+    }
+}
+
 void SearchTab::performSearch(const std::string& query) {
-    if (query.empty()) {
-        m_resultsLabel->setText("");
-        m_results.clear();
-        m_movies.clear();  // books
-        m_shows.clear();   // podcasts
-        m_episodes.clear();
-        m_music.clear();
+    // A newer query replaces whatever is still in flight
+    cancelPendingSearch();
+    uint64_t generation = ++m_searchGeneration;
 
-        // Hide all rows
-        m_moviesRow->setVisibility(brls::Visibility::GONE);
-        m_showsRow->setVisibility(brls::Visibility::GONE);
-        m_episodesRow->setVisibility(brls::Visibility::GONE);
+    clearResults();
 
-        // Hide labels
-        auto& views = m_scrollContent->getChildren();
-        for (size_t i = 0; i < views.size(); i++) {
-            views[i]->setVisibility(brls::Visibility::GONE);
-        }
+    if (query.empty()) {
+        m_resultsLabel->setText("");
         return;
     }
 
-    AudiobookshelfClient& client = AudiobookshelfClient::getInstance();
+    // Local index first - answers instantly and works offline
+    // (index copies may be stale, so entities other tabs hold take precedence)
+    m_results = ItemStore::getInstance().internAll(SearchIndex::getInstance().search(query));
+    m_resultKeys.clear();
+    for (const auto& item : m_results) {
+        m_resultKeys.insert(SearchIndex::itemKey(*item));
+    }
+    if (!m_results.empty()) {
+        showResults();
+    }
+
+    m_resultsLabel->setText(m_results.empty() ? "Searching..." :
+                            "Found " + std::to_string(m_results.size()) + " results (searching...)");
+    m_searchCancel = std::make_shared<std::atomic<bool>>(false);
+    HttpCancelToken cancelToken = m_searchCancel;
 
-    // Audiobookshelf search requires a library ID
-    // Search across all libraries
-    std::vector<Library> libraries;
-    if (!client.fetchLibraries(libraries) || libraries.empty()) {
-        m_resultsLabel->setText("No libraries available");
+    if (!m_libraries.empty()) {
+        searchLibraries(m_libraries, query, generation, cancelToken);
         return;
     }
 
-    m_results.clear();
-    m_movies.clear();  // books
-    m_shows.clear();   // podcasts
-    m_episodes.clear();
+    // Audiobookshelf search requires a library ID - fetch the list once and cache it
+    std::weak_ptr<bool> aliveWeak = m_alive;
+    asyncRun([this, query, generation, cancelToken, aliveWeak]() {
+        std::vector<Library> libraries;
+        bool ok = AudiobookshelfClient::getInstance().fetchLibraries(libraries);
+
+        brls::sync([this, query, generation, cancelToken, libraries, ok, aliveWeak]() {
+            auto alive = aliveWeak.lock();
+            if (!alive || !*alive) return;
 
-    // Search each library
+            if (ok && !libraries.empty()) {
+                m_libraries = libraries;
+            }
+            if (generation != m_searchGeneration || cancelToken->load()) return;
+
+            if (!ok || libraries.empty()) {
+                // Offline: the local results (if any) are all we have
+                m_searchCancel.reset();
+                if (m_results.empty()) {
+                    m_resultsLabel->setText("No libraries available");
+                } else {
+                    m_resultsLabel->setText("Found " + std::to_string(m_results.size()) + " results (offline)");
+                }
+                return;
+            }
+            searchLibraries(m_libraries, query, generation, cancelToken);
+        });
+    });
+}
+
+void SearchTab::searchLibraries(const std::vector<Library>& libraries, const std::string& query,
+                                uint64_t generation, HttpCancelToken cancelToken) {
+    m_pendingLibraries = (int)libraries.size();
+    std::weak_ptr<bool> aliveWeak = m_alive;
+
+    // One worker per library so results show up as each library answers
     for (const auto& lib : libraries) {
-        std::vector<MediaItem> libResults;
-        if (client.search(lib.id, query, libResults)) {
-            for (auto& item : libResults) {
-                m_results.push_back(item);
+        std::string libraryId = lib.id;
+        asyncRun([this, libraryId, query, generation, cancelToken, aliveWeak]() {
+            std::vector<MediaItem> libResults;
+            if (!AudiobookshelfClient::getInstance().search(libraryId, query, libResults, cancelToken)) {
+                libResults.clear();
             }
-        }
+            if (cancelToken->load()) return;
+            SearchIndex::getInstance().indexItems(libResults);
+            std::vector<MediaItemSummary> summaries = MediaItemSummary::fromItems(libResults);
+
+            brls::sync([this, generation, summaries, aliveWeak]() {
+                auto alive = aliveWeak.lock();
+                if (!alive || !*alive) return;
+                onLibraryResults(generation, summaries);
+            });
+        });
     }
+}
 
-    if (!m_results.empty()) {
-        m_resultsLabel->setText("Found " + std::to_string(m_results.size()) + " results");
-
-        // Organize results by type for Audiobookshelf
-        for (const auto& item : m_results) {
-            if (item.mediaType == MediaType::BOOK) {
-                m_movies.push_back(item);  // Using movies vector for books
-            } else if (item.mediaType == MediaType::PODCAST) {
-                m_shows.push_back(item);   // Using shows vector for podcasts
-            } else if (item.mediaType == MediaType::PODCAST_EPISODE) {
-                m_episodes.push_back(item);
-            }
-        }
+void SearchTab::onLibraryResults(uint64_t generation, std::vector<MediaItemSummary> results) {
+    if (generation != m_searchGeneration) return;  // Stale query
 
-        // Update rows visibility and content
-        // Order: Books(0,1), Podcasts(2,3), Episodes(4,5)
-        auto& views = m_scrollContent->getChildren();
+    m_pendingLibraries--;
 
-        // Books (label at index 0, row at index 1)
-        if (!m_movies.empty()) {
-            views[0]->setVisibility(brls::Visibility::VISIBLE);
-            m_moviesRow->setVisibility(brls::Visibility::VISIBLE);
-            populateRow(m_moviesContent, m_movies);
-        } else {
-            views[0]->setVisibility(brls::Visibility::GONE);
-            m_moviesRow->setVisibility(brls::Visibility::GONE);
+    // Server results only fill in what the local index didn't already show
+    // (storing them also refreshes cells already showing the same items)
+    size_t added = 0;
+    for (const auto& item : results) {
+        ItemRef ref = ItemStore::getInstance().put(item);
+        if (m_resultKeys.insert(SearchIndex::itemKey(item)).second) {
+            m_results.push_back(std::move(ref));
+            added++;
         }
+    }
 
-        // Podcasts (label at index 2, row at index 3)
-        if (!m_shows.empty()) {
-            views[2]->setVisibility(brls::Visibility::VISIBLE);
-            m_showsRow->setVisibility(brls::Visibility::VISIBLE);
-            populateRow(m_showsContent, m_shows);
+    if (added > 0 || m_pendingLibraries <= 0) {
+        if (m_pendingLibraries <= 0) {
+            m_searchCancel.reset();
+        }
+        if (m_results.empty()) {
+            m_resultsLabel->setText("No results found");
+        } else if (added > 0) {
+            showResults();
         } else {
-            views[2]->setVisibility(brls::Visibility::GONE);
-            m_showsRow->setVisibility(brls::Visibility::GONE);
+            m_resultsLabel->setText("Found " + std::to_string(m_results.size()) + " results");
         }
+    }
+}
 
-        // Episodes (label at index 4, row at index 5)
-        if (!m_episodes.empty()) {
-            views[4]->setVisibility(brls::Visibility::VISIBLE);
-            m_episodesRow->setVisibility(brls::Visibility::VISIBLE);
-            populateRow(m_episodesContent, m_episodes);
-        } else {
-            views[4]->setVisibility(brls::Visibility::GONE);
-            m_episodesRow->setVisibility(brls::Visibility::GONE);
+void SearchTab::showResults() {
+    std::string status = "Found " + std::to_string(m_results.size()) + " results";
+    if (m_pendingLibraries > 0) {
+        status += " (searching...)";
+    }
+    m_resultsLabel->setText(status);
+
+    // Organize results by type for Audiobookshelf
+    m_movies.clear();
+    m_shows.clear();
+    m_episodes.clear();
+    for (const auto& item : m_results) {
+        if (item->mediaType == MediaType::BOOK) {
+            m_movies.push_back(item);  // Using movies vector for books
+        } else if (item->mediaType == MediaType::PODCAST) {
+            m_shows.push_back(item);   // Using shows vector for podcasts
+        } else if (item->mediaType == MediaType::PODCAST_EPISODE) {
+            m_episodes.push_back(item);
         }
+    }
+
+    // Update rows visibility and content
+    // Order: Books(0,1), Podcasts(2,3), Episodes(4,5)
+    auto& views = m_scrollContent->getChildren();
+
+    // Books (label at index 0, row at index 1)
+    if (!m_movies.empty()) {
+        views[0]->setVisibility(brls::Visibility::VISIBLE);
+        m_moviesRow->setVisibility(brls::Visibility::VISIBLE);
+        populateRow(m_moviesContent, m_movies);
+    } else {
+        views[0]->setVisibility(brls::Visibility::GONE);
+        m_moviesRow->setVisibility(brls::Visibility::GONE);
+    }
+
+    // Podcasts (label at index 2, row at index 3)
+    if (!m_shows.empty()) {
+        views[2]->setVisibility(brls::Visibility::VISIBLE);
+        m_showsRow->setVisibility(brls::Visibility::VISIBLE);
+        populateRow(m_showsContent, m_shows);
+    } else {
+        views[2]->setVisibility(brls::Visibility::GONE);
+        m_showsRow->setVisibility(brls::Visibility::GONE);
+    }
 
+    // Episodes (label at index 4, row at index 5)
+    if (!m_episodes.empty()) {
+        views[4]->setVisibility(brls::Visibility::VISIBLE);
+        m_episodesRow->setVisibility(brls::Visibility::VISIBLE);
+        populateRow(m_episodesContent, m_episodes);
     } else {
-        m_resultsLabel->setText("No results found");
+        views[4]->setVisibility(brls::Visibility::GONE);
+        m_episodesRow->setVisibility(brls::Visibility::GONE);
     }
 }
 
-void SearchTab::onItemSelected(const MediaItem& item) {
+void SearchTab::onItemSelected(const MediaItemSummary& item) {
     // For podcast episodes, play directly instead of showing detail view
     if (item.mediaType == MediaType::PODCAST_EPISODE) {
         Application::getInstance().pushPlayerActivity(item.podcastId, item.episodeId);
@@ -263,7 +375,7 @@ void SearchTab::onItemSelected(const MediaItem& item) {
     }
 
     // Show media detail view for books and podcasts
-    auto* detailView = new MediaDetailView(item);
+    auto* detailView = new MediaDetailView(item.toItem());
     brls::Application::pushActivity(new brls::Activity(detailView));
 }
 
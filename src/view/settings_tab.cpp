@@ -6,6 +6,10 @@
 #include "app/application.hpp"
 #include "app/audiobookshelf_client.hpp"
 #include "app/downloads_manager.hpp"
+#include "app/content_snapshot.hpp"
+#include "app/search_index.hpp"
+#include "app/metadata_store.hpp"
+#include "app/item_store.hpp"
 #include "player/mpv_player.hpp"
 #include "activity/player_activity.hpp"
 #include "platform/platform.hpp"
@@ -443,6 +447,15 @@ void SettingsTab::createDownloadsSection() {
     downloadOnPlayInfo->setMarginBottom(8);
     m_contentBox->addView(downloadOnPlayInfo);
 
+    // Round-robin queue toggle
+    auto* roundRobinToggle = new brls::BooleanCell();
+    roundRobinToggle->init("Alternate Podcasts in Queue", settings.downloadRoundRobin, [&settings](bool value) {
+        settings.downloadRoundRobin = value;
+        DownloadsManager::getInstance().setRoundRobin(value);
+        Application::getInstance().saveSettings();
+    });
+    m_contentBox->addView(roundRobinToggle);
+
     // Delete after finish toggle
     m_deleteAfterWatchToggle = new brls::BooleanCell();
     m_deleteAfterWatchToggle->init("Delete After Finishing", settings.deleteAfterFinish, [&settings](bool value) {
@@ -588,6 +601,10 @@ void SettingsTab::onLogout() {
         Application::getInstance().setServerUrl("");
         Application::getInstance().setUsername("");
         Application::getInstance().saveSettings();
+        ContentSnapshot::getInstance().clear();
+        SearchIndex::getInstance().clear();
+        MetadataStore::getInstance().clear();
+        ItemStore::getInstance().clear();
 
         // Go back to login
         Application::getInstance().pushLoginActivity();